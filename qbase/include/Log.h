@@ -66,23 +66,187 @@ namespace logging
 
 /////////////////////////////////////////////////////////////////////////////////////
 // Scoped topics
+//  QLOG_TOPIC registers its topic once, at static init, and gets an integer ID. Entering the scope only links it in
+//  a thread local list - nothing is looked up or allocated, so scopes that don't log cost a couple of stores.
+//  The level of the innermost topic is checked before the arguments of a log are evaluated.
 
-    extern void push_topic(char const* topic);
-    extern void pop_topic();
+    typedef uint16_t Topic_Id; //0 is no topic
 
-    struct Scoped_Topic
+    //finds or adds a topic. Topics past the max count share the 'no topic' ID
+    extern auto register_topic(char const* name) -> Topic_Id;
+
+    namespace detail
+    {
+        constexpr size_t MAX_TOPIC_COUNT = 256;
+
+        struct Topic_Scope
+        {
+            Topic_Id id = 0;
+            Topic_Scope const* parent = nullptr;
+        };
+        extern __thread Topic_Scope const* s_topic_scope;
+
+        //the lowest level logged for each topic, above ERR if it's disabled
+        extern std::atomic<uint8_t> s_topic_min_levels[MAX_TOPIC_COUNT];
+
+        inline auto is_enabled(Level level) -> bool
+        {
+            Topic_Id id = s_topic_scope ? s_topic_scope->id : 0;
+            return static_cast<uint8_t>(level) >= s_topic_min_levels[id].load(std::memory_order_relaxed);
+        }
+
+        //Tag is a local struct with a static name() function, one for each QLOG_TOPIC line
+        template<class Tag> struct Topic_Registrar
+        {
+            static Topic_Id const id;
+        };
+        template<class Tag> Topic_Id const Topic_Registrar<Tag>::id = register_topic(Tag::name());
+    }
+
+    struct Scoped_Topic : public detail::Topic_Scope
     {
-        template<int N> Scoped_Topic(const char (&topic)[N])
+        Scoped_Topic(Topic_Id topic_id)
         {
-            push_topic(topic);
+            id = topic_id;
+            parent = detail::s_topic_scope;
+            detail::s_topic_scope = this;
         }
         ~Scoped_Topic()
         {
-            pop_topic();
+            detail::s_topic_scope = parent;
         }
+        Scoped_Topic(Scoped_Topic const&) = delete;
+        Scoped_Topic& operator=(Scoped_Topic const&) = delete;
     };
 
 
+/////////////////////////////////////////////////////////////////////////////////////
+// Asynchronous logging
+//  The log calls only copy the format string, the arguments, a timestamp and the topics in a ring of the calling
+//  thread - no lock and no formatting. A background thread formats the records and sends them to the loggers.
+//  When a ring is full the record is dropped and counted. Errors are still logged on the calling thread, after the
+//  records queued so far.
+
+    //thread_init is called first thing in the background thread (to name it or set its priority)
+    extern void start_async(size_t records_per_thread = 1024, std::function<void()> thread_init = std::function<void()>());
+    extern void stop_async();
+
+    //waits until the background thread logged all the records queued so far
+    extern void flush();
+
+    //records lost because a ring was full
+    extern auto get_dropped_record_count() -> uint64_t;
+
+    //Each call site logs at most this many times per second, the rest are counted and reported with its next log.
+    //Zero disables the limit and errors are never limited. Works both with and without async logging.
+    extern void set_rate_limit(uint32_t logs_per_second);
+
+    namespace detail
+    {
+        constexpr size_t MAX_ASYNC_TOPIC_DEPTH = 4;
+        constexpr size_t MAX_ASYNC_ARGS_SIZE = 192;
+
+        struct Async_Record
+        {
+            //formats the message from the args and destroys them
+            void (*format)(void* args, std::string& dst) = nullptr;
+            char const* file = nullptr;
+            int line = 0;
+            Level level = Level::DBG;
+            uint8_t topic_count = 0;
+            uint32_t suppressed_count = 0;
+            int64_t tp_ns = 0;
+            Topic_Id topics[MAX_ASYNC_TOPIC_DEPTH]; //outermost first
+            alignas(alignof(std::max_align_t)) uint8_t args[MAX_ASYNC_ARGS_SIZE];
+        };
+
+        //the state of one QLOG* line, for the rate limit
+        struct Call_Site
+        {
+            std::atomic<int64_t> window_start_ns = { 0 };
+            std::atomic<uint32_t> count = { 0 };
+            std::atomic<uint32_t> suppressed_count = { 0 };
+        };
+
+        extern std::atomic<bool> s_is_async;
+        extern std::atomic<uint32_t> s_rate_limit;
+
+        //the log timestamp. Reading the clock is a good part of the cost of a log so it's read once per log
+        inline auto get_tp_ns() -> int64_t
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        //false if the call site is over its rate limit at tp_ns. suppressed_count is how many logs it skipped since the last one
+        extern auto check_rate_limit(Call_Site& site, int64_t tp_ns, uint32_t& suppressed_count) -> bool;
+
+        //a record in the ring of the calling thread with the file, line, timestamp and topics filled in.
+        //nullptr if the ring is full
+        extern auto begin_async_record(Level level, char const* file, int line, int64_t tp_ns) -> Async_Record*;
+        //makes the record visible to the background thread
+        extern void end_async_record();
+
+        //the args are stored by value. C strings are copied since they rarely outlive the log call
+        template<class T> struct Async_Arg { typedef typename std::decay<T>::type type; };
+        template<> struct Async_Arg<char const*> { typedef std::string type; };
+        template<> struct Async_Arg<char*> { typedef std::string type; };
+        template<class T> using Async_Arg_t = typename Async_Arg<typename std::decay<T>::type>::type;
+
+        //format strings are literals almost always, so arrays are kept as pointers
+        template<class Fmt> struct Async_Fmt { typedef Fmt type; };
+        template<size_t N> struct Async_Fmt<char[N]> { typedef char const* type; };
+
+        //std::index_sequence is c++14
+        template<size_t... I> struct Indices {};
+        template<size_t N, size_t... I> struct Make_Indices : Make_Indices<N - 1, N - 1, I...> {};
+        template<size_t... I> struct Make_Indices<0, I...> { typedef Indices<I...> type; };
+
+        template<class Args, size_t... I>
+        void format_async_args(Args& args, std::string& dst, Indices<I...>)
+        {
+            q::util::format_emplace(dst, std::get<0>(args), std::get<I + 1>(args)...);
+        }
+
+        template<class Args, size_t Arg_Count>
+        void format_async_record(void* data, std::string& dst)
+        {
+            Args& args = *reinterpret_cast<Args*>(data);
+            format_async_args(args, dst, typename Make_Indices<Arg_Count>::type());
+            args.~Args();
+        }
+
+        template<class Fmt, typename... Params>
+        void log_async(std::true_type, Level level, uint32_t suppressed_count, char const* file, int line, int64_t tp_ns, Fmt const& fmt, Params&&... params)
+        {
+            typedef std::tuple<typename Async_Fmt<Fmt>::type, Async_Arg_t<Params>...> Args;
+
+            Async_Record* record = begin_async_record(level, file, line, tp_ns);
+            if (record)
+            {
+                new (record->args) Args(fmt, std::forward<Params>(params)...);
+                record->format = &format_async_record<Args, sizeof...(Params)>;
+                record->suppressed_count = suppressed_count;
+                end_async_record();
+            }
+        }
+
+        //the args don't fit in a record, format them here
+        template<class Fmt, typename... Params>
+        void log_async(std::false_type, Level level, uint32_t suppressed_count, char const* file, int line, int64_t tp_ns, Fmt const& fmt, Params&&... params)
+        {
+            std::string message;
+            q::util::format_emplace(message, fmt, std::forward<Params>(params)...);
+            log_async(std::true_type(), level, suppressed_count, file, line, tp_ns, "{}", std::move(message));
+        }
+
+        template<class Fmt, typename... Params>
+        struct Fits_Async_Record
+        {
+            typedef std::tuple<typename Async_Fmt<Fmt>::type, Async_Arg_t<Params>...> Args;
+            static constexpr bool value = sizeof(Args) <= MAX_ASYNC_ARGS_SIZE && alignof(Args) <= alignof(std::max_align_t);
+        };
+    }
+
 /////////////////////////////////////////////////////////////////////////////////////
 // The log functions
 // Note: Various prototypes are provided to avoid memory allocations as much as possible
@@ -100,6 +264,36 @@ namespace logging
         log(level, file, line, message);
 	}
 
+    //the QLOG* macros go through here, after checking the level
+    template<class Fmt, typename... Params>
+    void logf(logging::detail::Call_Site& site, logging::Level level, char const* file, int line, Fmt const& fmt, Params&&... params)
+    {
+        using namespace logging;
+
+        //errors are never skipped
+        uint32_t suppressed_count = 0;
+        int64_t tp_ns = detail::get_tp_ns();
+        if (level != Level::ERR && !detail::check_rate_limit(site, tp_ns, suppressed_count))
+        {
+            return;
+        }
+
+        if (level != Level::ERR && detail::s_is_async.load(std::memory_order_relaxed))
+        {
+            detail::log_async(std::integral_constant<bool, detail::Fits_Async_Record<Fmt, Params...>::value>(),
+                              level, suppressed_count, file, line, tp_ns, fmt, std::forward<Params>(params)...);
+            return;
+        }
+
+        std::string message;
+        q::util::format_emplace(message, fmt, std::forward<Params>(params)...);
+        if (suppressed_count > 0)
+        {
+            message.append(q::util::format<std::string>(" ({} similar logs skipped)", suppressed_count));
+        }
+        log(level, file, line, message);
+    }
+
 	template<class Fmt, typename... Params>
     void quick_logf(Fmt const& fmt, Params&&... params)
 	{
@@ -109,11 +303,18 @@ namespace logging
         fflush(stdout);
 	}
 
-#   define QLOG_TOPIC(topic)    q::logging::Scoped_Topic st_##__LINE__(topic)
-#   define QLOGD(fmt, ...)      q::logf(q::logging::Level::DBG, __FILE__, __LINE__, fmt, ##__VA_ARGS__)
-#   define QLOGI(fmt, ...) 		q::logf(q::logging::Level::INFO, __FILE__, __LINE__, fmt, ##__VA_ARGS__)
-#   define QLOGW(fmt, ...)      q::logf(q::logging::Level::WARNING, __FILE__, __LINE__, fmt, ##__VA_ARGS__)
-#   define QLOGE(fmt, ...)      q::logf(q::logging::Level::ERR, __FILE__, __LINE__, fmt, ##__VA_ARGS__)
+#   define QLOG_CONCAT_(a, b)   a##b
+#   define QLOG_CONCAT(a, b)    QLOG_CONCAT_(a, b)
+#   define QLOG_TOPIC(topic)                                                                                             \
+        struct QLOG_CONCAT(qlog_topic_tag_, __LINE__) { static constexpr char const* name() { return topic; } };       \
+        q::logging::Scoped_Topic QLOG_CONCAT(qlog_topic_, __LINE__)(q::logging::detail::Topic_Registrar<QLOG_CONCAT(qlog_topic_tag_, __LINE__)>::id)
+
+#   define QLOG_CALL_SITE()     ([]() -> q::logging::detail::Call_Site& { static q::logging::detail::Call_Site site; return site; }())
+#   define QLOG_(level, fmt, ...) (q::logging::detail::is_enabled(level) ? q::logf(QLOG_CALL_SITE(), level, __FILE__, __LINE__, fmt, ##__VA_ARGS__) : (void)0)
+#   define QLOGD(fmt, ...)      QLOG_(q::logging::Level::DBG, fmt, ##__VA_ARGS__)
+#   define QLOGI(fmt, ...) 		QLOG_(q::logging::Level::INFO, fmt, ##__VA_ARGS__)
+#   define QLOGW(fmt, ...)      QLOG_(q::logging::Level::WARNING, fmt, ##__VA_ARGS__)
+#   define QLOGE(fmt, ...)      QLOG_(q::logging::Level::ERR, fmt, ##__VA_ARGS__)
 
 }
 
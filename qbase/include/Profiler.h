@@ -1,210 +1,209 @@
-#ifndef __PROFILER_H__
-#define __PROFILER_H__
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <ctime>
+
+#if defined(__x86_64__) || defined(__i386__)
+#   include <x86intrin.h>
+#endif
+
+//The zones, counters and frame markers are compiled in only with __PROFILER_ENABLED__ defined (CONFIG += profiler
+// in qmake). Without it the macros expand to nothing.
+//With it a zone costs a relaxed load while the profiler is stopped, and two timestamps plus a store in a per thread
+// ring while it runs. A background thread drains the rings into a chrome trace (chrome://tracing, ui.perfetto.dev)
+// and/or a periodic summary log.
 
 //#define __PROFILER_ENABLED__
 #define __PROFILER_FULL_TYPE_EXPANSION__
 
-#undef noinline
-#undef fastcall
-
-#if defined(_MSC_VER)
-	#undef __PRETTY_FUNCTION__
-	#define __PRETTY_FUNCTION__ __FUNCSIG__
-	#define PROFILE_CONCAT( a, b ) a "/" b
-
-	#define noinline __declspec(noinline)
-	#define fastcall __fastcall
-#else
-	#define PROFILE_CONCAT( a, b ) b
-
-	#define noinline __attribute__ ((noinline))
-	#define fastcall
-#endif
-
 #if defined(__PROFILER_FULL_TYPE_EXPANSION__)
-	#define PROFILE_FUNCTION() __PRETTY_FUNCTION__
+#   define PROFILE_FUNCTION() __PRETTY_FUNCTION__
 #else
-	#define PROFILE_FUNCTION() __FUNCTION__
+#   define PROFILE_FUNCTION() __FUNCTION__
 #endif
 
-#if defined(__PROFILER_ENABLED__)
-	// thread
-	#define PROFILE_THREAD_START_RAW( text )   Profiler::threadenter( text );
-	#define PROFILE_THREAD_START()             PROFILE_THREAD_START_RAW( PROFILE_FUNCTION()  )
-	#define PROFILE_THREAD_START_DESC( desc )  PROFILE_THREAD_START_RAW( PROFILE_CONCAT( PROFILE_FUNCTION(), desc ) )
-
-	#define PROFILE_THREAD_SCOPED_RAW( text )  Profiler::ScopedThread profiler##__LINE__ ( text );
-	#define PROFILE_THREAD_SCOPED()            PROFILE_THREAD_SCOPED_RAW( PROFILE_FUNCTION() )
-	#define PROFILE_THREAD_SCOPED_DESC( desc ) PROFILE_THREAD_SCOPED_RAW( PROFILE_CONCAT( PROFILE_FUNCTION(), desc ) )
-
-	#define PROFILE_THREAD_STOP()              Profiler::threadexit();
-
-	// function
-	#define PROFILE_PAUSE()             Profiler::pause();
-	#define PROFILE_UNPAUSE()           Profiler::unpause();
-	#define PROFILE_PAUSE_SCOPED()      Profiler::ScopedPause profilerpause##__LINE__;
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
 
-	#define PROFILE_START_RAW( text )   Profiler::enter( text );
-	#define PROFILE_START()             PROFILE_START_RAW( PROFILE_FUNCTION()  )
-	#define PROFILE_START_DESC( desc )  PROFILE_START_RAW( PROFILE_CONCAT( PROFILE_FUNCTION(), desc ) )
-
-	#define PROFILE_SCOPED_RAW( text )  Profiler::Scoped profiler##__LINE__ ( text );
-	#define PROFILE_SCOPED()            PROFILE_SCOPED_RAW( PROFILE_FUNCTION() )
-	#define PROFILE_SCOPED_DESC( desc ) PROFILE_SCOPED_RAW( PROFILE_CONCAT( PROFILE_FUNCTION(), desc ) )
-
-	#define PROFILE_STOP()              Profiler::exit();
+#if defined(__PROFILER_ENABLED__)
+    //the names have to be string literals, or at least outlive the profiler - only the pointer is recorded
+#   define PROFILE_SCOPED_RAW(text)     q::profiler::Zone PROFILE_CONCAT(profiler_zone_, __LINE__)(text)
+#   define PROFILE_SCOPED()             PROFILE_SCOPED_RAW(PROFILE_FUNCTION())
+#   define PROFILE_SCOPED_DESC(desc)    PROFILE_SCOPED_RAW(desc)
+#   define PROFILE_COUNTER(name, value) q::profiler::counter(name, value)
+#   define PROFILE_FRAME(name)          q::profiler::frame(name)
 #else
-	#define PROFILE_THREAD_START_RAW( text )
-	#define PROFILE_THREAD_START()
-	#define PROFILE_THREAD_START_DESC( desc )
-
-	#define PROFILE_THREAD_SCOPED_RAW( text )
-	#define PROFILE_THREAD_SCOPED()
-	#define PROFILE_THREAD_SCOPED_DESC( desc )
-
-	#define PROFILE_THREAD_STOP()
-
-	#define PROFILE_PAUSE()
-	#define PROFILE_UNPAUSE()
-	#define PROFILE_PAUSE_SCOPED()
-
-	#define PROFILE_START_RAW( text )
-	#define PROFILE_START()
-	#define PROFILE_START_DESC( desc )
-
-	#define PROFILE_SCOPED_RAW( text )
-	#define PROFILE_SCOPED()
-	#define PROFILE_SCOPED_DESC( desc )
-
-	#define PROFILE_STOP()
+#   define PROFILE_SCOPED_RAW(text)
+#   define PROFILE_SCOPED()
+#   define PROFILE_SCOPED_DESC(desc)
+#   define PROFILE_COUNTER(name, value)
+#   define PROFILE_FRAME(name)
 #endif
 
-#if 0
-
-namespace Profiler {
-	/*
-	=============
-	Types that won't conflict with the rest of the system
-	=============
-	*/
-	typedef float f32;
-	typedef double f64;
-	typedef unsigned char uint8_t;
-	typedef unsigned short uint16_t;
-	typedef unsigned int u32;
-	#if defined(_MSC_VER)
-		typedef unsigned __int64 uint64_t;
-	#else
-		typedef unsigned long long uint64_t;
-	#endif
-
-	template< class type1, class type2 >
-	f64 average( type1 sum, type2 count ) {
-		return ( count ) ? f64(sum)/f64(count) : 0;
-	}
-
-	/*
-	=============
-	Timer
-	=============
-	*/
-	#pragma pack(push,1)
-	struct Timer {
-		Timer() { Reset(); }
-
-		inline bool IsEmpty() const { return ticks == 0; }
-		inline bool IsPaused() const { return paused; }
-		inline void Unpause( uint64_t curticks ) { started = curticks; paused = false; }
-		inline void Unpause() { Unpause( getticks() ); }
-		inline void Pause( uint64_t curticks ) { ticks += ( curticks - started ); paused = true; }
-		inline void Pause() { Pause( getticks() ); }		
-		inline void Start() { ++calls; started = getticks(); }
-		inline void Stop() { ticks += ( getticks() - started ); }
-		inline void Reset() { ticks = started = calls = 0; paused = false; }
-		inline void SoftStop() { if ( !paused ) { uint64_t t = getticks(); ticks += ( t - started ); started = t; } }
-		inline void SoftReset() { ticks = 0; calls = 0; started = getticks(); }
-
-		template< class type > static f64 ms( const type &t ) { return f64( t ) / 1000000.0; }
-		f64 millicycles() { return ms( ticks ); }
-		f64 currentmillicycles() { return ms( ticks + ( getticks() - started ) ); }
-		f64 avg() { return average( ticks, calls ); }
-		f64 avgms() { return ms( average( ticks, calls ) ); }
-
-		void operator+= ( const Timer &b ) {
-			ticks += b.ticks;
-			calls += b.calls;
-		}
-
-		static inline uint64_t getticks_serial() {
-	#if defined(__GNUC__)
-			asm volatile("cpuid" : : : "%eax", "%ebx", "%ecx", "%edx" );
-	#else
-			__asm cpuid;
-	#endif
-			return getticks();			
-		}
-
-	#if defined(__GNUC__)
-		static inline uint64_t getticks() {
-			u32 __a,__d;
-			asm volatile("rdtsc" : "=a" (__a), "=d" (__d));
-			return ( uint64_t(__a) | uint64_t(__d) << 32 );
-		}
-	#elif defined(__ICC) || defined(__ICL)
-		static inline uint64_t getticks() { return _rdtsc(); }
-	#else
-		static inline uint64_t getticks() { __asm { rdtsc }; }
-	#endif
-
-		uint64_t ticks, started;
-		u32 calls;
-		bool paused;
-	};
-	#pragma pack(pop)
-
-
-	/*
-	=============
-	Interface functions
-	=============
-	*/
-
-	void detect( int argc, const char *argv[] );
-	void detect( const char *commandLine );
-	void dump();
-	void dumphtml();
-	void fastcall enter( const char *name );
-	void fastcall exit();
-	void fastcall pause();
-	void fastcall unpause();
-	void threadenter( const char *name );
-	void threadexit();
-	void reset();
-
-	struct Scoped {
-		Scoped( const char *name ) { PROFILE_START_RAW( name ) }
-		~Scoped() { PROFILE_STOP() }
-	};
-
-	struct ScopedPause {
-		ScopedPause() { PROFILE_PAUSE() }
-		~ScopedPause() { PROFILE_UNPAUSE() }
-	};
-
-	struct ScopedThread {
-		ScopedThread( const char *name ) { PROFILE_THREAD_START_RAW( name ); }
-		~ScopedThread() { PROFILE_THREAD_STOP() }
-	};
-}; // namespace Profiler
-
-
-struct ScopedTimer {
-	ScopedTimer( Profiler::Timer &t ) : mTimer(t) { mTimer.Start(); }
-	~ScopedTimer() { mTimer.Stop(); }
-protected:
-	Profiler::Timer &mTimer;
+namespace q
+{
+namespace profiler
+{
+
+struct Settings
+{
+    std::string trace_path; //the chrome trace json file, written while profiling. Empty for no trace
+    std::chrono::milliseconds summary_period = std::chrono::milliseconds(0); //logs the zone stats every period. 0 for no summary
+    size_t events_per_thread = 16384; //rounded up to a power of 2. Events are dropped when a ring fills up
+    std::function<void()> thread_init; //called from the profiler thread when it starts
 };
 
+//Not real-time safe. The threads that record events don't have to be registered.
+extern auto start(Settings const& settings) -> bool;
+extern void stop();
+extern auto is_running() -> bool;
+
+//names the calling thread in the trace and the summary
+extern void set_thread_name(std::string const& name);
+
+extern auto get_dropped_event_count() -> uint64_t;
+
+namespace detail
+{
+    enum class Event_Type : uint8_t
+    {
+        ZONE,
+        COUNTER,
+        FRAME
+    };
+
+    struct Event
+    {
+        char const* name;
+        uint64_t begin; //ticks
+        union
+        {
+            uint64_t end; //ticks, for zones
+            double value; //for counters
+        };
+        Event_Type type;
+    };
+
+    //single producer (the owning thread), single consumer (the profiler thread)
+    struct Thread_Buffer
+    {
+        Thread_Buffer(size_t capacity) : events(capacity), mask(capacity - 1) {}
+
+        std::vector<Event> events;
+        size_t mask = 0;
+        uint32_t index = 0;
+
+        std::atomic<size_t> head = { 0 }; //written by the consumer
+        uint8_t padding[64];
+        std::atomic<size_t> tail = { 0 }; //written by the producer
+        std::atomic<uint64_t> dropped_count = { 0 }; //written by the producer
+        std::atomic<bool> is_orphan = { false }; //the owning thread exited
+    };
+
+    extern std::atomic<bool> s_is_running;
+    extern __thread Thread_Buffer* s_thread_buffer;
+    extern auto create_thread_buffer() -> Thread_Buffer*;
+
+    //TSC on x86 - converted to ns by the profiler thread. Elsewhere the vDSO monotonic clock, in ns.
+    inline auto get_ticks() -> uint64_t
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + static_cast<uint64_t>(ts.tv_nsec);
 #endif
+    }
+
+    inline auto begin_event() -> Event*
+    {
+        Thread_Buffer* buffer = s_thread_buffer;
+        if (!buffer)
+        {
+            buffer = create_thread_buffer();
+        }
+        size_t tail = buffer->tail.load(std::memory_order_relaxed);
+        if (tail - buffer->head.load(std::memory_order_acquire) >= buffer->events.size())
+        {
+            buffer->dropped_count.store(buffer->dropped_count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        return &buffer->events[tail & buffer->mask];
+    }
+    inline void end_event()
+    {
+        Thread_Buffer* buffer = s_thread_buffer;
+        buffer->tail.store(buffer->tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+}
+
+class Zone
+{
+public:
+    Zone(char const* name)
+        : m_name(name)
+        , m_begin(detail::s_is_running.load(std::memory_order_relaxed) ? detail::get_ticks() : 0)
+    {
+    }
+    ~Zone()
+    {
+        if (m_begin != 0)
+        {
+            uint64_t end = detail::get_ticks();
+            detail::Event* event = detail::begin_event();
+            if (event)
+            {
+                event->name = m_name;
+                event->begin = m_begin;
+                event->end = end;
+                event->type = detail::Event_Type::ZONE;
+                detail::end_event();
+            }
+        }
+    }
+
+private:
+    char const* m_name;
+    uint64_t m_begin;
+};
 
-#endif // __PROFILER_H__
\ No newline at end of file
+inline void counter(char const* name, double value)
+{
+    if (detail::s_is_running.load(std::memory_order_relaxed))
+    {
+        detail::Event* event = detail::begin_event();
+        if (event)
+        {
+            event->name = name;
+            event->begin = detail::get_ticks();
+            event->value = value;
+            event->type = detail::Event_Type::COUNTER;
+            detail::end_event();
+        }
+    }
+}
+
+inline void frame(char const* name)
+{
+    if (detail::s_is_running.load(std::memory_order_relaxed))
+    {
+        detail::Event* event = detail::begin_event();
+        if (event)
+        {
+            event->name = name;
+            event->begin = detail::get_ticks();
+            event->end = event->begin;
+            event->type = detail::Event_Type::FRAME;
+            detail::end_event();
+        }
+    }
+}
+
+}
+}
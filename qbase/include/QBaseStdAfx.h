@@ -7,6 +7,8 @@
 #include <map>
 #include <vector>
 #include <memory>
+#include <atomic>
+#include <tuple>
 #include <deque>
 #include <functional>
 #include <chrono>
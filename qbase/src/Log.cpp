@@ -3,6 +3,7 @@
 
 #include <map>
 #include <ctime>
+#include <algorithm>
 
 namespace q
 {
@@ -14,39 +15,154 @@ namespace detail
 	{
         Topic() : is_enabled(true), level(q::logging::Level::DBG), decorations(-1) {}
 
+        std::string name;
         bool is_enabled;
 		q::logging::Level level;
 		int decorations;
 	};
 
-    static std::map<std::string, Topic> s_topics;
+    struct Topics
+    {
+        Topics()
+        {
+            //0 is no topic
+            topics.emplace_back();
+            ids[std::string()] = 0;
+        }
+        std::map<std::string, q::logging::Topic_Id> ids;
+        std::vector<Topic> topics;
+    };
+
+    //topics are registered during static init so this can't be a plain static
+    static Topics& get_topics()
+    {
+        static Topics topics;
+        return topics;
+    }
+
+    //zero initialized so all topics start at Level::DBG, even before static init
+    std::atomic<uint8_t> s_topic_min_levels[MAX_TOPIC_COUNT];
+    __thread Topic_Scope const* s_topic_scope = nullptr;
+
     static std::vector<std::unique_ptr<q::logging::Logger>> s_loggers;
 
     static q::logging::Decorations s_decorations(q::logging::Decoration::LOCATION, q::logging::Decoration::TOPIC, q::logging::Decoration::TIME, q::logging::Decoration::LEVEL);
     static q::logging::Level s_level = q::logging::Level::DBG;
     static std::mutex s_mutex;
-    static __thread std::vector<char const*>* s_topic_stack = nullptr;
 
     static std::chrono::steady_clock::time_point s_start_tp = std::chrono::steady_clock::now();
+
+    std::atomic<bool> s_is_async = { false };
+    std::atomic<uint32_t> s_rate_limit = { 0 };
+
+    //single producer (the owning thread), single consumer (the async thread)
+    struct Async_Ring
+    {
+        Async_Ring(size_t capacity) : records(capacity), mask(capacity - 1) {}
+
+        std::vector<Async_Record> records;
+        size_t mask = 0;
+
+        std::atomic<size_t> head = { 0 }; //written by the consumer
+        uint8_t padding[64];
+        std::atomic<size_t> tail = { 0 }; //written by the producer
+        std::atomic<bool> is_orphan = { false }; //the owning thread exited
+    };
+
+    //keeps the ring of a thread and marks it orphan when the thread exits, so the async thread drains and drops it
+    struct Thread_Ring
+    {
+        ~Thread_Ring()
+        {
+            if (ring)
+            {
+                ring->is_orphan = true;
+            }
+        }
+        std::shared_ptr<Async_Ring> ring;
+    };
+    static thread_local Thread_Ring s_thread_ring;
+
+    struct Async_State
+    {
+        ~Async_State()
+        {
+            q::logging::stop_async();
+        }
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::condition_variable flushed_cv;
+        std::vector<std::shared_ptr<Async_Ring>> rings;
+        size_t records_per_thread = 1024;
+
+        std::thread thread;
+        std::thread::id thread_id;
+        bool exit = false;
+        uint64_t flush_requested = 0;
+        uint64_t flush_done = 0;
+
+        std::atomic<uint64_t> dropped_count = { 0 };
+        uint64_t reported_dropped_count = 0;
+    };
+    //after the loggers so it's destroyed first
+    static Async_State s_async;
+
+    //call with s_mutex locked
+    static void update_topic_min_level(q::logging::Topic_Id id)
+    {
+        Topic const& topic = get_topics().topics[id];
+        uint8_t min_level = static_cast<uint8_t>(std::max(s_level, topic.level));
+        s_topic_min_levels[id] = topic.is_enabled ? min_level : static_cast<uint8_t>(q::logging::Level::ERR) + 1;
+    }
+
+    //fills the topics of the current scope, outermost first. The innermost ones are kept if there are too many
+    static auto get_topic_path(q::logging::Topic_Id* ids, size_t max_count) -> size_t
+    {
+        size_t count = 0;
+        for (Topic_Scope const* scope = s_topic_scope; scope && count < max_count; scope = scope->parent)
+        {
+            ids[count++] = scope->id;
+        }
+        std::reverse(ids, ids + count);
+        return count;
+    }
+
+    //call with s_mutex locked
+    static auto find_or_add_topic(std::string const& name) -> q::logging::Topic_Id
+    {
+        Topics& topics = get_topics();
+        auto it = topics.ids.find(name);
+        if (it != topics.ids.end())
+        {
+            return it->second;
+        }
+        if (topics.topics.size() >= MAX_TOPIC_COUNT)
+        {
+            return 0;
+        }
+
+        q::logging::Topic_Id id = static_cast<q::logging::Topic_Id>(topics.topics.size());
+        topics.topics.emplace_back();
+        topics.topics.back().name = name;
+        topics.ids[name] = id;
+        update_topic_min_level(id);
+        return id;
+    }
+
+    static void log_message(q::logging::Level level, char const* file, int line, q::logging::Topic_Id const* topics, size_t topic_count,
+                            int64_t tp_ns, std::string const& message);
 }
 }
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////
 
-void q::logging::push_topic(char const* topic)
+auto q::logging::register_topic(char const* name) -> Topic_Id
 {
-    if (!detail::s_topic_stack)
-    {
-        detail::s_topic_stack = new std::vector<char const*>();
-    }
-    detail::s_topic_stack->push_back(topic);
-}
+    std::lock_guard<std::mutex> lg(detail::s_mutex);
 
-void q::logging::pop_topic()
-{
-    QASSERT(detail::s_topic_stack && !detail::s_topic_stack->empty());
-    detail::s_topic_stack->pop_back();
+    return detail::find_or_add_topic(name);
 }
 
 
@@ -74,7 +190,12 @@ void q::logging::set_topic_enabled(const std::string& topic, bool enabled)
 {
     std::lock_guard<std::mutex> lg(detail::s_mutex);
 
-    detail::s_topics[topic].is_enabled = enabled;
+    Topic_Id id = detail::find_or_add_topic(topic);
+    if (id != 0)
+    {
+        detail::get_topics().topics[id].is_enabled = enabled;
+        detail::update_topic_min_level(id);
+    }
 }
 void q::logging::set_decorations(Decorations decorations)
 {
@@ -86,24 +207,51 @@ void q::logging::set_decorations(const std::string& topic, Decorations decoratio
 {
     std::lock_guard<std::mutex> lg(detail::s_mutex);
 
-    detail::s_topics[topic].decorations = decorations;
+    Topic_Id id = detail::find_or_add_topic(topic);
+    if (id != 0)
+    {
+        detail::get_topics().topics[id].decorations = static_cast<uint8_t>(decorations);
+    }
 }
 void q::logging::set_level(Level level)
 {
     std::lock_guard<std::mutex> lg(detail::s_mutex);
 
     detail::s_level = level;
+    for (size_t id = 0; id < detail::get_topics().topics.size(); id++)
+    {
+        detail::update_topic_min_level(static_cast<Topic_Id>(id));
+    }
 }
 void q::logging::set_level(const std::string& topic, Level level)
 {
     std::lock_guard<std::mutex> lg(detail::s_mutex);
 
-    detail::s_topics[topic].level = level;
+    Topic_Id id = detail::find_or_add_topic(topic);
+    if (id != 0)
+    {
+        detail::get_topics().topics[id].level = level;
+        detail::update_topic_min_level(id);
+    }
 }
 void q::log(logging::Level level, const char* file, int line, const std::string& message)
 {
-	using namespace logging;
+    using namespace logging;
 
+    //keep the order with the records still queued
+    if (detail::s_is_async)
+    {
+        flush();
+    }
+
+    Topic_Id topics[detail::MAX_ASYNC_TOPIC_DEPTH];
+    size_t topic_count = detail::get_topic_path(topics, detail::MAX_ASYNC_TOPIC_DEPTH);
+    detail::log_message(level, file, line, topics, topic_count, detail::get_tp_ns(), message);
+}
+
+void q::logging::detail::log_message(Level level, char const* file, int line, Topic_Id const* topics, size_t topic_count,
+                                     int64_t tp_ns, std::string const& message)
+{
     std::lock_guard<std::mutex> lg(detail::s_mutex);
 
     if (detail::s_loggers.empty())
@@ -111,27 +259,17 @@ void q::log(logging::Level level, const char* file, int line, const std::string&
 		return;
 	}
 
-	//the default settings
-    Level allowedLevel = detail::s_level;
+	//the default settings, overriden by the innermost topic
+    Topic_Id topic_id = topic_count > 0 ? topics[topic_count - 1] : 0;
     auto decorations = detail::s_decorations;
-
-//	//search for overrides for this specific topic
-//    if (topic)
-//    {
-//        auto it = detail::sTopic.find(topic);
-//        if (it != detail::sTopic.end())
-//        {
-//            if (!it->second.isEnabled)
-//            {
-//                return;
-//            }
-//            allowedLevel = static_cast<Level>(std::max(static_cast<int>(allowedLevel), static_cast<int>(it->second.level)));
-//            decorations = it->second.decorations >= 0 ? Decorations(it->second.decorations) : decorations;
-//        }
-//    }
+    Topic const& topic = detail::get_topics().topics[topic_id];
+    if (topic.decorations >= 0)
+    {
+        decorations = Decorations(static_cast<uint8_t>(topic.decorations));
+    }
 
 	//level too low? ignore
-	if (level < allowedLevel)
+	if (static_cast<uint8_t>(level) < detail::s_topic_min_levels[topic_id])
 	{
 		return;
 	}
@@ -152,10 +290,13 @@ void q::log(logging::Level level, const char* file, int line, const std::string&
 		}
 	}
 
+    //the record was queued a bit earlier when logging async
+    auto age = std::chrono::nanoseconds(detail::get_tp_ns() - tp_ns);
+    std::time_t t = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now() - std::chrono::duration_cast<std::chrono::system_clock::duration>(age));
+
 	if (decorations.test(Decoration::DATE) && decorations.test(Decoration::TIME))
 	{
 		char mbstr[100];
-        std::time_t t = std::time(nullptr);
 		if (std::strftime(mbstr, 100, "[%e-%m-%Y %H:%M:%S]", std::localtime(&t))) 
 		{
 			str.append(mbstr);
@@ -164,7 +305,6 @@ void q::log(logging::Level level, const char* file, int line, const std::string&
 	else if (decorations.test(Decoration::DATE))
 	{
 		char mbstr[100];
-        std::time_t t = std::time(nullptr);
 		if (std::strftime(mbstr, 100, "[%e-%m-%Y]", std::localtime(&t))) 
 		{
 			str.append(mbstr);
@@ -173,7 +313,6 @@ void q::log(logging::Level level, const char* file, int line, const std::string&
 	else if (decorations.test(Decoration::TIME))
 	{
 		char mbstr[100];
-        std::time_t t = std::time(nullptr);
 		if (std::strftime(mbstr, 100, "[%H:%M:%S]", std::localtime(&t))) 
 		{
 			str.append(mbstr);
@@ -182,7 +321,7 @@ void q::log(logging::Level level, const char* file, int line, const std::string&
     if (decorations.test(Decoration::TIMESTAMP))
     {
         char mbstr[100];
-        auto d = std::chrono::steady_clock::now() - detail::s_start_tp;
+        auto d = std::chrono::nanoseconds(tp_ns) - detail::s_start_tp.time_since_epoch();
         uint32_t us = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(d).count());
         uint32_t _us = us % 1000;
         uint32_t ms = us / 1000;
@@ -192,15 +331,15 @@ void q::log(logging::Level level, const char* file, int line, const std::string&
         str.append(mbstr);
     }
 
-    if (decorations.test(Decoration::TOPIC) && detail::s_topic_stack && !detail::s_topic_stack->empty())
+    if (decorations.test(Decoration::TOPIC) && topic_count > 0)
     {
         str.push_back('[');
-        for (size_t i = 0; i + 1 < detail::s_topic_stack->size(); i++)
+        for (size_t i = 0; i + 1 < topic_count; i++)
         {
-            str.append((*detail::s_topic_stack)[i]);
+            str.append(detail::get_topics().topics[topics[i]].name);
             str.push_back('/');
         }
-        str.append(detail::s_topic_stack->back());
+        str.append(topic.name);
         str.push_back(']');
     }
 
@@ -229,6 +368,204 @@ void q::log(logging::Level level, const char* file, int line, const std::string&
 	}
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////////////
 
+auto q::logging::detail::check_rate_limit(Call_Site& site, int64_t tp_ns, uint32_t& suppressed_count) -> bool
+{
+    uint32_t limit = s_rate_limit.load(std::memory_order_relaxed);
+    if (limit == 0)
+    {
+        return true;
+    }
 
+    int64_t window_start_ns = site.window_start_ns.load(std::memory_order_relaxed);
+    if (tp_ns - window_start_ns >= 1000000000LL &&
+        site.window_start_ns.compare_exchange_strong(window_start_ns, tp_ns, std::memory_order_relaxed))
+    {
+        site.count.store(0, std::memory_order_relaxed);
+    }
 
+    if (site.count.fetch_add(1, std::memory_order_relaxed) < limit)
+    {
+        //the exchange is a locked instruction, most logs have nothing to report
+        if (site.suppressed_count.load(std::memory_order_relaxed) != 0)
+        {
+            suppressed_count = site.suppressed_count.exchange(0, std::memory_order_relaxed);
+        }
+        return true;
+    }
+    site.suppressed_count.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+auto q::logging::detail::begin_async_record(Level level, char const* file, int line, int64_t tp_ns) -> Async_Record*
+{
+    Async_Ring* ring = s_thread_ring.ring.get();
+    if (!ring)
+    {
+        //first log of this thread
+        std::lock_guard<std::mutex> lg(s_async.mutex);
+        s_thread_ring.ring = std::make_shared<Async_Ring>(s_async.records_per_thread);
+        s_async.rings.push_back(s_thread_ring.ring);
+        ring = s_thread_ring.ring.get();
+    }
+
+    size_t tail = ring->tail.load(std::memory_order_relaxed);
+    if (tail - ring->head.load(std::memory_order_acquire) >= ring->records.size())
+    {
+        s_async.dropped_count.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    Async_Record& record = ring->records[tail & ring->mask];
+    record.file = file;
+    record.line = line;
+    record.level = level;
+    record.tp_ns = tp_ns;
+
+    record.topic_count = static_cast<uint8_t>(get_topic_path(record.topics, MAX_ASYNC_TOPIC_DEPTH));
+    return &record;
+}
+
+void q::logging::detail::end_async_record()
+{
+    Async_Ring* ring = s_thread_ring.ring.get();
+    ring->tail.store(ring->tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+namespace q
+{
+namespace logging
+{
+namespace detail
+{
+
+//call with the async mutex locked
+static void drain_async_rings(std::string& message)
+{
+    for (std::shared_ptr<Async_Ring> const& ring: s_async.rings)
+    {
+        size_t head = ring->head.load(std::memory_order_relaxed);
+        size_t tail = ring->tail.load(std::memory_order_acquire);
+        for (; head != tail; head++)
+        {
+            Async_Record& record = ring->records[head & ring->mask];
+            record.format(record.args, message);
+            if (record.suppressed_count > 0)
+            {
+                message.append(q::util::format<std::string>(" ({} similar logs skipped)", record.suppressed_count));
+            }
+            log_message(record.level, record.file, record.line, record.topics, record.topic_count, record.tp_ns, message);
+            ring->head.store(head + 1, std::memory_order_release);
+        }
+    }
+
+    //the rings of exited threads are dropped once empty
+    s_async.rings.erase(std::remove_if(s_async.rings.begin(), s_async.rings.end(), [](std::shared_ptr<Async_Ring> const& ring)
+    {
+        return ring->is_orphan && ring->head.load() == ring->tail.load();
+    }), s_async.rings.end());
+
+    uint64_t dropped_count = s_async.dropped_count.load(std::memory_order_relaxed);
+    if (dropped_count != s_async.reported_dropped_count)
+    {
+        log_message(Level::WARNING, __FILE__, __LINE__, nullptr, 0, get_tp_ns(),
+                    q::util::format<std::string>("Dropped {} log records, {} in total", dropped_count - s_async.reported_dropped_count, dropped_count));
+        s_async.reported_dropped_count = dropped_count;
+    }
+}
+
+static void async_thread_proc(std::function<void()> thread_init)
+{
+    if (thread_init)
+    {
+        thread_init();
+    }
+
+    std::string message;
+    std::unique_lock<std::mutex> lock(s_async.mutex);
+    while (true)
+    {
+        bool exit = s_async.exit;
+        uint64_t flush_requested = s_async.flush_requested;
+
+        drain_async_rings(message);
+
+        if (s_async.flush_done != flush_requested)
+        {
+            s_async.flush_done = flush_requested;
+            s_async.flushed_cv.notify_all();
+        }
+        if (exit)
+        {
+            break;
+        }
+
+        //the producers never wake this thread up - that would cost them a syscall
+        s_async.cv.wait_for(lock, std::chrono::milliseconds(10));
+    }
+}
+
+}
+}
+}
+
+void q::logging::start_async(size_t records_per_thread, std::function<void()> thread_init)
+{
+    std::lock_guard<std::mutex> lg(detail::s_async.mutex);
+    if (detail::s_async.thread.joinable())
+    {
+        return;
+    }
+
+    //a power of two so the ring index is a mask
+    size_t capacity = 1;
+    while (capacity < records_per_thread)
+    {
+        capacity <<= 1;
+    }
+    detail::s_async.records_per_thread = capacity;
+
+    detail::s_async.exit = false;
+    detail::s_async.thread = std::thread(&detail::async_thread_proc, thread_init);
+    detail::s_async.thread_id = detail::s_async.thread.get_id();
+    detail::s_is_async = true;
+}
+
+void q::logging::stop_async()
+{
+    detail::s_is_async = false;
+    {
+        std::lock_guard<std::mutex> lg(detail::s_async.mutex);
+        if (!detail::s_async.thread.joinable())
+        {
+            return;
+        }
+        detail::s_async.exit = true;
+        detail::s_async.cv.notify_all();
+    }
+    detail::s_async.thread.join();
+}
+
+void q::logging::flush()
+{
+    std::unique_lock<std::mutex> lock(detail::s_async.mutex);
+    if (!detail::s_async.thread.joinable() || std::this_thread::get_id() == detail::s_async.thread_id)
+    {
+        return;
+    }
+
+    uint64_t id = ++detail::s_async.flush_requested;
+    detail::s_async.cv.notify_all();
+    detail::s_async.flushed_cv.wait(lock, [id]() { return detail::s_async.flush_done >= id || detail::s_async.exit; });
+}
+
+auto q::logging::get_dropped_record_count() -> uint64_t
+{
+    return detail::s_async.dropped_count;
+}
+
+void q::logging::set_rate_limit(uint32_t logs_per_second)
+{
+    detail::s_rate_limit = logs_per_second;
+}
@@ -0,0 +1,140 @@
+#include "qbase.h"
+
+#include <iostream>
+
+// each test module could contain no more then one 'main' file with init function defined
+// alternatively you could define init function yourself
+#include <boost/test/unit_test.hpp>
+
+//____________________________________________________________________________//
+
+namespace
+{
+
+//counts the logs without printing them so the bench measures the logging, not the console
+class Null_Logger : public q::logging::Logger
+{
+public:
+    void log(q::logging::Level, std::string const&) override
+    {
+        count++;
+    }
+    size_t count = 0;
+};
+
+//the topic stack QLOG_TOPIC used to push on every scope, and the string topics it was keyed by
+static __thread std::vector<char const*>* s_legacy_topic_stack = nullptr;
+struct Legacy_Scoped_Topic
+{
+    Legacy_Scoped_Topic(char const* topic)
+    {
+        if (!s_legacy_topic_stack)
+        {
+            s_legacy_topic_stack = new std::vector<char const*>();
+        }
+        s_legacy_topic_stack->push_back(topic);
+    }
+    ~Legacy_Scoped_Topic()
+    {
+        s_legacy_topic_stack->pop_back();
+    }
+};
+
+//a process() that logs only when the samples are out of sync, like most nodes do
+__attribute__((noinline)) void legacy_process(int i, bool out_of_sync)
+{
+    Legacy_Scoped_Topic topic("bench_node::process");
+    if (out_of_sync)
+    {
+        q::logf(q::logging::Level::WARNING, __FILE__, __LINE__, "Samples out of sync: {} {}", i, 0.5f);
+    }
+}
+
+__attribute__((noinline)) void interned_process(int i, bool out_of_sync)
+{
+    QLOG_TOPIC("bench_node::process");
+    if (out_of_sync)
+    {
+        QLOGW("Samples out of sync: {} {}", i, 0.5f);
+    }
+}
+
+template<class F>
+double bench(char const* name, int count, F f)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; ++i)
+    {
+        f(i);
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / count;
+    std::cout << name << ": " << ns << "ns" << std::endl;
+    return ns;
+}
+
+}
+
+BOOST_AUTO_TEST_CASE(bench_log_topics)
+{
+#ifdef _DEBUG
+	const int count = 10000;
+#else
+	const int count = 1000000;
+#endif
+
+    Null_Logger* logger = new Null_Logger();
+    q::logging::set_logger(q::logging::Logger_uptr(logger));
+
+	std::cout << std::endl;
+
+    std::cout << "scope without a log" << std::endl;
+    double legacy_ns = bench("  string topic stack", count, [](int i) { legacy_process(i, false); });
+    double interned_ns = bench("  interned topic", count, [](int i) { interned_process(i, false); });
+    std::cout << "Speed-up: " << legacy_ns / interned_ns << std::endl << std::endl;
+
+    q::logging::set_level(q::logging::Level::ERR);
+
+    std::cout << "log below the level" << std::endl;
+    legacy_ns = bench("  string topic stack", count, [](int i) { legacy_process(i, true); });
+    interned_ns = bench("  interned topic", count, [](int i) { interned_process(i, true); });
+    std::cout << "Speed-up: " << legacy_ns / interned_ns << std::endl << std::endl;
+    BOOST_CHECK(logger->count == 0);
+
+    q::logging::set_level(q::logging::Level::DBG);
+    q::logging::set_topic_enabled("bench_node::process", false);
+
+    std::cout << "log in a disabled topic" << std::endl;
+    interned_ns = bench("  interned topic", count, [](int i) { interned_process(i, true); });
+    BOOST_CHECK(logger->count == 0);
+    std::cout << std::endl;
+
+    q::logging::set_topic_enabled("bench_node::process", true);
+
+    std::cout << "log enabled" << std::endl;
+    legacy_ns = bench("  string topic stack", count, [](int i) { legacy_process(i, true); });
+    interned_ns = bench("  interned topic", count, [](int i) { interned_process(i, true); });
+    std::cout << "Speed-up: " << legacy_ns / interned_ns << std::endl << std::endl;
+
+    //the ring is allocated with the first log of the thread, and it has to have room for all the logs of the bench
+    q::logging::start_async(4096);
+    interned_process(0, true);
+    q::logging::flush();
+    std::cout << "log enabled, async" << std::endl;
+    bench("  interned topic", 4000, [](int i) { interned_process(i, true); });
+    q::logging::flush();
+    //high enough to never skip, so this measures the check the FC pays on every log
+    q::logging::set_rate_limit(1000000);
+    bench("  interned topic, rate limited", 4000, [](int i) { interned_process(i, true); });
+    q::logging::flush();
+    q::logging::set_rate_limit(0);
+    q::logging::stop_async();
+    std::cout << std::endl;
+
+    BOOST_CHECK(logger->count > 0);
+
+    q::logging::set_logger(q::logging::Logger_uptr());
+}
+
+//____________________________________________________________________________//
+
+// EOF
@@ -0,0 +1,86 @@
+#include "qbase.h"
+#include "Profiler.h"
+
+#include <iostream>
+#include <fstream>
+
+// each test module could contain no more then one 'main' file with init function defined
+// alternatively you could define init function yourself
+#include <boost/test/unit_test.hpp>
+
+//____________________________________________________________________________//
+
+namespace
+{
+
+__attribute__((noinline)) void zone_process(int i, int& sum)
+{
+    q::profiler::Zone zone("bench::zone_process");
+    sum += i;
+}
+
+template<class F>
+double bench(char const* name, int count, F f)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; ++i)
+    {
+        f(i);
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / count;
+    std::cout << name << ": " << ns << "ns" << std::endl;
+    return ns;
+}
+
+}
+
+BOOST_AUTO_TEST_CASE(bench_profiler_zones)
+{
+#ifdef _DEBUG
+	const int count = 10000;
+#else
+	const int count = 1000000;
+#endif
+
+	std::cout << std::endl;
+
+    int sum = 0;
+    double empty_ns = bench("no zone", count, [&sum](int i) { sum += i; });
+    bench("timestamp", count, [&sum](int) { sum += static_cast<int>(q::profiler::detail::get_ticks()); });
+    double stopped_ns = bench("zone, profiler stopped", count, [&sum](int i) { zone_process(i, sum); });
+
+    //no trace so the profiler thread doesn't compete for the cpu with the json formatting.
+    //fewer zones so the ring stays in the cache, like it does with the zones of a frame
+    q::profiler::Settings settings;
+    settings.events_per_thread = count / 10;
+    BOOST_REQUIRE(q::profiler::start(settings));
+    zone_process(0, sum); //the ring is allocated with the first event of the thread
+    double running_ns = bench("zone, profiler running", count / 10, [&sum](int i) { zone_process(i, sum); });
+    q::profiler::stop();
+
+    std::cout << "Zone overhead: " << running_ns - empty_ns << "ns, " << stopped_ns - empty_ns << "ns stopped" << std::endl;
+    std::cout << std::endl;
+
+    std::string const trace_path = "bench_profiler.json";
+    settings.trace_path = trace_path;
+    BOOST_REQUIRE(q::profiler::start(settings));
+    bench("zone, profiler running with a trace", count / 10, [&sum](int i) { zone_process(i, sum); });
+    q::profiler::counter("bench::sum", sum);
+    q::profiler::frame("bench::frame");
+    q::profiler::stop();
+    std::cout << std::endl;
+
+    BOOST_CHECK(q::profiler::get_dropped_event_count() == 0);
+
+    std::ifstream fs(trace_path);
+    std::string trace((std::istreambuf_iterator<char>(fs)), std::istreambuf_iterator<char>());
+    BOOST_CHECK(trace.find("\"bench::zone_process\",\"ph\":\"X\"") != std::string::npos);
+    BOOST_CHECK(trace.find("\"bench::sum\",\"ph\":\"C\"") != std::string::npos);
+    BOOST_CHECK(trace.find("\"thread_name\"") != std::string::npos);
+    BOOST_CHECK(trace.size() > 2 && trace.substr(trace.size() - 3) == "]}\n");
+    std::remove(trace_path.c_str());
+}
+
+//____________________________________________________________________________//
+
+// EOF
@@ -22,7 +22,7 @@ T max(T v, T max)
 }
 std::string const& get_ast_json()
 {
-  static const std::string s_json = R"xxx({"type":1,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int8_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":-128}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":127}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"int8_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":255}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int16_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":-32768}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":32767}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"int16_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint16_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":65535}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint16_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int32_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":-2147483648}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":2147483647}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"int32_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":4294967295}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"muf_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"direction_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vec3f"}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"euler_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":-180.000000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":180.000000}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"euler3_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vec3f"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":19,"children":[{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":-180.000000}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":-180.000000}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":-180.000000}]}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":19,"children":[{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":180.000000}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":180.000000}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":180.000000}]}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"servo_signal_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":2.000000}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"pwm_signal_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IUAV_Descriptor"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"UAV Descriptor"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"name"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Name"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Comms"}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"channel_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":11}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"channel_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"channel"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"tx_power_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":20.500000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"tx_power_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"tx_power"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":20.500000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"TX Power"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Quality"}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"mtu_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":128}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1360}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"mtu_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"mtu"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1360}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"MTU"}]}]}]}]},{"type":15,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":16,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"B_1M_CCK"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11b 1Mbps CCK"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"B_2M_CCK"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11b 2Mbps CCK"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"B_2M_CCK_SHORT_PREAMBLE"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11b 2Mbps Short Preamble CCK"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"B_5_5M_CCK"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11b 5.5Mbps CCK"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"B_5_5M_CCK_SHORT_PREAMBLE"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11b 5.5Mbps Short Preamble CCK"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"B_11M_CCK"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11b 11Mbps CCK"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"B_11M_CCK_SHORT_PREAMBLE"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11b 11Mbps Short Preamble CCK"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"G_6M_ODFM"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11g 6Mbps ODFM"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"G_9M_ODFM"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11g 9Mbps ODFM"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"G_12M_ODFM"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11g 12Mbps ODFM"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"G_18M_ODFM"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11g 18Mbps ODFM"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"G_24M_ODFM"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11g 24Mbps ODFM"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"G_36M_ODFM"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11g 36Mbps ODFM"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"G_48M_ODFM"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11g 48Mbps ODFM"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"G_54M_ODFM"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11g 56Mbps ODFM"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t::B_11M_CCK"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"fec_k_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":16}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"fec_n_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":32}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"fec_k_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"fec_k"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":12}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"FEC K"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"fec_n_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"fec_n"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":20}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"FEC N"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Quality"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"low"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Low Quality Streaming"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Quality"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"high"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"High Quality Streaming"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Comms"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"comms"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Comms"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"mass_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.010000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":100.000000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"mass_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"mass"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Mass"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Kg"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"moment_of_inertia"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Moment Of Inertia"}]}]}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Poly_IUAV_Descriptor"}]},{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IUAV_Descriptor"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IBus_Descriptor"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bus Descriptor"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Poly_IBus_Descriptor"}]},{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IBus_Descriptor"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Node Descriptor"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Poly_INode_Descriptor"}]},{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Node Config"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Poly_INode_Config"}]},{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Settings"}]},{"type":14,"children":[{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Bus_Data"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"name"}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"type"}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"attributes":[{"name":"const","type":1,"value":true}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IBus_Descriptor"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"descriptor"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Node_Data"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"name"}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"type"}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"attributes":[{"name":"const","type":1,"value":true}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"descriptor"}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"attributes":[{"name":"const","type":1,"value":true}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"config"}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"input_paths"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"attributes":[{"name":"const","type":1,"value":true}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IUAV_Descriptor"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"uav_descriptor"}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Bus_Data"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"buses"}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Node_Data"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"nodes"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IUAV_Descriptor"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Multirotor Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"height_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.010000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":100.000000}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"radius_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.010000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":100.000000}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"torque_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.010000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1000.000000}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"thrust_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.010000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1000.000000}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.100000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"radius_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"radius"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Radius"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"height_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"height"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Height"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"torque_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"motor_z_torque"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Motor Z Torque"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Nm"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"thrust_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"motor_thrust"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Motor Thrust"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"N"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"motor_acceleration"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":10.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Motor acceleration"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"N/s"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"motor_deceleration"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":10.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Motor Deceleration"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"N/s"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Tri_Multirotor_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Descriptor"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Tri Multirotor Descriptor"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Quad_Multirotor_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Descriptor"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Quad Multirotor Descriptor"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"plus_configuration"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"+ Configuration"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Hexa_Multirotor_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Descriptor"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hexa Multirotor Descriptor"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"plus_configuration"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"+ Configuration"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Hexatri_Multirotor_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Descriptor"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hexatri Multirotor Descriptor"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Octo_Multirotor_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Descriptor"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Octo Multirotor Descriptor"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"plus_configuration"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"+ Configuration"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Octaquad_Multirotor_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Descriptor"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Octoquad Multirotor Descriptor"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"plus_configuration"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"+ Configuration"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Custom_Multirotor_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Descriptor"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Custom Multirotor Descriptor"}]}]}]},{"type":14,"children":[{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Motor"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vec3f"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"position"}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"direction_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"thrust_vector"}]},{"type":19,"children":[{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"clockwise"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Motor"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"motors"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"UART_Linux_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IBus_Descriptor"}]}]}]},{"type":14,"children":[{"type":15,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"baud_t"}]},{"type":16,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"_9600"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"9600"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_19200"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"19200"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_38400"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"38400"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_57600"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"57600"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_115200"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"115200"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_230400"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"230400"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"dev"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"/dev/ttyAMA0"}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"baud_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"baud"}]},{"type":20,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"baud_t::_115200"}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"UART_BB_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IBus_Descriptor"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rx_pin"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"baud"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":115200}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"invert"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"I2C_BCM_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IBus_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"dev_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"baud_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1000000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"dev_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"dev"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"baud_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"baud"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":400000}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"I2C_Linux_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IBus_Descriptor"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"dev"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"/dev/i2c0"}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"SPI_BCM_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IBus_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"dev_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"mode_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":3}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"dev_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"dev"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"baud"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1000000}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"mode_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"mode"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"speed"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1000000}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"SPI_Linux_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IBus_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"dev"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"/dev/ttyAMA0"}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"speed"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1000000}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"P_Controller_Descriptor"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"kp"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"kP"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PI_Controller_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"P_Controller_Descriptor"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"ki"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"kI"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_i"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max I"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PD_Controller_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"P_Controller_Descriptor"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"kd"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"kD"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"muf_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"d_filter"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"D Filter"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PID_Controller_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PD_Controller_Descriptor"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"ki"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"kI"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_i"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max I"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ADC_Ammeter_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ADC_Ammeter_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"scale"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Scale"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bias"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bias"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ADC_Voltmeter_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ADC_Voltmeter_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"scale"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Scale"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bias"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bias"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ADS1115_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":400}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":127}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"hex"}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bus"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bus"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":72},{"name":"hex","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"I2C Address"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ADC"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"is_enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Enabled"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":200}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ADC"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"adc0"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ADC0"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ADC"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"adc1"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ADC1"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ADC"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"adc2"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ADC2"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ADC"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"adc3"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ADC3"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ADS1115_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"AVRADC_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":500}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":127}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"hex"}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bus"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bus"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":23},{"name":"hex","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"I2C Address"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":200}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"AVRADC_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Comp_AHRS_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":200}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Comp_AHRS_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"muf_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"drift_correction_factor"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.300000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Drift Correction Factor"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Combiner_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":200}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Combiner_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Gravity_Filter_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Gravity_Filter_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"KF_ECEF_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"KF_ECEF_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gps_position_lag"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPS Position Lag"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"s"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gps_position_accuracy"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":2.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPS Position Accuracy"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m CEP"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gps_velocity_lag"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPS Velocity Lag"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"s"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gps_velocity_accuracy"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.200000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPS Velocity Accuracy"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m/s"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_lag"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Acceleration Lag"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"s"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_accuracy"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":2.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Acceleration Accuracy"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"(m/s^2)"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ENU_Frame_System_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ENU_Frame_System_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"LPF_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"LPF_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poles_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":6}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poles_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"poles"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"LPF Poles"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"cutoff_frequency"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"LPF Cutoff Frequency"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"MaxSonar_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":15}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bus"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bus"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"MaxSonar_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"direction_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"direction"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Direction"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_distance"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":10.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Maximum Distance"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"min_distance"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.200000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Minimum Distance"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Motor_Mixer_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Motor_Mixer_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"armed_thrust"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Armed Thrust"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"N"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Quad_Multirotor_Motor_Mixer_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Quad_Multirotor_Motor_Mixer_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"muf_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"armed_min_throttle"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.100000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Armed Min Throttle"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Acceleration_Calibration_Point"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"temperature"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Temperature"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"°C"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vec3f"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bias"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bias"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vec3f"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"scale"}]},{"type":19,"children":[{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Scale"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Angular_Velocity_Calibration_Point"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"temperature"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Temperature"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"°C"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vec3f"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bias"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bias"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Magnetic_Field_Calibration_Point"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"temperature"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Temperature"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"°C"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vec3f"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bias"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bias"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vec3f"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"scale"}]},{"type":19,"children":[{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Scale"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"MPU9250_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":127}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"hex"}]}]}]},{"type":15,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"imu_rate_t"}]},{"type":16,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"_250"},{"name":"integral_value","type":2,"value":250}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"250 Hz"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_500"},{"name":"integral_value","type":2,"value":500}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"500 Hz"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_1000"},{"name":"integral_value","type":2,"value":1000}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"1000 Hz"}]}]}]}]}]}]},{"type":15,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_range_t"}]},{"type":16,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"_2"},{"name":"integral_value","type":2,"value":2}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"2 G"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_4"},{"name":"integral_value","type":2,"value":4}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"4 G"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_8"},{"name":"integral_value","type":2,"value":8}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"8 G"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_16"},{"name":"integral_value","type":2,"value":16}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"16 G"}]}]}]}]}]}]},{"type":15,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"angular_velocity_range_t"}]},{"type":16,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"_250"},{"name":"integral_value","type":2,"value":250}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"250 DPS"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_500"},{"name":"integral_value","type":2,"value":500}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"500 DPS"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_1000"},{"name":"integral_value","type":2,"value":1000}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"1000 DPS"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_2000"},{"name":"integral_value","type":2,"value":2000}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"2000 DPS"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bus"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bus"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":105},{"name":"hex","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"I2C Address"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"imu_rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"imu_rate"}]},{"type":20,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"imu_rate_t::_1000"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"IMU Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"magnetometer_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Magnetometer Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"thermometer_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Thermometer Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_range_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_range"}]},{"type":20,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_range_t::_8"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Acceleration Range"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"angular_velocity_range_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"angular_velocity_range"}]},{"type":20,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"angular_velocity_range_t::_500"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Angular Velocity Range"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"MPU9250_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Calibration"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Acceleration_Calibration_Point"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Acceleration"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Angular_Velocity_Calibration_Point"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"angular_velocity"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Angular Velocity"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Magnetic_Field_Calibration_Point"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"magnetic_field"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Magnetic Field"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"euler3_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rotation"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rotation"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"°"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Calibration"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"calibration"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Calibration"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"MS5611_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":127}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"hex"}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bus"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bus"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":119},{"name":"hex","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"I2C Address"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"pressure_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Pressure Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"temperature_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Temperature Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"MS5611_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"UltimateSensorFusion_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_divisor_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":127}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"hex"}]}]}]},{"type":15,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"imu_rate_t"}]},{"type":16,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"_250"},{"name":"integral_value","type":2,"value":250}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"250 Hz"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_400"},{"name":"integral_value","type":2,"value":400}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"400 Hz"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_500"},{"name":"integral_value","type":2,"value":500}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"500 Hz"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_1000"},{"name":"integral_value","type":2,"value":1000}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"1000 Hz"}]}]}]}]}]}]},{"type":15,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_range_t"}]},{"type":16,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"_2"},{"name":"integral_value","type":2,"value":2}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"2 G"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_4"},{"name":"integral_value","type":2,"value":4}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"4 G"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_8"},{"name":"integral_value","type":2,"value":8}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"8 G"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_16"},{"name":"integral_value","type":2,"value":16}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"16 G"}]}]}]}]}]}]},{"type":15,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"angular_velocity_range_t"}]},{"type":16,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"_250"},{"name":"integral_value","type":2,"value":250}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"250 DPS"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_500"},{"name":"integral_value","type":2,"value":500}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"500 DPS"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_1000"},{"name":"integral_value","type":2,"value":1000}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"1000 DPS"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_2000"},{"name":"integral_value","type":2,"value":2000}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"2000 DPS"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bus"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bus"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":40},{"name":"hex","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"I2C Address"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"imu_rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"imu_rate"}]},{"type":20,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"imu_rate_t::_1000"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"IMU Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"magnetometer_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Magnetometer Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"barometer_thermometer_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Barometer/Thermometer Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_range_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_range"}]},{"type":20,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_range_t::_8"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Acceleration Range"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"angular_velocity_range_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"angular_velocity_range"}]},{"type":20,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"angular_velocity_range_t::_500"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Angular Velocity Range"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_divisor_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"frame_rate_divisor"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Frame Processing Rate Divisor"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_divisor_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"imu_output_rate_divisor"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"IMU Output Rate Divisor"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_output_enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Acceleration Output Enabled"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"angular_velocity_output_enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Angular Velocity Output Enabled"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"magnetic_field_output_enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Magnetic Field Output Enabled"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"frame_output_enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Frame Output Enabled"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"pressure_output_enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Pressure Output Enabled"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"temperature_output_enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Temperature Output Enabled"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"UltimateSensorFusion_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"euler3_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rotation"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rotation"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"°"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Brain_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"commands_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":30}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Commands Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"state_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":30}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"State Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Brain_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Horizontal"}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_deg_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":10.000000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":3000.000000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_deg_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_rate_deg"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":180.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"°/s"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Combined_Angle_PIDs"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PID_Controller_Descriptor"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Combined"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Separate_Angle_PIDs"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Separate"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PID_Controller_Descriptor"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"x_pid"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"X"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PID_Controller_Descriptor"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"y_pid"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Y"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"variant"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Combined_Angle_PIDs"}]}]}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Separate_Angle_PIDs"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"angle_pids"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Angle PIDs"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max_angle_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vec2f"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":19,"children":[{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":-90.000000}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":-90.000000}]}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":19,"children":[{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":90.000000}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":90.000000}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max_angle_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_angle_deg"}]},{"type":19,"children":[{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":60.000000}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":60.000000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max Angle"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"°"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":10.000000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_speed"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":2.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max Speed"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m/s"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"LPF_Config"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"position_lpf"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Position LPF"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PI_Controller_Descriptor"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"velocity_pid"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Velocity PID"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"P_Controller_Descriptor"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"position_pid"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Position PID"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Yaw"}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_deg_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":10.000000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":3000.000000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_deg_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_rate_deg"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":180.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"°/s"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PID_Controller_Descriptor"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"angle_pid"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Angle PID"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Vertical"}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":10.000000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_speed"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":2.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max Speed"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m/s"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"LPF_Config"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"altitude_lpf"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Altitude LPF"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PI_Controller_Descriptor"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_pid"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Speed PID"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"P_Controller_Descriptor"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"altitude_pid"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Altitude PID"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_allowed_position_variation"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":10.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max Allowed Position Variation"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_thrust"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":2.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max Thrust"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"N"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"min_thrust"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Min Thrust"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"N"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Vertical"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"vertical"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Vertical"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Horizontal"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"horizontal"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Horizontal"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Yaw"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"yaw"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Yaw"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Pilot_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"commands_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":30}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Commands Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"state_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":30}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"State Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"video_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":30}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Video Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Pilot_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Simulator_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"throttle_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Throttle Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"state_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":30}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"State Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Acceleration Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"angular_velocity_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Angular Velocity Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"magnetic_field_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Magnetic Field Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"pressure_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Pressure Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"temperature_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Temperature Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"distance_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":12}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Distance Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gps_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":5}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPS Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Simulator_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Noise"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gps_position"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":2.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPS Position"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gps_velocity"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.200000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPS Velocity"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gps_pacc"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.500000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPS PACC"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gps_vacc"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.100000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPS VACC"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.010000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Acceleration"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"angular_velocity"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.010000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Angular Velocity"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"magnetic_field"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.100000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Magnetic Field"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"pressure"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.100000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Pressure"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"temperature"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.100000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Temperature"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"ground_distance"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.010000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Ground Distance"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"simulation_enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Simulation Enabled"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"drag_enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Drag Enabled"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"ground_enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Ground Enabled"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gravity_enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Gravity Enabled"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Noise"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"noise"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Noise"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Calibration"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Acceleration_Calibration_Point"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Acceleration"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Angular_Velocity_Calibration_Point"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"angular_velocity"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Angular Velocity"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Magnetic_Field_Calibration_Point"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"magnetic_field"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Magnetic Field"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Calibration"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"calibration"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Calibration"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Oscillator_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"component_count_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":32}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":30}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"component_count_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"component_count"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Components"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Oscillator_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Component"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"frequency"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Frequency"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"amplitude"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Amplitude"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"square"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Square"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"amplitude"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Amplitude"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"noise"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Noise"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Component"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"components"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Components"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PCA9685_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":8000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":127}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"hex"}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bus"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bus"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":30}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"address"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":64},{"name":"hex","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Address"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Enabled"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"servo_signal"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Servo Signal"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"channels"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Channels"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PCA9685_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Servo_Channel"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"servo_signal_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Min"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ms"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"servo_signal_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":2.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ms"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PWM_Channel"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"pwm_signal_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Min"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"pwm_signal_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"channels"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Channels"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PIGPIO_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":8000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Enabled"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"servo_signal"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Servo Signal"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":400}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_2"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 2"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_3"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 3"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_4"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 4"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_5"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 5"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_6"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 6"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_7"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 7"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_8"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 8"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_9"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 9"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_10"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 10"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_11"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 11"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_12"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 12"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_13"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 13"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_14"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 14"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_15"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 15"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_16"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 16"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_17"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 17"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_18"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 18"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_19"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 19"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_20"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 20"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_21"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 21"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_22"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 22"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_23"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 23"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_24"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 24"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_25"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 25"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_26"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 26"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_27"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 27"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PIGPIO_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Servo_Channel"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"servo_signal_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Min"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ms"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"servo_signal_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":2.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ms"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PWM_Channel"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"pwm_signal_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Min"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"pwm_signal_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_2"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 2"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_3"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 3"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_4"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 4"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_5"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 5"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_6"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 6"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_7"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 7"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_8"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 8"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_9"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 9"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_10"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 10"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_11"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 11"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_12"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 12"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_13"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 13"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_14"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 14"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_15"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 15"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_16"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 16"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_17"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 17"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_18"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 18"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_19"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 19"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_20"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 20"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_21"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 21"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_22"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 22"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_23"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 23"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_24"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 24"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_25"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 25"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_26"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 26"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_27"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 27"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Pressure_Velocity_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Pressure_Velocity_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Proximity_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"channel_count_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":128}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"channel_count_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"channel_count"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Channel Count"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Proximity_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Rate_Controller_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Rate_Controller_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Feedback"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"muf_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"weight"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Weight"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Combined_XY_PIDs"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PID_Controller_Descriptor"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Combined"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Separate_XY_PIDs"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Separate"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PID_Controller_Descriptor"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"x_pid"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"X"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PID_Controller_Descriptor"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"y_pid"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Y"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"variant"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Combined_XY_PIDs"}]}]}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Separate_XY_PIDs"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"xy_pids"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"XY PIDs"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PID_Controller_Descriptor"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"z_pid"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Z PID"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Feedforward"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"muf_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"weight"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Weight"}]}]}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"torque_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.010000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"torque_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_torque"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max Torque"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"N"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Feedback"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"feedback"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Feedback"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Feedforward"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"feedforward"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Feedforward"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Raspicam_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Quality"}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"resolution_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vec2i"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":19,"children":[{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":8}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":8}]}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":19,"children":[{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1980}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1080}]}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bitrate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":32000000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"resolution_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"resolution"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Resolution"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bitrate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bitrate"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bitrate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"bps"}]}]}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"fps_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":120}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"fps_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"fps"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"FPS"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"iframe_interval_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"iframe_interval_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"iframe_interval"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":30}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"IFrame Interval"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"commands_rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":30}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"commands_rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"commands_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Commands Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Quality"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"streaming_low"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Streaming Low"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Quality"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"streaming_high"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Streaming High"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Quality"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"recording"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Recording"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Raspicam_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"iso_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1600}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"shutter_speed_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1000.000000}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ev_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":-10}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"sharpness_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"contrast_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"brightness_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"saturation_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]}]}]},{"type":15,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"awb_mode_t"}]},{"type":16,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"OFF"},{"name":"integral_value","type":2,"value":0}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Off"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"AUTO"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Auto"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"SUNLIGHT"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Sunlight"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"CLOUDY"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Cloudy"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"SHADE"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Shade"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"TUNGSTEN"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Tungsten"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"FLUORESCENT"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Flourescent"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"INCANDESCENT"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Incandescent"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"FLASH"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Flash"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"HORIZON"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Horizon"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"iso_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"iso"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Iso"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"shutter_speed_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"shutter_speed"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Shutter Speed"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ms"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ev_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"ev"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Exposure Compensation"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"sharpness_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"sharpness"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":50}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Sharpness"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"contrast_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"contrast"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":50}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Contrast"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"brightness_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"brightness"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":50}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Brightness"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"saturation_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"saturation"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":50}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Saturation"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"awb_mode_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"awb_mode"}]},{"type":20,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"awb_mode_t::AUTO"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"AWB Mode"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"hflip"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Horizontal Flip"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"vflip"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Vertical Flip"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"RC5T619_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":200}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bus"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bus"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"adc0_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":50}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ADC0 Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"adc1_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":5}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ADC1 Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"RC5T619_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Resampler_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"input_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Input Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"output_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Output Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Resampler_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"LPF_Config"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"lpf"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"LPF"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Scalar_Generator_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Scalar_Generator_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"value"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Value"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Servo_Gimbal_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"commands_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Commands Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Servo_Gimbal_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"euler_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"min_angle"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":-180.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Min Angle"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"°"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"euler_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_angle"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":180.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max Angle"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"°"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"pwm_signal_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"min_pwm"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max PWM"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"pwm_signal_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_pwm"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max PWM"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"x_channel"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"X Channel"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"y_channel"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Y Channel"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"z_channel"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Z Channel"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"SRF01_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bus"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bus"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"SRF01_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"direction_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"direction"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Direction"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_distance"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":6.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Maximum Distance"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"min_distance"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.200000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Minimum Distance"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"SRF02_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bus"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bus"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"SRF02_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"direction_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"direction"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Direction"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_distance"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":6.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Maximum Distance"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"min_distance"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.200000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Minimum Distance"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Throttle_To_PWM_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"channel_count_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":128}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"channel_count_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"channel_count"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Channel Count"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Throttle_To_PWM_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Transformer_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Transformer_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"UBLOX_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bus"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bus"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"UBLOX_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Vec3_Generator_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Vec3_Generator_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vec3f"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"value"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Value"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"CPPM_Receiver_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":15,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_t"}]},{"type":16,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"_2"},{"name":"integral_value","type":2,"value":2}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"2"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_3"},{"name":"integral_value","type":2,"value":3}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"3"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_4"},{"name":"integral_value","type":2,"value":4}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"4"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_5"},{"name":"integral_value","type":2,"value":5}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"5"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_6"},{"name":"integral_value","type":2,"value":6}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"6"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_7"},{"name":"integral_value","type":2,"value":7}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"7"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_8"},{"name":"integral_value","type":2,"value":8}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"8"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_9"},{"name":"integral_value","type":2,"value":9}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"9"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_10"},{"name":"integral_value","type":2,"value":10}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"10"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_11"},{"name":"integral_value","type":2,"value":11}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_12"},{"name":"integral_value","type":2,"value":12}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"12"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_13"},{"name":"integral_value","type":2,"value":13}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"13"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_14"},{"name":"integral_value","type":2,"value":14}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"14"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_15"},{"name":"integral_value","type":2,"value":15}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"15"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_16"},{"name":"integral_value","type":2,"value":16}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"16"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_17"},{"name":"integral_value","type":2,"value":17}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"17"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_18"},{"name":"integral_value","type":2,"value":18}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"18"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_19"},{"name":"integral_value","type":2,"value":19}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"19"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_20"},{"name":"integral_value","type":2,"value":20}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"20"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_21"},{"name":"integral_value","type":2,"value":21}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"21"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_22"},{"name":"integral_value","type":2,"value":22}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"22"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_23"},{"name":"integral_value","type":2,"value":23}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"23"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_24"},{"name":"integral_value","type":2,"value":24}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"24"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_25"},{"name":"integral_value","type":2,"value":25}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"25"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_26"},{"name":"integral_value","type":2,"value":26}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"26"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_27"},{"name":"integral_value","type":2,"value":27}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"27"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio"}]},{"type":20,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_t::_26"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"CPPM GPIO"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"channel_count_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":16}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"channel_count_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"channel_count"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":8}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Channels"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":50}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"CPPM_Receiver_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"inverted"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Inverted Signal"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"frame_length"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":27.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Frame Length"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ms"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gap_pulse_length"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.400000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Gap Pulse Length"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ms"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"min_pulse_length"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.600000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Min Pulse Length"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ms"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_pulse_length"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.600000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max Pulse Length"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ms"}]}]}]}]}]}]}]})xxx";
+  static const std::string s_json = R"xxx({"type":1,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int8_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":-128}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":127}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"int8_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":255}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int16_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":-32768}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":32767}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"int16_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint16_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":65535}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint16_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int32_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":-2147483648}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":2147483647}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"int32_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":4294967295}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"muf_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"direction_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vec3f"}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"euler_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":-180.000000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":180.000000}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"euler3_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vec3f"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":19,"children":[{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":-180.000000}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":-180.000000}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":-180.000000}]}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":19,"children":[{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":180.000000}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":180.000000}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":180.000000}]}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"servo_signal_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":2.000000}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"pwm_signal_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IUAV_Descriptor"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"UAV Descriptor"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"name"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Name"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Comms"}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"channel_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":11}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"channel_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"channel"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"tx_power_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":20.500000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"tx_power_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"tx_power"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":20.500000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"TX Power"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Quality"}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"mtu_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":128}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1360}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"mtu_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"mtu"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1360}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"MTU"}]}]}]}]},{"type":15,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":16,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"B_1M_CCK"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11b 1Mbps CCK"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"B_2M_CCK"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11b 2Mbps CCK"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"B_2M_CCK_SHORT_PREAMBLE"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11b 2Mbps Short Preamble CCK"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"B_5_5M_CCK"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11b 5.5Mbps CCK"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"B_5_5M_CCK_SHORT_PREAMBLE"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11b 5.5Mbps Short Preamble CCK"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"B_11M_CCK"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11b 11Mbps CCK"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"B_11M_CCK_SHORT_PREAMBLE"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11b 11Mbps Short Preamble CCK"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"G_6M_ODFM"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11g 6Mbps ODFM"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"G_9M_ODFM"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11g 9Mbps ODFM"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"G_12M_ODFM"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11g 12Mbps ODFM"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"G_18M_ODFM"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11g 18Mbps ODFM"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"G_24M_ODFM"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11g 24Mbps ODFM"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"G_36M_ODFM"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11g 36Mbps ODFM"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"G_48M_ODFM"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11g 48Mbps ODFM"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"G_54M_ODFM"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11g 56Mbps ODFM"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t::B_11M_CCK"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"fec_k_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":16}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"fec_n_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":32}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"fec_k_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"fec_k"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":12}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"FEC K"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"fec_n_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"fec_n"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":20}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"FEC N"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Quality"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"low"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Low Quality Streaming"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Quality"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"high"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"High Quality Streaming"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Comms"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"comms"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Comms"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"mass_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.010000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":100.000000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"mass_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"mass"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Mass"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Kg"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"moment_of_inertia"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Moment Of Inertia"}]}]}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Poly_IUAV_Descriptor"}]},{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IUAV_Descriptor"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IBus_Descriptor"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bus Descriptor"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Poly_IBus_Descriptor"}]},{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IBus_Descriptor"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Node Descriptor"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Poly_INode_Descriptor"}]},{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Node Config"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Poly_INode_Config"}]},{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Settings"}]},{"type":14,"children":[{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Bus_Data"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"name"}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"type"}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"attributes":[{"name":"const","type":1,"value":true}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IBus_Descriptor"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"descriptor"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Node_Data"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"name"}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"type"}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"attributes":[{"name":"const","type":1,"value":true}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"descriptor"}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"attributes":[{"name":"const","type":1,"value":true}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"config"}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"input_paths"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Frame_Trace"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"is_enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Enabled"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"deadline_us"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Deadline (us)"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Real_Time"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"is_strict"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Strict"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"warmup_ms"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":5000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Warmup (ms)"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Thread_Profile"}]},{"type":14,"children":[{"type":15,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"policy_t"}]},{"type":16,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"OTHER"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Other"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"BATCH"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Batch"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"IDLE"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Idle"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"FIFO"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"FIFO"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"RR"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Round Robin"}]}]}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"priority_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":99}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"name"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Name"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"policy_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"policy"}]},{"type":20,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"policy_t::OTHER"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Policy"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"priority_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"priority"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Priority"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"cpus"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"CPUs"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Threads"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"lock_memory"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Lock Memory"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Thread_Profile"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"profiles"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Profiles"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Profiler"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"is_enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Enabled"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"write_trace"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Write Trace"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"summary_period_ms"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Summary Period (ms)"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"attributes":[{"name":"const","type":1,"value":true}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IUAV_Descriptor"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"uav_descriptor"}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Bus_Data"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"buses"}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Node_Data"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"nodes"}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Frame_Trace"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"frame_trace"}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Real_Time"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"real_time"}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Threads"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"threads"}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Profiler"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"profiler"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IUAV_Descriptor"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Multirotor Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"height_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.010000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":100.000000}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"radius_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.010000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":100.000000}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"torque_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.010000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1000.000000}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"thrust_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.010000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1000.000000}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.100000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"radius_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"radius"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Radius"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"height_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"height"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Height"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"torque_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"motor_z_torque"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Motor Z Torque"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Nm"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"thrust_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"motor_thrust"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Motor Thrust"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"N"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"motor_acceleration"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":10.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Motor acceleration"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"N/s"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"motor_deceleration"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":10.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Motor Deceleration"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"N/s"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Tri_Multirotor_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Descriptor"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Tri Multirotor Descriptor"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Quad_Multirotor_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Descriptor"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Quad Multirotor Descriptor"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"plus_configuration"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"+ Configuration"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Hexa_Multirotor_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Descriptor"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hexa Multirotor Descriptor"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"plus_configuration"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"+ Configuration"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Hexatri_Multirotor_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Descriptor"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hexatri Multirotor Descriptor"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Octo_Multirotor_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Descriptor"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Octo Multirotor Descriptor"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"plus_configuration"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"+ Configuration"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Octaquad_Multirotor_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Descriptor"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Octoquad Multirotor Descriptor"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"plus_configuration"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"+ Configuration"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Custom_Multirotor_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Descriptor"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Custom Multirotor Descriptor"}]}]}]},{"type":14,"children":[{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Motor"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vec3f"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"position"}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"direction_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"thrust_vector"}]},{"type":19,"children":[{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"clockwise"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Motor"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"motors"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"UART_Linux_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IBus_Descriptor"}]}]}]},{"type":14,"children":[{"type":15,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"baud_t"}]},{"type":16,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"_9600"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"9600"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_19200"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"19200"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_38400"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"38400"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_57600"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"57600"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_115200"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"115200"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_230400"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"230400"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"dev"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"/dev/ttyAMA0"}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"baud_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"baud"}]},{"type":20,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"baud_t::_115200"}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"UART_BB_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IBus_Descriptor"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rx_pin"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"baud"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":115200}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"invert"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"I2C_BCM_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IBus_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"dev_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"baud_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1000000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"dev_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"dev"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"baud_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"baud"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":400000}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"I2C_Linux_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IBus_Descriptor"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"dev"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"/dev/i2c0"}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"SPI_BCM_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IBus_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"dev_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"mode_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":3}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"dev_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"dev"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"baud"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1000000}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"mode_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"mode"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"speed"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1000000}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"SPI_Linux_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IBus_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"dev"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"/dev/ttyAMA0"}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"speed"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1000000}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"P_Controller_Descriptor"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"kp"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"kP"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PI_Controller_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"P_Controller_Descriptor"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"ki"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"kI"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_i"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max I"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PD_Controller_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"P_Controller_Descriptor"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"kd"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"kD"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"muf_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"d_filter"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"D Filter"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PID_Controller_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PD_Controller_Descriptor"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"ki"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"kI"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_i"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max I"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ADC_Ammeter_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ADC_Ammeter_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"scale"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Scale"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bias"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bias"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ADC_Voltmeter_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ADC_Voltmeter_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"scale"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Scale"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bias"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bias"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ADS1115_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":400}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":127}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"hex"}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bus"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bus"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":72},{"name":"hex","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"I2C Address"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ADC"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"is_enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Enabled"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":200}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ADC"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"adc0"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ADC0"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ADC"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"adc1"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ADC1"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ADC"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"adc2"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ADC2"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ADC"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"adc3"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ADC3"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ADS1115_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"AVRADC_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":500}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":127}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"hex"}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bus"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bus"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":23},{"name":"hex","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"I2C Address"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":200}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"AVRADC_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Comp_AHRS_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":200}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Comp_AHRS_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":15,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"mode_t"}]},{"type":16,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"COMPLEMENTARY"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Complementary"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"MAHONY"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Mahony"}]}]}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"gain_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":100.000000}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"mode_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"mode"}]},{"type":20,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"mode_t::COMPLEMENTARY"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Mode"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"muf_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"drift_correction_factor"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.300000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Drift Correction Factor"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"gain_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"mahony_kp"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Mahony Kp"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"gain_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"mahony_ki"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.050000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Mahony Ki"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_gyro_bias"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.200000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max Gyro Bias"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"rad/s"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"magnetic_field_correction_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":50}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Magnetic Field Correction Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Combiner_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":200}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Combiner_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Gravity_Filter_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Gravity_Filter_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"KF_ECEF_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"KF_ECEF_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gps_position_lag"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPS Position Lag"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"s"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gps_position_accuracy"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":2.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPS Position Accuracy"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m CEP"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gps_velocity_lag"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPS Velocity Lag"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"s"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gps_velocity_accuracy"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.200000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPS Velocity Accuracy"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m/s"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_lag"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Acceleration Lag"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"s"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_accuracy"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":2.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Acceleration Accuracy"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"(m/s^2)"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ESKF_ECEF_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ESKF_ECEF_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gps_lag"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.100000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPS Lag"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"s"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gps_position_accuracy"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":2.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPS Position Accuracy"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gps_velocity_accuracy"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.200000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPS Velocity Accuracy"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m/s"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"baro_lag"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Baro Lag"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"s"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"baro_accuracy"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.500000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Baro Accuracy"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_accuracy"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":2.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Acceleration Accuracy"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"(m/s^2)"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ENU_Frame_System_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ENU_Frame_System_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"LPF_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"LPF_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poles_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":6}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poles_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"poles"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"LPF Poles"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"cutoff_frequency"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"LPF Cutoff Frequency"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Dynamic_Notch_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"notch_count_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":4}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"notch_count_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"notch_count"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":2}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Notch Count"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Dynamic_Notch_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"q_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.500000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":20.000000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"min_frequency"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":80.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Min Frequency"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_frequency"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":400.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max Frequency"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"q_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"q"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":4.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Notch Q"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"MaxSonar_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":15}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bus"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bus"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"MaxSonar_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"direction_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"direction"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Direction"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_distance"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":10.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Maximum Distance"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"min_distance"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.200000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Minimum Distance"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Motor_Mixer_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Motor_Mixer_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":15,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"mode_t"}]},{"type":16,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ITERATIVE"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Iterative"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"PSEUDO_INVERSE"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Pseudo Inverse"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"mode_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"mode"}]},{"type":20,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"mode_t::ITERATIVE"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Mode"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"armed_thrust"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Armed Thrust"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"N"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Quad_Multirotor_Motor_Mixer_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Quad_Multirotor_Motor_Mixer_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"muf_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"armed_min_throttle"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.100000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Armed Min Throttle"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Acceleration_Calibration_Point"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"temperature"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Temperature"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"°C"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vec3f"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bias"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bias"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vec3f"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"scale"}]},{"type":19,"children":[{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Scale"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Angular_Velocity_Calibration_Point"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"temperature"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Temperature"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"°C"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vec3f"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bias"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bias"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Magnetic_Field_Calibration_Point"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"temperature"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Temperature"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"°C"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vec3f"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bias"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bias"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vec3f"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"scale"}]},{"type":19,"children":[{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Scale"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"MPU9250_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":127}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"hex"}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int8_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":-1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":53}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"int8_t"}]}]}]}]},{"type":15,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"imu_rate_t"}]},{"type":16,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"_250"},{"name":"integral_value","type":2,"value":250}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"250 Hz"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_500"},{"name":"integral_value","type":2,"value":500}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"500 Hz"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_1000"},{"name":"integral_value","type":2,"value":1000}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"1000 Hz"}]}]}]}]}]}]},{"type":15,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_range_t"}]},{"type":16,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"_2"},{"name":"integral_value","type":2,"value":2}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"2 G"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_4"},{"name":"integral_value","type":2,"value":4}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"4 G"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_8"},{"name":"integral_value","type":2,"value":8}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"8 G"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_16"},{"name":"integral_value","type":2,"value":16}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"16 G"}]}]}]}]}]}]},{"type":15,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"angular_velocity_range_t"}]},{"type":16,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"_250"},{"name":"integral_value","type":2,"value":250}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"250 DPS"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_500"},{"name":"integral_value","type":2,"value":500}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"500 DPS"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_1000"},{"name":"integral_value","type":2,"value":1000}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"1000 DPS"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_2000"},{"name":"integral_value","type":2,"value":2000}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"2000 DPS"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bus"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bus"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":105},{"name":"hex","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"I2C Address"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"imu_rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"imu_rate"}]},{"type":20,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"imu_rate_t::_1000"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"IMU Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"magnetometer_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Magnetometer Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"thermometer_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Thermometer Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_range_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_range"}]},{"type":20,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_range_t::_8"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Acceleration Range"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"angular_velocity_range_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"angular_velocity_range"}]},{"type":20,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"angular_velocity_range_t::_500"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Angular Velocity Range"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"data_ready_gpio"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":-1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Data Ready GPIO"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"MPU9250_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Calibration"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Acceleration_Calibration_Point"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Acceleration"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Angular_Velocity_Calibration_Point"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"angular_velocity"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Angular Velocity"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Magnetic_Field_Calibration_Point"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"magnetic_field"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Magnetic Field"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"euler3_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rotation"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rotation"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"°"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Calibration"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"calibration"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Calibration"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"MS5611_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":127}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"hex"}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bus"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bus"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":119},{"name":"hex","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"I2C Address"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"pressure_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Pressure Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"temperature_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Temperature Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"MS5611_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"UltimateSensorFusion_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_divisor_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":127}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"hex"}]}]}]},{"type":15,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"imu_rate_t"}]},{"type":16,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"_250"},{"name":"integral_value","type":2,"value":250}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"250 Hz"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_400"},{"name":"integral_value","type":2,"value":400}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"400 Hz"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_500"},{"name":"integral_value","type":2,"value":500}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"500 Hz"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_1000"},{"name":"integral_value","type":2,"value":1000}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"1000 Hz"}]}]}]}]}]}]},{"type":15,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_range_t"}]},{"type":16,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"_2"},{"name":"integral_value","type":2,"value":2}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"2 G"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_4"},{"name":"integral_value","type":2,"value":4}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"4 G"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_8"},{"name":"integral_value","type":2,"value":8}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"8 G"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_16"},{"name":"integral_value","type":2,"value":16}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"16 G"}]}]}]}]}]}]},{"type":15,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"angular_velocity_range_t"}]},{"type":16,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"_250"},{"name":"integral_value","type":2,"value":250}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"250 DPS"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_500"},{"name":"integral_value","type":2,"value":500}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"500 DPS"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_1000"},{"name":"integral_value","type":2,"value":1000}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"1000 DPS"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_2000"},{"name":"integral_value","type":2,"value":2000}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"2000 DPS"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bus"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bus"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":40},{"name":"hex","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"I2C Address"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"imu_rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"imu_rate"}]},{"type":20,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"imu_rate_t::_1000"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"IMU Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"magnetometer_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Magnetometer Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"barometer_thermometer_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Barometer/Thermometer Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_range_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_range"}]},{"type":20,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_range_t::_8"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Acceleration Range"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"angular_velocity_range_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"angular_velocity_range"}]},{"type":20,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"angular_velocity_range_t::_500"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Angular Velocity Range"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_divisor_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"frame_rate_divisor"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Frame Processing Rate Divisor"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_divisor_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"imu_output_rate_divisor"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"IMU Output Rate Divisor"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_output_enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Acceleration Output Enabled"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"angular_velocity_output_enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Angular Velocity Output Enabled"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"magnetic_field_output_enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Magnetic Field Output Enabled"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"frame_output_enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Frame Output Enabled"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"pressure_output_enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Pressure Output Enabled"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"temperature_output_enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Temperature Output Enabled"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"UltimateSensorFusion_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"euler3_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rotation"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rotation"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"°"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Brain_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"commands_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":30}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Commands Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"state_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":30}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"State Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Brain_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Horizontal"}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_deg_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":10.000000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":3000.000000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_deg_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_rate_deg"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":180.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"°/s"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Combined_Angle_PIDs"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PID_Controller_Descriptor"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Combined"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Separate_Angle_PIDs"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Separate"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PID_Controller_Descriptor"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"x_pid"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"X"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PID_Controller_Descriptor"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"y_pid"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Y"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"variant"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Combined_Angle_PIDs"}]}]}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Separate_Angle_PIDs"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"angle_pids"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Angle PIDs"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max_angle_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vec2f"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":19,"children":[{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":-90.000000}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":-90.000000}]}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":19,"children":[{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":90.000000}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":90.000000}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max_angle_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_angle_deg"}]},{"type":19,"children":[{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":60.000000}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":60.000000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max Angle"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"°"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":10.000000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_speed"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":2.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max Speed"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m/s"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"LPF_Config"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"position_lpf"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Position LPF"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PI_Controller_Descriptor"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"velocity_pid"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Velocity PID"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"P_Controller_Descriptor"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"position_pid"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Position PID"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Yaw"}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_deg_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":10.000000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":3000.000000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_deg_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_rate_deg"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":180.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"°/s"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PID_Controller_Descriptor"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"angle_pid"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Angle PID"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Vertical"}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":10.000000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_speed"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":2.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max Speed"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m/s"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"LPF_Config"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"altitude_lpf"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Altitude LPF"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PI_Controller_Descriptor"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_pid"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Speed PID"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"P_Controller_Descriptor"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"altitude_pid"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Altitude PID"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_allowed_position_variation"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":10.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max Allowed Position Variation"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_thrust"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":2.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max Thrust"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"N"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"min_thrust"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Min Thrust"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"N"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Vertical"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"vertical"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Vertical"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Horizontal"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"horizontal"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Horizontal"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Yaw"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"yaw"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Yaw"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Pilot_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"commands_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":30}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Commands Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"state_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":30}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"State Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"video_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":30}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Video Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Pilot_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Simulator_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"throttle_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Throttle Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"state_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":30}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"State Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Acceleration Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"angular_velocity_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Angular Velocity Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"magnetic_field_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Magnetic Field Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"pressure_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Pressure Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"temperature_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Temperature Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"distance_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":12}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Distance Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gps_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":5}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPS Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Multirotor_Simulator_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Noise"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gps_position"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":2.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPS Position"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gps_velocity"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.200000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPS Velocity"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gps_pacc"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.500000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPS PACC"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gps_vacc"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.100000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPS VACC"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.010000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Acceleration"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"angular_velocity"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.010000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Angular Velocity"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"magnetic_field"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.100000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Magnetic Field"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"pressure"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.100000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Pressure"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"temperature"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.100000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Temperature"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"ground_distance"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.010000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Ground Distance"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"simulation_enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Simulation Enabled"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"drag_enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Drag Enabled"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"ground_enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Ground Enabled"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gravity_enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Gravity Enabled"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Noise"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"noise"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Noise"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Calibration"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Acceleration_Calibration_Point"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"acceleration"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Acceleration"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Angular_Velocity_Calibration_Point"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"angular_velocity"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Angular Velocity"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Magnetic_Field_Calibration_Point"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"magnetic_field"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Magnetic Field"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Calibration"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"calibration"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Calibration"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Oscillator_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"component_count_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":32}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":30}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"component_count_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"component_count"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Components"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Oscillator_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Component"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"frequency"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Frequency"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"amplitude"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Amplitude"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"square"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Square"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"amplitude"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Amplitude"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"noise"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Noise"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Component"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"components"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Components"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PCA9685_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":8000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":127}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint8_t"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"hex"}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bus"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bus"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":30}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"i2c_address_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"address"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":64},{"name":"hex","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Address"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Enabled"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"servo_signal"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Servo Signal"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"channels"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Channels"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PCA9685_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Servo_Channel"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"servo_signal_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Min"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ms"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"servo_signal_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":2.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ms"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PWM_Channel"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"pwm_signal_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Min"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"pwm_signal_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vector"}]},{"type":9,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"channels"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Channels"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PIGPIO_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":8000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"enabled"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Enabled"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"servo_signal"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Servo Signal"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":400}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_2"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 2"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_3"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 3"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_4"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 4"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_5"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 5"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_6"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 6"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_7"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 7"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_8"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 8"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_9"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 9"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_10"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 10"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_11"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 11"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_12"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 12"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_13"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 13"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_14"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 14"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_15"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 15"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_16"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 16"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_17"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 17"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_18"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 18"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_19"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 19"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_20"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 20"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_21"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 21"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_22"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 22"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_23"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 23"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_24"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 24"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_25"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 25"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_26"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 26"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_27"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 27"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PIGPIO_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Servo_Channel"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"servo_signal_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Min"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ms"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"servo_signal_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":2.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ms"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PWM_Channel"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"pwm_signal_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Min"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"pwm_signal_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_2"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 2"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_3"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 3"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_4"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 4"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_5"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 5"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_6"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 6"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_7"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 7"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_8"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 8"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_9"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 9"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_10"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 10"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_11"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 11"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_12"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 12"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_13"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 13"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_14"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 14"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_15"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 15"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_16"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 16"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_17"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 17"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_18"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 18"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_19"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 19"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_20"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 20"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_21"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 21"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_22"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 22"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_23"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 23"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_24"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 24"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_25"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 25"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_26"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 26"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"poly"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"IChannel"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_27"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"GPIO 27"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Pressure_Velocity_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Pressure_Velocity_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Proximity_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"channel_count_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":128}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"channel_count_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"channel_count"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Channel Count"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Proximity_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Rate_Controller_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Rate_Controller_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Feedback"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"muf_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"weight"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Weight"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Combined_XY_PIDs"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PID_Controller_Descriptor"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Combined"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Separate_XY_PIDs"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Separate"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PID_Controller_Descriptor"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"x_pid"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"X"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PID_Controller_Descriptor"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"y_pid"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Y"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":8,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"variant"}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Combined_XY_PIDs"}]}]}]},{"type":9,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Separate_XY_PIDs"}]}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"xy_pids"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"XY PIDs"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"PID_Controller_Descriptor"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"z_pid"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Z PID"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Feedforward"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"muf_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"weight"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Weight"}]}]}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"torque_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.010000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"torque_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_torque"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max Torque"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"N"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Feedback"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"feedback"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Feedback"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Feedforward"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"feedforward"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Feedforward"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Raspicam_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Quality"}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"resolution_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vec2i"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":19,"children":[{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":8}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":8}]}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":19,"children":[{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1980}]}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1080}]}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bitrate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":32000000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"resolution_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"resolution"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Resolution"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bitrate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bitrate"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bitrate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"bps"}]}]}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"fps_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":120}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"fps_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"fps"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"FPS"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"iframe_interval_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"iframe_interval_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"iframe_interval"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":30}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"IFrame Interval"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"commands_rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":30}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"commands_rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"commands_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Commands Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Quality"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"streaming_low"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Streaming Low"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Quality"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"streaming_high"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Streaming High"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Quality"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"recording"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Recording"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Raspicam_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"iso_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1600}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"shutter_speed_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1000.000000}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ev_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":-10}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"sharpness_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"contrast_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"brightness_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"saturation_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":100}]}]}]}]},{"type":15,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"awb_mode_t"}]},{"type":16,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"OFF"},{"name":"integral_value","type":2,"value":0}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Off"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"AUTO"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Auto"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"SUNLIGHT"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Sunlight"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"CLOUDY"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Cloudy"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"SHADE"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Shade"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"TUNGSTEN"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Tungsten"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"FLUORESCENT"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Flourescent"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"INCANDESCENT"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Incandescent"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"FLASH"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Flash"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"HORIZON"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Horizon"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"iso_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"iso"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Iso"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"shutter_speed_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"shutter_speed"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Shutter Speed"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ms"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ev_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"ev"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":0}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Exposure Compensation"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"sharpness_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"sharpness"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":50}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Sharpness"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"contrast_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"contrast"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":50}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Contrast"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"brightness_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"brightness"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":50}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Brightness"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"saturation_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"saturation"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":50}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Saturation"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"awb_mode_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"awb_mode"}]},{"type":20,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"awb_mode_t::AUTO"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"AWB Mode"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"hflip"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Horizontal Flip"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"vflip"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Vertical Flip"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Recorder_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"input_count_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":64}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"chunk_size_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":16384}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":4194304}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"chunk_buffer_count_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":2}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":256}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"input_count_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"input_count"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Input Count"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"directory"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"flight_logs"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Directory"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"chunk_size_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"chunk_size"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":262144}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Chunk Size"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"B"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"chunk_buffer_count_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"chunk_buffer_count"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":16}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Chunk Buffers"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Recorder_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"is_recording"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":true}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Recording"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Replay_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":15,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"clock_t"}]},{"type":16,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"REAL_TIME"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Real Time"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"AS_FAST_AS_POSSIBLE"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"As Fast As Possible"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"path"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Log File"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"clock_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"clock"}]},{"type":20,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"clock_t::REAL_TIME"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Clock"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Replay_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.010000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":100.000000}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"speed_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"speed"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Speed"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"x"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"loop"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Loop"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"RC5T619_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":200}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bus"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bus"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"adc0_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":50}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ADC0 Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"adc1_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":5}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ADC1 Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"RC5T619_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Resampler_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"input_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Input Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"output_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Output Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Resampler_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":15,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"mode_t"}]},{"type":16,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"HOLD_LPF"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hold + LPF"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"POLYPHASE_FIR"}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Polyphase FIR"}]}]}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"zero_crossings_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":16}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"mode_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"mode"}]},{"type":20,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"mode_t::HOLD_LPF"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Mode"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"LPF_Config"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"lpf"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"LPF"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"zero_crossings_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"fir_zero_crossings"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":4}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"FIR Zero Crossings"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Scalar_Generator_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Scalar_Generator_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"float"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"value"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Value"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Servo_Gimbal_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"commands_rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Commands Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Servo_Gimbal_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"euler_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"min_angle"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":-180.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Min Angle"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"°"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"euler_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_angle"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":180.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max Angle"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"°"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"pwm_signal_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"min_pwm"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max PWM"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"pwm_signal_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_pwm"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max PWM"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"x_channel"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"X Channel"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"y_channel"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Y Channel"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Channel"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"z_channel"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Z Channel"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"SRF01_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bus"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bus"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"SRF01_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"direction_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"direction"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Direction"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_distance"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":6.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Maximum Distance"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"min_distance"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.200000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Minimum Distance"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"SRF02_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bus"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bus"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"SRF02_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"direction_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"direction"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Direction"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_distance"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":6.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Maximum Distance"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"min_distance"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.200000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Minimum Distance"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"m"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Throttle_To_PWM_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"channel_count_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"int32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":128}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"channel_count_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"channel_count"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Channel Count"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Throttle_To_PWM_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Transformer_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Transformer_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"UBLOX_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"string"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"bus"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Bus"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"UBLOX_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Vec3_Generator_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"Vec3_Generator_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"vec3f"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"value"}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Value"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"CPPM_Receiver_Descriptor"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Descriptor"}]}]}]},{"type":14,"children":[{"type":15,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_t"}]},{"type":16,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"_2"},{"name":"integral_value","type":2,"value":2}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"2"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_3"},{"name":"integral_value","type":2,"value":3}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"3"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_4"},{"name":"integral_value","type":2,"value":4}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"4"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_5"},{"name":"integral_value","type":2,"value":5}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"5"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_6"},{"name":"integral_value","type":2,"value":6}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"6"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_7"},{"name":"integral_value","type":2,"value":7}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"7"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_8"},{"name":"integral_value","type":2,"value":8}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"8"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_9"},{"name":"integral_value","type":2,"value":9}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"9"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_10"},{"name":"integral_value","type":2,"value":10}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"10"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_11"},{"name":"integral_value","type":2,"value":11}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"11"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_12"},{"name":"integral_value","type":2,"value":12}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"12"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_13"},{"name":"integral_value","type":2,"value":13}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"13"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_14"},{"name":"integral_value","type":2,"value":14}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"14"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_15"},{"name":"integral_value","type":2,"value":15}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"15"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_16"},{"name":"integral_value","type":2,"value":16}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"16"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_17"},{"name":"integral_value","type":2,"value":17}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"17"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_18"},{"name":"integral_value","type":2,"value":18}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"18"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_19"},{"name":"integral_value","type":2,"value":19}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"19"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_20"},{"name":"integral_value","type":2,"value":20}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"20"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_21"},{"name":"integral_value","type":2,"value":21}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"21"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_22"},{"name":"integral_value","type":2,"value":22}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"22"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_23"},{"name":"integral_value","type":2,"value":23}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"23"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_24"},{"name":"integral_value","type":2,"value":24}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"24"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_25"},{"name":"integral_value","type":2,"value":25}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"25"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_26"},{"name":"integral_value","type":2,"value":26}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"26"}]}]}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"_27"},{"name":"integral_value","type":2,"value":27}],"children":[{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"27"}]}]}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio"}]},{"type":20,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"gpio_t::_26"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"CPPM GPIO"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"channel_count_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":16}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"channel_count_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"channel_count"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":8}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Channels"}]}]}]}]},{"type":12,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]},{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"min"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":1}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"max"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":10000}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"native_type"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"uint32_t"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"rate_t"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"rate"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":2,"value":50}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Rate"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Hz"}]}]}]}]}]}]},{"type":13,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"CPPM_Receiver_Config"}]},{"type":7,"attributes":[{"name":"visibility","type":0,"value":"public"}],"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"INode_Config"}]}]}]},{"type":14,"children":[{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"bool"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"inverted"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":1,"value":false}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Inverted Signal"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"frame_length"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":27.000000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Frame Length"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ms"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"gap_pulse_length"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.400000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Gap Pulse Length"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ms"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"min_pulse_length"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":0.600000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Min Pulse Length"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ms"}]}]}]}]},{"type":18,"children":[{"type":3,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ufloat"}]}]},{"type":6,"attributes":[{"name":"value","type":0,"value":"max_pulse_length"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":3,"value":1.600000}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_name"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"Max Pulse Length"}]}]}]},{"type":21,"children":[{"type":6,"attributes":[{"name":"value","type":0,"value":"ui_suffix"}]},{"type":20,"children":[{"type":4,"attributes":[{"name":"value","type":0,"value":"ms"}]}]}]}]}]}]}]})xxx";
   return s_json;
 }
 
@@ -340,6 +340,198 @@ std::string const& get_ast_json()
       return m_input_paths;
     }
 
+////////////////////////////////////////////////////////////
+    void Settings::Frame_Trace::set_is_enabled(bool const& value)
+    {
+      m_is_enabled = value;
+    }
+    void Settings::Frame_Trace::set_is_enabled(bool&& value)
+    {
+      m_is_enabled = std::move(value);
+    }
+    auto Settings::Frame_Trace::get_is_enabled() const -> bool const& 
+    {
+      return m_is_enabled;
+    }
+
+////////////////////////////////////////////////////////////
+    void Settings::Frame_Trace::set_deadline_us(uint32_t const& value)
+    {
+      m_deadline_us = value;
+    }
+    void Settings::Frame_Trace::set_deadline_us(uint32_t&& value)
+    {
+      m_deadline_us = std::move(value);
+    }
+    auto Settings::Frame_Trace::get_deadline_us() const -> uint32_t const& 
+    {
+      return m_deadline_us;
+    }
+
+////////////////////////////////////////////////////////////
+    void Settings::Real_Time::set_is_strict(bool const& value)
+    {
+      m_is_strict = value;
+    }
+    void Settings::Real_Time::set_is_strict(bool&& value)
+    {
+      m_is_strict = std::move(value);
+    }
+    auto Settings::Real_Time::get_is_strict() const -> bool const& 
+    {
+      return m_is_strict;
+    }
+
+////////////////////////////////////////////////////////////
+    void Settings::Real_Time::set_warmup_ms(uint32_t const& value)
+    {
+      m_warmup_ms = value;
+    }
+    void Settings::Real_Time::set_warmup_ms(uint32_t&& value)
+    {
+      m_warmup_ms = std::move(value);
+    }
+    auto Settings::Real_Time::get_warmup_ms() const -> uint32_t const& 
+    {
+      return m_warmup_ms;
+    }
+
+////////////////////////////////////////////////////////////
+    void Settings::Thread_Profile::set_name(std::string const& value)
+    {
+      m_name = value;
+    }
+    void Settings::Thread_Profile::set_name(std::string&& value)
+    {
+      m_name = std::move(value);
+    }
+    auto Settings::Thread_Profile::get_name() const -> std::string const& 
+    {
+      return m_name;
+    }
+
+////////////////////////////////////////////////////////////
+    void Settings::Thread_Profile::set_policy(policy_t const& value)
+    {
+      m_policy = value;
+    }
+    void Settings::Thread_Profile::set_policy(policy_t&& value)
+    {
+      m_policy = std::move(value);
+    }
+    auto Settings::Thread_Profile::get_policy() const -> policy_t const& 
+    {
+      return m_policy;
+    }
+
+////////////////////////////////////////////////////////////
+    void Settings::Thread_Profile::set_priority(priority_t const& value)
+    {
+      m_priority = clamp(value, priority_t(0), priority_t(99));
+    }
+    void Settings::Thread_Profile::set_priority(priority_t&& value)
+    {
+      m_priority = clamp(std::move(value), priority_t(0), priority_t(99));
+    }
+    auto Settings::Thread_Profile::get_priority() const -> priority_t const& 
+    {
+      return m_priority;
+    }
+
+////////////////////////////////////////////////////////////
+    void Settings::Thread_Profile::set_cpus(std::vector<uint32_t> const& value)
+    {
+      m_cpus = value;
+    }
+    void Settings::Thread_Profile::set_cpus(std::vector<uint32_t>&& value)
+    {
+      m_cpus = std::move(value);
+    }
+    auto Settings::Thread_Profile::get_cpus() const -> std::vector<uint32_t> const& 
+    {
+      return m_cpus;
+    }
+
+    auto Settings::Thread_Profile::get_cpus() -> std::vector<uint32_t>& 
+    {
+      return m_cpus;
+    }
+
+////////////////////////////////////////////////////////////
+    void Settings::Threads::set_lock_memory(bool const& value)
+    {
+      m_lock_memory = value;
+    }
+    void Settings::Threads::set_lock_memory(bool&& value)
+    {
+      m_lock_memory = std::move(value);
+    }
+    auto Settings::Threads::get_lock_memory() const -> bool const& 
+    {
+      return m_lock_memory;
+    }
+
+////////////////////////////////////////////////////////////
+    void Settings::Threads::set_profiles(std::vector<Settings::Thread_Profile> const& value)
+    {
+      m_profiles = value;
+    }
+    void Settings::Threads::set_profiles(std::vector<Settings::Thread_Profile>&& value)
+    {
+      m_profiles = std::move(value);
+    }
+    auto Settings::Threads::get_profiles() const -> std::vector<Settings::Thread_Profile> const& 
+    {
+      return m_profiles;
+    }
+
+    auto Settings::Threads::get_profiles() -> std::vector<Settings::Thread_Profile>& 
+    {
+      return m_profiles;
+    }
+
+////////////////////////////////////////////////////////////
+    void Settings::Profiler::set_is_enabled(bool const& value)
+    {
+      m_is_enabled = value;
+    }
+    void Settings::Profiler::set_is_enabled(bool&& value)
+    {
+      m_is_enabled = std::move(value);
+    }
+    auto Settings::Profiler::get_is_enabled() const -> bool const& 
+    {
+      return m_is_enabled;
+    }
+
+////////////////////////////////////////////////////////////
+    void Settings::Profiler::set_write_trace(bool const& value)
+    {
+      m_write_trace = value;
+    }
+    void Settings::Profiler::set_write_trace(bool&& value)
+    {
+      m_write_trace = std::move(value);
+    }
+    auto Settings::Profiler::get_write_trace() const -> bool const& 
+    {
+      return m_write_trace;
+    }
+
+////////////////////////////////////////////////////////////
+    void Settings::Profiler::set_summary_period_ms(uint32_t const& value)
+    {
+      m_summary_period_ms = value;
+    }
+    void Settings::Profiler::set_summary_period_ms(uint32_t&& value)
+    {
+      m_summary_period_ms = std::move(value);
+    }
+    auto Settings::Profiler::get_summary_period_ms() const -> uint32_t const& 
+    {
+      return m_summary_period_ms;
+    }
+
 ////////////////////////////////////////////////////////////
   void Settings::set_uav_descriptor(Poly<const IUAV_Descriptor> const& value)
   {
@@ -397,6 +589,82 @@ std::string const& get_ast_json()
     return m_nodes;
   }
 
+////////////////////////////////////////////////////////////
+  void Settings::set_frame_trace(Frame_Trace const& value)
+  {
+    m_frame_trace = value;
+  }
+  void Settings::set_frame_trace(Frame_Trace&& value)
+  {
+    m_frame_trace = std::move(value);
+  }
+  auto Settings::get_frame_trace() const -> Frame_Trace const& 
+  {
+    return m_frame_trace;
+  }
+
+  auto Settings::get_frame_trace() -> Frame_Trace& 
+  {
+    return m_frame_trace;
+  }
+
+////////////////////////////////////////////////////////////
+  void Settings::set_real_time(Real_Time const& value)
+  {
+    m_real_time = value;
+  }
+  void Settings::set_real_time(Real_Time&& value)
+  {
+    m_real_time = std::move(value);
+  }
+  auto Settings::get_real_time() const -> Real_Time const& 
+  {
+    return m_real_time;
+  }
+
+  auto Settings::get_real_time() -> Real_Time& 
+  {
+    return m_real_time;
+  }
+
+////////////////////////////////////////////////////////////
+  void Settings::set_threads(Threads const& value)
+  {
+    m_threads = value;
+  }
+  void Settings::set_threads(Threads&& value)
+  {
+    m_threads = std::move(value);
+  }
+  auto Settings::get_threads() const -> Threads const& 
+  {
+    return m_threads;
+  }
+
+  auto Settings::get_threads() -> Threads& 
+  {
+    return m_threads;
+  }
+
+////////////////////////////////////////////////////////////
+  void Settings::set_profiler(Profiler const& value)
+  {
+    m_profiler = value;
+  }
+  void Settings::set_profiler(Profiler&& value)
+  {
+    m_profiler = std::move(value);
+  }
+  auto Settings::get_profiler() const -> Profiler const& 
+  {
+    return m_profiler;
+  }
+
+  auto Settings::get_profiler() -> Profiler& 
+  {
+    return m_profiler;
+  }
+
 ////////////////////////////////////////////////////////////
   void Multirotor_Descriptor::set_radius(radius_t const& value)
   {
@@ -1164,6 +1432,20 @@ std::string const& get_ast_json()
     return m_rate;
   }
 
+////////////////////////////////////////////////////////////
+  void Comp_AHRS_Config::set_mode(mode_t const& value)
+  {
+    m_mode = value;
+  }
+  void Comp_AHRS_Config::set_mode(mode_t&& value)
+  {
+    m_mode = std::move(value);
+  }
+  auto Comp_AHRS_Config::get_mode() const -> mode_t const& 
+  {
+    return m_mode;
+  }
+
 ////////////////////////////////////////////////////////////
   void Comp_AHRS_Config::set_drift_correction_factor(muf_t const& value)
   {
@@ -1178,6 +1460,62 @@ std::string const& get_ast_json()
     return m_drift_correction_factor;
   }
 
+////////////////////////////////////////////////////////////
+  void Comp_AHRS_Config::set_mahony_kp(gain_t const& value)
+  {
+    m_mahony_kp = clamp(value, gain_t(0), gain_t(100.000000f));
+  }
+  void Comp_AHRS_Config::set_mahony_kp(gain_t&& value)
+  {
+    m_mahony_kp = clamp(std::move(value), gain_t(0), gain_t(100.000000f));
+  }
+  auto Comp_AHRS_Config::get_mahony_kp() const -> gain_t const& 
+  {
+    return m_mahony_kp;
+  }
+
+////////////////////////////////////////////////////////////
+  void Comp_AHRS_Config::set_mahony_ki(gain_t const& value)
+  {
+    m_mahony_ki = clamp(value, gain_t(0), gain_t(100.000000f));
+  }
+  void Comp_AHRS_Config::set_mahony_ki(gain_t&& value)
+  {
+    m_mahony_ki = clamp(std::move(value), gain_t(0), gain_t(100.000000f));
+  }
+  auto Comp_AHRS_Config::get_mahony_ki() const -> gain_t const& 
+  {
+    return m_mahony_ki;
+  }
+
+////////////////////////////////////////////////////////////
+  void Comp_AHRS_Config::set_max_gyro_bias(ufloat const& value)
+  {
+    m_max_gyro_bias = max(value, ufloat(0));
+  }
+  void Comp_AHRS_Config::set_max_gyro_bias(ufloat&& value)
+  {
+    m_max_gyro_bias = max(std::move(value), ufloat(0));
+  }
+  auto Comp_AHRS_Config::get_max_gyro_bias() const -> ufloat const& 
+  {
+    return m_max_gyro_bias;
+  }
+
+////////////////////////////////////////////////////////////
+  void Comp_AHRS_Config::set_magnetic_field_correction_rate(uint32_t const& value)
+  {
+    m_magnetic_field_correction_rate = clamp(value, uint32_t(1), uint32_t(10000));
+  }
+  void Comp_AHRS_Config::set_magnetic_field_correction_rate(uint32_t&& value)
+  {
+    m_magnetic_field_correction_rate = clamp(std::move(value), uint32_t(1), uint32_t(10000));
+  }
+  auto Comp_AHRS_Config::get_magnetic_field_correction_rate() const -> uint32_t const& 
+  {
+    return m_magnetic_field_correction_rate;
+  }
+
 ////////////////////////////////////////////////////////////
   void Combiner_Descriptor::set_rate(uint32_t const& value)
   {
@@ -1304,6 +1642,104 @@ std::string const& get_ast_json()
     return m_acceleration_accuracy;
   }
 
+////////////////////////////////////////////////////////////
+  void ESKF_ECEF_Descriptor::set_rate(uint32_t const& value)
+  {
+    m_rate = clamp(value, uint32_t(1), uint32_t(10000));
+  }
+  void ESKF_ECEF_Descriptor::set_rate(uint32_t&& value)
+  {
+    m_rate = clamp(std::move(value), uint32_t(1), uint32_t(10000));
+  }
+  auto ESKF_ECEF_Descriptor::get_rate() const -> uint32_t const& 
+  {
+    return m_rate;
+  }
+
+////////////////////////////////////////////////////////////
+  void ESKF_ECEF_Config::set_gps_lag(ufloat const& value)
+  {
+    m_gps_lag = max(value, ufloat(0));
+  }
+  void ESKF_ECEF_Config::set_gps_lag(ufloat&& value)
+  {
+    m_gps_lag = max(std::move(value), ufloat(0));
+  }
+  auto ESKF_ECEF_Config::get_gps_lag() const -> ufloat const& 
+  {
+    return m_gps_lag;
+  }
+
+////////////////////////////////////////////////////////////
+  void ESKF_ECEF_Config::set_gps_position_accuracy(ufloat const& value)
+  {
+    m_gps_position_accuracy = max(value, ufloat(0));
+  }
+  void ESKF_ECEF_Config::set_gps_position_accuracy(ufloat&& value)
+  {
+    m_gps_position_accuracy = max(std::move(value), ufloat(0));
+  }
+  auto ESKF_ECEF_Config::get_gps_position_accuracy() const -> ufloat const& 
+  {
+    return m_gps_position_accuracy;
+  }
+
+////////////////////////////////////////////////////////////
+  void ESKF_ECEF_Config::set_gps_velocity_accuracy(ufloat const& value)
+  {
+    m_gps_velocity_accuracy = max(value, ufloat(0));
+  }
+  void ESKF_ECEF_Config::set_gps_velocity_accuracy(ufloat&& value)
+  {
+    m_gps_velocity_accuracy = max(std::move(value), ufloat(0));
+  }
+  auto ESKF_ECEF_Config::get_gps_velocity_accuracy() const -> ufloat const& 
+  {
+    return m_gps_velocity_accuracy;
+  }
+
+////////////////////////////////////////////////////////////
+  void ESKF_ECEF_Config::set_baro_lag(ufloat const& value)
+  {
+    m_baro_lag = max(value, ufloat(0));
+  }
+  void ESKF_ECEF_Config::set_baro_lag(ufloat&& value)
+  {
+    m_baro_lag = max(std::move(value), ufloat(0));
+  }
+  auto ESKF_ECEF_Config::get_baro_lag() const -> ufloat const& 
+  {
+    return m_baro_lag;
+  }
+
+////////////////////////////////////////////////////////////
+  void ESKF_ECEF_Config::set_baro_accuracy(ufloat const& value)
+  {
+    m_baro_accuracy = max(value, ufloat(0));
+  }
+  void ESKF_ECEF_Config::set_baro_accuracy(ufloat&& value)
+  {
+    m_baro_accuracy = max(std::move(value), ufloat(0));
+  }
+  auto ESKF_ECEF_Config::get_baro_accuracy() const -> ufloat const& 
+  {
+    return m_baro_accuracy;
+  }
+
+////////////////////////////////////////////////////////////
+  void ESKF_ECEF_Config::set_acceleration_accuracy(ufloat const& value)
+  {
+    m_acceleration_accuracy = max(value, ufloat(0));
+  }
+  void ESKF_ECEF_Config::set_acceleration_accuracy(ufloat&& value)
+  {
+    m_acceleration_accuracy = max(std::move(value), ufloat(0));
+  }
+  auto ESKF_ECEF_Config::get_acceleration_accuracy() const -> ufloat const& 
+  {
+    return m_acceleration_accuracy;
+  }
+
 ////////////////////////////////////////////////////////////
   void ENU_Frame_System_Descriptor::set_rate(uint32_t const& value)
   {
@@ -1360,6 +1796,76 @@ std::string const& get_ast_json()
     return m_cutoff_frequency;
   }
 
+////////////////////////////////////////////////////////////
+  void Dynamic_Notch_Descriptor::set_rate(uint32_t const& value)
+  {
+    m_rate = clamp(value, uint32_t(1), uint32_t(10000));
+  }
+  void Dynamic_Notch_Descriptor::set_rate(uint32_t&& value)
+  {
+    m_rate = clamp(std::move(value), uint32_t(1), uint32_t(10000));
+  }
+  auto Dynamic_Notch_Descriptor::get_rate() const -> uint32_t const& 
+  {
+    return m_rate;
+  }
+
+////////////////////////////////////////////////////////////
+  void Dynamic_Notch_Descriptor::set_notch_count(notch_count_t const& value)
+  {
+    m_notch_count = clamp(value, notch_count_t(1), notch_count_t(4));
+  }
+  void Dynamic_Notch_Descriptor::set_notch_count(notch_count_t&& value)
+  {
+    m_notch_count = clamp(std::move(value), notch_count_t(1), notch_count_t(4));
+  }
+  auto Dynamic_Notch_Descriptor::get_notch_count() const -> notch_count_t const& 
+  {
+    return m_notch_count;
+  }
+
+////////////////////////////////////////////////////////////
+  void Dynamic_Notch_Config::set_min_frequency(ufloat const& value)
+  {
+    m_min_frequency = max(value, ufloat(0));
+  }
+  void Dynamic_Notch_Config::set_min_frequency(ufloat&& value)
+  {
+    m_min_frequency = max(std::move(value), ufloat(0));
+  }
+  auto Dynamic_Notch_Config::get_min_frequency() const -> ufloat const& 
+  {
+    return m_min_frequency;
+  }
+
+////////////////////////////////////////////////////////////
+  void Dynamic_Notch_Config::set_max_frequency(ufloat const& value)
+  {
+    m_max_frequency = max(value, ufloat(0));
+  }
+  void Dynamic_Notch_Config::set_max_frequency(ufloat&& value)
+  {
+    m_max_frequency = max(std::move(value), ufloat(0));
+  }
+  auto Dynamic_Notch_Config::get_max_frequency() const -> ufloat const& 
+  {
+    return m_max_frequency;
+  }
+
+////////////////////////////////////////////////////////////
+  void Dynamic_Notch_Config::set_q(q_t const& value)
+  {
+    m_q = clamp(value, q_t(0.500000f), q_t(20.000000f));
+  }
+  void Dynamic_Notch_Config::set_q(q_t&& value)
+  {
+    m_q = clamp(std::move(value), q_t(0.500000f), q_t(20.000000f));
+  }
+  auto Dynamic_Notch_Config::get_q() const -> q_t const& 
+  {
+    return m_q;
+  }
+
 ////////////////////////////////////////////////////////////
   void MaxSonar_Descriptor::set_bus(std::string const& value)
   {
@@ -1444,6 +1950,20 @@ std::string const& get_ast_json()
     return m_rate;
   }
 
+////////////////////////////////////////////////////////////
+  void Motor_Mixer_Config::set_mode(mode_t const& value)
+  {
+    m_mode = value;
+  }
+  void Motor_Mixer_Config::set_mode(mode_t&& value)
+  {
+    m_mode = std::move(value);
+  }
+  auto Motor_Mixer_Config::get_mode() const -> mode_t const& 
+  {
+    return m_mode;
+  }
+
 ////////////////////////////////////////////////////////////
   void Motor_Mixer_Config::set_armed_thrust(ufloat const& value)
   {
@@ -1696,6 +2216,20 @@ std::string const& get_ast_json()
     return m_angular_velocity_range;
   }
 
+////////////////////////////////////////////////////////////
+  void MPU9250_Descriptor::set_data_ready_gpio(int8_t const& value)
+  {
+    m_data_ready_gpio = clamp(value, int8_t(-1), int8_t(53));
+  }
+  void MPU9250_Descriptor::set_data_ready_gpio(int8_t&& value)
+  {
+    m_data_ready_gpio = clamp(std::move(value), int8_t(-1), int8_t(53));
+  }
+  auto MPU9250_Descriptor::get_data_ready_gpio() const -> int8_t const& 
+  {
+    return m_data_ready_gpio;
+  }
+
 ////////////////////////////////////////////////////////////
     void MPU9250_Config::Calibration::set_acceleration(std::vector<Acceleration_Calibration_Point> const& value)
     {
@@ -4663,113 +5197,239 @@ std::string const& get_ast_json()
 ////////////////////////////////////////////////////////////
   void Raspicam_Config::set_ev(ev_t const& value)
   {
-    m_ev = clamp(value, ev_t(-10), ev_t(10));
+    m_ev = clamp(value, ev_t(-10), ev_t(10));
+  }
+  void Raspicam_Config::set_ev(ev_t&& value)
+  {
+    m_ev = clamp(std::move(value), ev_t(-10), ev_t(10));
+  }
+  auto Raspicam_Config::get_ev() const -> ev_t const& 
+  {
+    return m_ev;
+  }
+
+////////////////////////////////////////////////////////////
+  void Raspicam_Config::set_sharpness(sharpness_t const& value)
+  {
+    m_sharpness = clamp(value, sharpness_t(0), sharpness_t(100));
+  }
+  void Raspicam_Config::set_sharpness(sharpness_t&& value)
+  {
+    m_sharpness = clamp(std::move(value), sharpness_t(0), sharpness_t(100));
+  }
+  auto Raspicam_Config::get_sharpness() const -> sharpness_t const& 
+  {
+    return m_sharpness;
+  }
+
+////////////////////////////////////////////////////////////
+  void Raspicam_Config::set_contrast(contrast_t const& value)
+  {
+    m_contrast = clamp(value, contrast_t(0), contrast_t(100));
+  }
+  void Raspicam_Config::set_contrast(contrast_t&& value)
+  {
+    m_contrast = clamp(std::move(value), contrast_t(0), contrast_t(100));
+  }
+  auto Raspicam_Config::get_contrast() const -> contrast_t const& 
+  {
+    return m_contrast;
+  }
+
+////////////////////////////////////////////////////////////
+  void Raspicam_Config::set_brightness(brightness_t const& value)
+  {
+    m_brightness = clamp(value, brightness_t(0), brightness_t(100));
+  }
+  void Raspicam_Config::set_brightness(brightness_t&& value)
+  {
+    m_brightness = clamp(std::move(value), brightness_t(0), brightness_t(100));
+  }
+  auto Raspicam_Config::get_brightness() const -> brightness_t const& 
+  {
+    return m_brightness;
+  }
+
+////////////////////////////////////////////////////////////
+  void Raspicam_Config::set_saturation(saturation_t const& value)
+  {
+    m_saturation = clamp(value, saturation_t(0), saturation_t(100));
+  }
+  void Raspicam_Config::set_saturation(saturation_t&& value)
+  {
+    m_saturation = clamp(std::move(value), saturation_t(0), saturation_t(100));
+  }
+  auto Raspicam_Config::get_saturation() const -> saturation_t const& 
+  {
+    return m_saturation;
+  }
+
+////////////////////////////////////////////////////////////
+  void Raspicam_Config::set_awb_mode(awb_mode_t const& value)
+  {
+    m_awb_mode = value;
+  }
+  void Raspicam_Config::set_awb_mode(awb_mode_t&& value)
+  {
+    m_awb_mode = std::move(value);
+  }
+  auto Raspicam_Config::get_awb_mode() const -> awb_mode_t const& 
+  {
+    return m_awb_mode;
+  }
+
+////////////////////////////////////////////////////////////
+  void Raspicam_Config::set_hflip(bool const& value)
+  {
+    m_hflip = value;
+  }
+  void Raspicam_Config::set_hflip(bool&& value)
+  {
+    m_hflip = std::move(value);
+  }
+  auto Raspicam_Config::get_hflip() const -> bool const& 
+  {
+    return m_hflip;
+  }
+
+////////////////////////////////////////////////////////////
+  void Raspicam_Config::set_vflip(bool const& value)
+  {
+    m_vflip = value;
+  }
+  void Raspicam_Config::set_vflip(bool&& value)
+  {
+    m_vflip = std::move(value);
+  }
+  auto Raspicam_Config::get_vflip() const -> bool const& 
+  {
+    return m_vflip;
+  }
+
+////////////////////////////////////////////////////////////
+  void Recorder_Descriptor::set_input_count(input_count_t const& value)
+  {
+    m_input_count = clamp(value, input_count_t(1), input_count_t(64));
+  }
+  void Recorder_Descriptor::set_input_count(input_count_t&& value)
+  {
+    m_input_count = clamp(std::move(value), input_count_t(1), input_count_t(64));
+  }
+  auto Recorder_Descriptor::get_input_count() const -> input_count_t const& 
+  {
+    return m_input_count;
+  }
+
+////////////////////////////////////////////////////////////
+  void Recorder_Descriptor::set_directory(std::string const& value)
+  {
+    m_directory = value;
   }
-  void Raspicam_Config::set_ev(ev_t&& value)
+  void Recorder_Descriptor::set_directory(std::string&& value)
   {
-    m_ev = clamp(std::move(value), ev_t(-10), ev_t(10));
+    m_directory = std::move(value);
   }
-  auto Raspicam_Config::get_ev() const -> ev_t const& 
+  auto Recorder_Descriptor::get_directory() const -> std::string const& 
   {
-    return m_ev;
+    return m_directory;
   }
 
 ////////////////////////////////////////////////////////////
-  void Raspicam_Config::set_sharpness(sharpness_t const& value)
+  void Recorder_Descriptor::set_chunk_size(uint32_t const& value)
   {
-    m_sharpness = clamp(value, sharpness_t(0), sharpness_t(100));
+    m_chunk_size = clamp(value, uint32_t(16384), uint32_t(4194304));
   }
-  void Raspicam_Config::set_sharpness(sharpness_t&& value)
+  void Recorder_Descriptor::set_chunk_size(uint32_t&& value)
   {
-    m_sharpness = clamp(std::move(value), sharpness_t(0), sharpness_t(100));
+    m_chunk_size = clamp(std::move(value), uint32_t(16384), uint32_t(4194304));
   }
-  auto Raspicam_Config::get_sharpness() const -> sharpness_t const& 
+  auto Recorder_Descriptor::get_chunk_size() const -> uint32_t const& 
   {
-    return m_sharpness;
+    return m_chunk_size;
   }
 
 ////////////////////////////////////////////////////////////
-  void Raspicam_Config::set_contrast(contrast_t const& value)
+  void Recorder_Descriptor::set_chunk_buffer_count(uint32_t const& value)
   {
-    m_contrast = clamp(value, contrast_t(0), contrast_t(100));
+    m_chunk_buffer_count = clamp(value, uint32_t(2), uint32_t(256));
   }
-  void Raspicam_Config::set_contrast(contrast_t&& value)
+  void Recorder_Descriptor::set_chunk_buffer_count(uint32_t&& value)
   {
-    m_contrast = clamp(std::move(value), contrast_t(0), contrast_t(100));
+    m_chunk_buffer_count = clamp(std::move(value), uint32_t(2), uint32_t(256));
   }
-  auto Raspicam_Config::get_contrast() const -> contrast_t const& 
+  auto Recorder_Descriptor::get_chunk_buffer_count() const -> uint32_t const& 
   {
-    return m_contrast;
+    return m_chunk_buffer_count;
   }
 
 ////////////////////////////////////////////////////////////
-  void Raspicam_Config::set_brightness(brightness_t const& value)
+  void Recorder_Config::set_is_recording(bool const& value)
   {
-    m_brightness = clamp(value, brightness_t(0), brightness_t(100));
+    m_is_recording = value;
   }
-  void Raspicam_Config::set_brightness(brightness_t&& value)
+  void Recorder_Config::set_is_recording(bool&& value)
   {
-    m_brightness = clamp(std::move(value), brightness_t(0), brightness_t(100));
+    m_is_recording = std::move(value);
   }
-  auto Raspicam_Config::get_brightness() const -> brightness_t const& 
+  auto Recorder_Config::get_is_recording() const -> bool const& 
   {
-    return m_brightness;
+    return m_is_recording;
   }
 
 ////////////////////////////////////////////////////////////
-  void Raspicam_Config::set_saturation(saturation_t const& value)
+  void Replay_Descriptor::set_path(std::string const& value)
   {
-    m_saturation = clamp(value, saturation_t(0), saturation_t(100));
+    m_path = value;
   }
-  void Raspicam_Config::set_saturation(saturation_t&& value)
+  void Replay_Descriptor::set_path(std::string&& value)
   {
-    m_saturation = clamp(std::move(value), saturation_t(0), saturation_t(100));
+    m_path = std::move(value);
   }
-  auto Raspicam_Config::get_saturation() const -> saturation_t const& 
+  auto Replay_Descriptor::get_path() const -> std::string const& 
   {
-    return m_saturation;
+    return m_path;
   }
 
 ////////////////////////////////////////////////////////////
-  void Raspicam_Config::set_awb_mode(awb_mode_t const& value)
+  void Replay_Descriptor::set_clock(clock_t const& value)
   {
-    m_awb_mode = value;
+    m_clock = value;
   }
-  void Raspicam_Config::set_awb_mode(awb_mode_t&& value)
+  void Replay_Descriptor::set_clock(clock_t&& value)
   {
-    m_awb_mode = std::move(value);
+    m_clock = std::move(value);
   }
-  auto Raspicam_Config::get_awb_mode() const -> awb_mode_t const& 
+  auto Replay_Descriptor::get_clock() const -> clock_t const& 
   {
-    return m_awb_mode;
+    return m_clock;
   }
 
 ////////////////////////////////////////////////////////////
-  void Raspicam_Config::set_hflip(bool const& value)
+  void Replay_Config::set_speed(speed_t const& value)
   {
-    m_hflip = value;
+    m_speed = clamp(value, speed_t(0.010000f), speed_t(100.000000f));
   }
-  void Raspicam_Config::set_hflip(bool&& value)
+  void Replay_Config::set_speed(speed_t&& value)
   {
-    m_hflip = std::move(value);
+    m_speed = clamp(std::move(value), speed_t(0.010000f), speed_t(100.000000f));
   }
-  auto Raspicam_Config::get_hflip() const -> bool const& 
+  auto Replay_Config::get_speed() const -> speed_t const& 
   {
-    return m_hflip;
+    return m_speed;
   }
 
 ////////////////////////////////////////////////////////////
-  void Raspicam_Config::set_vflip(bool const& value)
+  void Replay_Config::set_loop(bool const& value)
   {
-    m_vflip = value;
+    m_loop = value;
   }
-  void Raspicam_Config::set_vflip(bool&& value)
+  void Replay_Config::set_loop(bool&& value)
   {
-    m_vflip = std::move(value);
+    m_loop = std::move(value);
   }
-  auto Raspicam_Config::get_vflip() const -> bool const& 
+  auto Replay_Config::get_loop() const -> bool const& 
   {
-    return m_vflip;
+    return m_loop;
   }
 
 ////////////////////////////////////////////////////////////
@@ -4842,6 +5502,20 @@ std::string const& get_ast_json()
     return m_output_rate;
   }
 
+////////////////////////////////////////////////////////////
+  void Resampler_Config::set_mode(mode_t const& value)
+  {
+    m_mode = value;
+  }
+  void Resampler_Config::set_mode(mode_t&& value)
+  {
+    m_mode = std::move(value);
+  }
+  auto Resampler_Config::get_mode() const -> mode_t const& 
+  {
+    return m_mode;
+  }
+
 ////////////////////////////////////////////////////////////
   void Resampler_Config::set_lpf(LPF_Config const& value)
   {
@@ -4861,6 +5535,20 @@ std::string const& get_ast_json()
     return m_lpf;
   }
 
+////////////////////////////////////////////////////////////
+  void Resampler_Config::set_fir_zero_crossings(zero_crossings_t const& value)
+  {
+    m_fir_zero_crossings = clamp(value, zero_crossings_t(1), zero_crossings_t(16));
+  }
+  void Resampler_Config::set_fir_zero_crossings(zero_crossings_t&& value)
+  {
+    m_fir_zero_crossings = clamp(std::move(value), zero_crossings_t(1), zero_crossings_t(16));
+  }
+  auto Resampler_Config::get_fir_zero_crossings() const -> zero_crossings_t const& 
+  {
+    return m_fir_zero_crossings;
+  }
+
 ////////////////////////////////////////////////////////////
   void Scalar_Generator_Descriptor::set_rate(uint32_t const& value)
   {
@@ -6259,6 +6947,11 @@ ts::Result<void> deserialize(Poly<INode_Descriptor>& value, ts::sz::Value const&
     value = Poly<INode_Descriptor>(new KF_ECEF_Descriptor());
     return deserialize((KF_ECEF_Descriptor&)*value, *value_sz_value);
   }
+  else if (path == "::ESKF_ECEF_Descriptor")
+  {
+    value = Poly<INode_Descriptor>(new ESKF_ECEF_Descriptor());
+    return deserialize((ESKF_ECEF_Descriptor&)*value, *value_sz_value);
+  }
   else if (path == "::ENU_Frame_System_Descriptor")
   {
     value = Poly<INode_Descriptor>(new ENU_Frame_System_Descriptor());
@@ -6269,6 +6962,11 @@ ts::Result<void> deserialize(Poly<INode_Descriptor>& value, ts::sz::Value const&
     value = Poly<INode_Descriptor>(new LPF_Descriptor());
     return deserialize((LPF_Descriptor&)*value, *value_sz_value);
   }
+  else if (path == "::Dynamic_Notch_Descriptor")
+  {
+    value = Poly<INode_Descriptor>(new Dynamic_Notch_Descriptor());
+    return deserialize((Dynamic_Notch_Descriptor&)*value, *value_sz_value);
+  }
   else if (path == "::MaxSonar_Descriptor")
   {
     value = Poly<INode_Descriptor>(new MaxSonar_Descriptor());
@@ -6349,6 +7047,16 @@ ts::Result<void> deserialize(Poly<INode_Descriptor>& value, ts::sz::Value const&
     value = Poly<INode_Descriptor>(new Raspicam_Descriptor());
     return deserialize((Raspicam_Descriptor&)*value, *value_sz_value);
   }
+  else if (path == "::Recorder_Descriptor")
+  {
+    value = Poly<INode_Descriptor>(new Recorder_Descriptor());
+    return deserialize((Recorder_Descriptor&)*value, *value_sz_value);
+  }
+  else if (path == "::Replay_Descriptor")
+  {
+    value = Poly<INode_Descriptor>(new Replay_Descriptor());
+    return deserialize((Replay_Descriptor&)*value, *value_sz_value);
+  }
   else if (path == "::RC5T619_Descriptor")
   {
     value = Poly<INode_Descriptor>(new RC5T619_Descriptor());
@@ -6468,6 +7176,13 @@ ts::sz::Value serialize(Poly<INode_Descriptor> const& value)
     sz_value.add_object_member("value", serialize((KF_ECEF_Descriptor&)*value));
     return std::move(sz_value);
   }
+  else if (typeid(*value) == typeid(ESKF_ECEF_Descriptor))
+  {
+    sz_value.reserve_object_members(2);
+    sz_value.add_object_member("type", "::ESKF_ECEF_Descriptor");
+    sz_value.add_object_member("value", serialize((ESKF_ECEF_Descriptor&)*value));
+    return std::move(sz_value);
+  }
   else if (typeid(*value) == typeid(ENU_Frame_System_Descriptor))
   {
     sz_value.reserve_object_members(2);
@@ -6482,6 +7197,13 @@ ts::sz::Value serialize(Poly<INode_Descriptor> const& value)
     sz_value.add_object_member("value", serialize((LPF_Descriptor&)*value));
     return std::move(sz_value);
   }
+  else if (typeid(*value) == typeid(Dynamic_Notch_Descriptor))
+  {
+    sz_value.reserve_object_members(2);
+    sz_value.add_object_member("type", "::Dynamic_Notch_Descriptor");
+    sz_value.add_object_member("value", serialize((Dynamic_Notch_Descriptor&)*value));
+    return std::move(sz_value);
+  }
   else if (typeid(*value) == typeid(MaxSonar_Descriptor))
   {
     sz_value.reserve_object_members(2);
@@ -6594,6 +7316,20 @@ ts::sz::Value serialize(Poly<INode_Descriptor> const& value)
     sz_value.add_object_member("value", serialize((Raspicam_Descriptor&)*value));
     return std::move(sz_value);
   }
+  else if (typeid(*value) == typeid(Recorder_Descriptor))
+  {
+    sz_value.reserve_object_members(2);
+    sz_value.add_object_member("type", "::Recorder_Descriptor");
+    sz_value.add_object_member("value", serialize((Recorder_Descriptor&)*value));
+    return std::move(sz_value);
+  }
+  else if (typeid(*value) == typeid(Replay_Descriptor))
+  {
+    sz_value.reserve_object_members(2);
+    sz_value.add_object_member("type", "::Replay_Descriptor");
+    sz_value.add_object_member("value", serialize((Replay_Descriptor&)*value));
+    return std::move(sz_value);
+  }
   else if (typeid(*value) == typeid(RC5T619_Descriptor))
   {
     sz_value.reserve_object_members(2);
@@ -6738,6 +7474,11 @@ ts::Result<void> deserialize(Poly<INode_Config>& value, ts::sz::Value const& sz_
     value = Poly<INode_Config>(new KF_ECEF_Config());
     return deserialize((KF_ECEF_Config&)*value, *value_sz_value);
   }
+  else if (path == "::ESKF_ECEF_Config")
+  {
+    value = Poly<INode_Config>(new ESKF_ECEF_Config());
+    return deserialize((ESKF_ECEF_Config&)*value, *value_sz_value);
+  }
   else if (path == "::ENU_Frame_System_Config")
   {
     value = Poly<INode_Config>(new ENU_Frame_System_Config());
@@ -6748,6 +7489,11 @@ ts::Result<void> deserialize(Poly<INode_Config>& value, ts::sz::Value const& sz_
     value = Poly<INode_Config>(new LPF_Config());
     return deserialize((LPF_Config&)*value, *value_sz_value);
   }
+  else if (path == "::Dynamic_Notch_Config")
+  {
+    value = Poly<INode_Config>(new Dynamic_Notch_Config());
+    return deserialize((Dynamic_Notch_Config&)*value, *value_sz_value);
+  }
   else if (path == "::MaxSonar_Config")
   {
     value = Poly<INode_Config>(new MaxSonar_Config());
@@ -6828,6 +7574,16 @@ ts::Result<void> deserialize(Poly<INode_Config>& value, ts::sz::Value const& sz_
     value = Poly<INode_Config>(new Raspicam_Config());
     return deserialize((Raspicam_Config&)*value, *value_sz_value);
   }
+  else if (path == "::Recorder_Config")
+  {
+    value = Poly<INode_Config>(new Recorder_Config());
+    return deserialize((Recorder_Config&)*value, *value_sz_value);
+  }
+  else if (path == "::Replay_Config")
+  {
+    value = Poly<INode_Config>(new Replay_Config());
+    return deserialize((Replay_Config&)*value, *value_sz_value);
+  }
   else if (path == "::RC5T619_Config")
   {
     value = Poly<INode_Config>(new RC5T619_Config());
@@ -6947,6 +7703,13 @@ ts::sz::Value serialize(Poly<INode_Config> const& value)
     sz_value.add_object_member("value", serialize((KF_ECEF_Config&)*value));
     return std::move(sz_value);
   }
+  else if (typeid(*value) == typeid(ESKF_ECEF_Config))
+  {
+    sz_value.reserve_object_members(2);
+    sz_value.add_object_member("type", "::ESKF_ECEF_Config");
+    sz_value.add_object_member("value", serialize((ESKF_ECEF_Config&)*value));
+    return std::move(sz_value);
+  }
   else if (typeid(*value) == typeid(ENU_Frame_System_Config))
   {
     sz_value.reserve_object_members(2);
@@ -6961,6 +7724,13 @@ ts::sz::Value serialize(Poly<INode_Config> const& value)
     sz_value.add_object_member("value", serialize((LPF_Config&)*value));
     return std::move(sz_value);
   }
+  else if (typeid(*value) == typeid(Dynamic_Notch_Config))
+  {
+    sz_value.reserve_object_members(2);
+    sz_value.add_object_member("type", "::Dynamic_Notch_Config");
+    sz_value.add_object_member("value", serialize((Dynamic_Notch_Config&)*value));
+    return std::move(sz_value);
+  }
   else if (typeid(*value) == typeid(MaxSonar_Config))
   {
     sz_value.reserve_object_members(2);
@@ -7073,6 +7843,20 @@ ts::sz::Value serialize(Poly<INode_Config> const& value)
     sz_value.add_object_member("value", serialize((Raspicam_Config&)*value));
     return std::move(sz_value);
   }
+  else if (typeid(*value) == typeid(Recorder_Config))
+  {
+    sz_value.reserve_object_members(2);
+    sz_value.add_object_member("type", "::Recorder_Config");
+    sz_value.add_object_member("value", serialize((Recorder_Config&)*value));
+    return std::move(sz_value);
+  }
+  else if (typeid(*value) == typeid(Replay_Config))
+  {
+    sz_value.reserve_object_members(2);
+    sz_value.add_object_member("type", "::Replay_Config");
+    sz_value.add_object_member("value", serialize((Replay_Config&)*value));
+    return std::move(sz_value);
+  }
   else if (typeid(*value) == typeid(RC5T619_Config))
   {
     sz_value.reserve_object_members(2);
@@ -7213,37 +7997,247 @@ ts::Result<void> deserialize(Settings::Node_Data& value, ts::sz::Value const& sz
     }
     else     if (sz_value.get_object_member_name(i) == "descriptor")
     {
-      std::remove_cv<std::remove_reference<decltype(value.get_descriptor())>::type>::type v;
+      std::remove_cv<std::remove_reference<decltype(value.get_descriptor())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_descriptor(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "config")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_config())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_config(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "input_paths")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_input_paths())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_input_paths(std::move(v));
+    }
+  }
+  return ts::success;
+}
+ts::sz::Value serialize(Settings::Node_Data const& value)
+{
+  ts::sz::Value sz_value(ts::sz::Value::Type::OBJECT);
+  sz_value.reserve_object_members(5);
+  sz_value.add_object_member("name", serialize(value.get_name()));
+  sz_value.add_object_member("type", serialize(value.get_type()));
+  sz_value.add_object_member("descriptor", serialize(value.get_descriptor()));
+  sz_value.add_object_member("config", serialize(value.get_config()));
+  sz_value.add_object_member("input_paths", serialize(value.get_input_paths()));
+  return sz_value;
+}
+ts::Result<void> deserialize(Settings::Frame_Trace& value, ts::sz::Value const& sz_value)
+{
+  if (!sz_value.is_object()) { return ts::Error("Expected object value when deserializing"); }
+  for (size_t i = 0; i < sz_value.get_object_member_count(); i++)
+  {
+    ts::sz::Value const& member_sz_value = sz_value.get_object_member_value(i);
+    if (sz_value.get_object_member_name(i) == "is_enabled")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_is_enabled())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_is_enabled(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "deadline_us")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_deadline_us())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_deadline_us(std::move(v));
+    }
+  }
+  return ts::success;
+}
+ts::sz::Value serialize(Settings::Frame_Trace const& value)
+{
+  ts::sz::Value sz_value(ts::sz::Value::Type::OBJECT);
+  sz_value.reserve_object_members(2);
+  sz_value.add_object_member("is_enabled", serialize(value.get_is_enabled()));
+  sz_value.add_object_member("deadline_us", serialize(value.get_deadline_us()));
+  return sz_value;
+}
+ts::Result<void> deserialize(Settings::Real_Time& value, ts::sz::Value const& sz_value)
+{
+  if (!sz_value.is_object()) { return ts::Error("Expected object value when deserializing"); }
+  for (size_t i = 0; i < sz_value.get_object_member_count(); i++)
+  {
+    ts::sz::Value const& member_sz_value = sz_value.get_object_member_value(i);
+    if (sz_value.get_object_member_name(i) == "is_strict")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_is_strict())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_is_strict(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "warmup_ms")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_warmup_ms())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_warmup_ms(std::move(v));
+    }
+  }
+  return ts::success;
+}
+ts::sz::Value serialize(Settings::Real_Time const& value)
+{
+  ts::sz::Value sz_value(ts::sz::Value::Type::OBJECT);
+  sz_value.reserve_object_members(2);
+  sz_value.add_object_member("is_strict", serialize(value.get_is_strict()));
+  sz_value.add_object_member("warmup_ms", serialize(value.get_warmup_ms()));
+  return sz_value;
+}
+ts::Result<void> deserialize(Settings::Thread_Profile::policy_t& value, ts::sz::Value const& sz_value)
+{
+  if (!sz_value.is_string()) { return ts::Error("Expected string value when deserializing"); }
+  std::string const& key = sz_value.get_as_string();
+  typedef Settings::Thread_Profile::policy_t _etype;
+  static std::map<std::string, _etype> s_map = {
+    { "OTHER", _etype::OTHER },
+    { "BATCH", _etype::BATCH },
+    { "IDLE", _etype::IDLE },
+    { "FIFO", _etype::FIFO },
+    { "RR", _etype::RR },
+  };
+  auto it = s_map.find(key);
+  if (it == s_map.end()) { return ts::Error("Cannot find item " + key + " when deserializing"); }
+  value = it->second;
+  return ts::success;
+}
+ts::sz::Value serialize(Settings::Thread_Profile::policy_t const& value)
+{
+  typedef Settings::Thread_Profile::policy_t _etype;
+  static std::map<_etype, std::string> s_map = {
+    { _etype::OTHER, "OTHER" },
+    { _etype::BATCH, "BATCH" },
+    { _etype::IDLE, "IDLE" },
+    { _etype::FIFO, "FIFO" },
+    { _etype::RR, "RR" },
+  };
+  auto it = s_map.find(value);
+  if (it == s_map.end()) { TS_ASSERT(false); return ts::sz::Value(); }
+  return ts::sz::Value(it->second);
+}
+ts::Result<void> deserialize(Settings::Thread_Profile& value, ts::sz::Value const& sz_value)
+{
+  if (!sz_value.is_object()) { return ts::Error("Expected object value when deserializing"); }
+  for (size_t i = 0; i < sz_value.get_object_member_count(); i++)
+  {
+    ts::sz::Value const& member_sz_value = sz_value.get_object_member_value(i);
+    if (sz_value.get_object_member_name(i) == "name")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_name())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_name(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "policy")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_policy())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_policy(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "priority")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_priority())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_priority(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "cpus")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_cpus())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_cpus(std::move(v));
+    }
+  }
+  return ts::success;
+}
+ts::sz::Value serialize(Settings::Thread_Profile const& value)
+{
+  ts::sz::Value sz_value(ts::sz::Value::Type::OBJECT);
+  sz_value.reserve_object_members(4);
+  sz_value.add_object_member("name", serialize(value.get_name()));
+  sz_value.add_object_member("policy", serialize(value.get_policy()));
+  sz_value.add_object_member("priority", serialize(value.get_priority()));
+  sz_value.add_object_member("cpus", serialize(value.get_cpus()));
+  return sz_value;
+}
+ts::Result<void> deserialize(Settings::Threads& value, ts::sz::Value const& sz_value)
+{
+  if (!sz_value.is_object()) { return ts::Error("Expected object value when deserializing"); }
+  for (size_t i = 0; i < sz_value.get_object_member_count(); i++)
+  {
+    ts::sz::Value const& member_sz_value = sz_value.get_object_member_value(i);
+    if (sz_value.get_object_member_name(i) == "lock_memory")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_lock_memory())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_lock_memory(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "profiles")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_profiles())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_profiles(std::move(v));
+    }
+  }
+  return ts::success;
+}
+ts::sz::Value serialize(Settings::Threads const& value)
+{
+  ts::sz::Value sz_value(ts::sz::Value::Type::OBJECT);
+  sz_value.reserve_object_members(2);
+  sz_value.add_object_member("lock_memory", serialize(value.get_lock_memory()));
+  sz_value.add_object_member("profiles", serialize(value.get_profiles()));
+  return sz_value;
+}
+ts::Result<void> deserialize(Settings::Profiler& value, ts::sz::Value const& sz_value)
+{
+  if (!sz_value.is_object()) { return ts::Error("Expected object value when deserializing"); }
+  for (size_t i = 0; i < sz_value.get_object_member_count(); i++)
+  {
+    ts::sz::Value const& member_sz_value = sz_value.get_object_member_value(i);
+    if (sz_value.get_object_member_name(i) == "is_enabled")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_is_enabled())>::type>::type v;
       auto result = deserialize(v, member_sz_value);
       if (result != ts::success) { return result; }
-      value.set_descriptor(std::move(v));
+      value.set_is_enabled(std::move(v));
     }
-    else     if (sz_value.get_object_member_name(i) == "config")
+    else     if (sz_value.get_object_member_name(i) == "write_trace")
     {
-      std::remove_cv<std::remove_reference<decltype(value.get_config())>::type>::type v;
+      std::remove_cv<std::remove_reference<decltype(value.get_write_trace())>::type>::type v;
       auto result = deserialize(v, member_sz_value);
       if (result != ts::success) { return result; }
-      value.set_config(std::move(v));
+      value.set_write_trace(std::move(v));
     }
-    else     if (sz_value.get_object_member_name(i) == "input_paths")
+    else     if (sz_value.get_object_member_name(i) == "summary_period_ms")
     {
-      std::remove_cv<std::remove_reference<decltype(value.get_input_paths())>::type>::type v;
+      std::remove_cv<std::remove_reference<decltype(value.get_summary_period_ms())>::type>::type v;
       auto result = deserialize(v, member_sz_value);
       if (result != ts::success) { return result; }
-      value.set_input_paths(std::move(v));
+      value.set_summary_period_ms(std::move(v));
     }
   }
   return ts::success;
 }
-ts::sz::Value serialize(Settings::Node_Data const& value)
+ts::sz::Value serialize(Settings::Profiler const& value)
 {
   ts::sz::Value sz_value(ts::sz::Value::Type::OBJECT);
-  sz_value.reserve_object_members(5);
-  sz_value.add_object_member("name", serialize(value.get_name()));
-  sz_value.add_object_member("type", serialize(value.get_type()));
-  sz_value.add_object_member("descriptor", serialize(value.get_descriptor()));
-  sz_value.add_object_member("config", serialize(value.get_config()));
-  sz_value.add_object_member("input_paths", serialize(value.get_input_paths()));
+  sz_value.reserve_object_members(3);
+  sz_value.add_object_member("is_enabled", serialize(value.get_is_enabled()));
+  sz_value.add_object_member("write_trace", serialize(value.get_write_trace()));
+  sz_value.add_object_member("summary_period_ms", serialize(value.get_summary_period_ms()));
   return sz_value;
 }
 ts::Result<void> deserialize(Settings& value, ts::sz::Value const& sz_value)
@@ -7273,16 +8267,48 @@ ts::Result<void> deserialize(Settings& value, ts::sz::Value const& sz_value)
       if (result != ts::success) { return result; }
       value.set_nodes(std::move(v));
     }
+    else     if (sz_value.get_object_member_name(i) == "frame_trace")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_frame_trace())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_frame_trace(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "real_time")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_real_time())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_real_time(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "threads")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_threads())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_threads(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "profiler")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_profiler())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_profiler(std::move(v));
+    }
   }
   return ts::success;
 }
 ts::sz::Value serialize(Settings const& value)
 {
   ts::sz::Value sz_value(ts::sz::Value::Type::OBJECT);
-  sz_value.reserve_object_members(3);
+  sz_value.reserve_object_members(7);
   sz_value.add_object_member("uav_descriptor", serialize(value.get_uav_descriptor()));
   sz_value.add_object_member("buses", serialize(value.get_buses()));
   sz_value.add_object_member("nodes", serialize(value.get_nodes()));
+  sz_value.add_object_member("frame_trace", serialize(value.get_frame_trace()));
+  sz_value.add_object_member("real_time", serialize(value.get_real_time()));
+  sz_value.add_object_member("threads", serialize(value.get_threads()));
+  sz_value.add_object_member("profiler", serialize(value.get_profiler()));
   return sz_value;
 }
 ts::Result<void> deserialize(Poly<const IBus_Descriptor>& value, ts::sz::Value const& sz_value)
@@ -7427,6 +8453,11 @@ ts::Result<void> deserialize(Poly<const INode_Descriptor>& value, ts::sz::Value
     value = Poly<const INode_Descriptor>(new KF_ECEF_Descriptor());
     return deserialize((KF_ECEF_Descriptor&)*value, *value_sz_value);
   }
+  else if (path == "::ESKF_ECEF_Descriptor")
+  {
+    value = Poly<const INode_Descriptor>(new ESKF_ECEF_Descriptor());
+    return deserialize((ESKF_ECEF_Descriptor&)*value, *value_sz_value);
+  }
   else if (path == "::ENU_Frame_System_Descriptor")
   {
     value = Poly<const INode_Descriptor>(new ENU_Frame_System_Descriptor());
@@ -7437,6 +8468,11 @@ ts::Result<void> deserialize(Poly<const INode_Descriptor>& value, ts::sz::Value
     value = Poly<const INode_Descriptor>(new LPF_Descriptor());
     return deserialize((LPF_Descriptor&)*value, *value_sz_value);
   }
+  else if (path == "::Dynamic_Notch_Descriptor")
+  {
+    value = Poly<const INode_Descriptor>(new Dynamic_Notch_Descriptor());
+    return deserialize((Dynamic_Notch_Descriptor&)*value, *value_sz_value);
+  }
   else if (path == "::MaxSonar_Descriptor")
   {
     value = Poly<const INode_Descriptor>(new MaxSonar_Descriptor());
@@ -7517,6 +8553,16 @@ ts::Result<void> deserialize(Poly<const INode_Descriptor>& value, ts::sz::Value
     value = Poly<const INode_Descriptor>(new Raspicam_Descriptor());
     return deserialize((Raspicam_Descriptor&)*value, *value_sz_value);
   }
+  else if (path == "::Recorder_Descriptor")
+  {
+    value = Poly<const INode_Descriptor>(new Recorder_Descriptor());
+    return deserialize((Recorder_Descriptor&)*value, *value_sz_value);
+  }
+  else if (path == "::Replay_Descriptor")
+  {
+    value = Poly<const INode_Descriptor>(new Replay_Descriptor());
+    return deserialize((Replay_Descriptor&)*value, *value_sz_value);
+  }
   else if (path == "::RC5T619_Descriptor")
   {
     value = Poly<const INode_Descriptor>(new RC5T619_Descriptor());
@@ -7636,6 +8682,13 @@ ts::sz::Value serialize(Poly<const INode_Descriptor> const& value)
     sz_value.add_object_member("value", serialize((KF_ECEF_Descriptor&)*value));
     return std::move(sz_value);
   }
+  else if (typeid(*value) == typeid(ESKF_ECEF_Descriptor))
+  {
+    sz_value.reserve_object_members(2);
+    sz_value.add_object_member("type", "::ESKF_ECEF_Descriptor");
+    sz_value.add_object_member("value", serialize((ESKF_ECEF_Descriptor&)*value));
+    return std::move(sz_value);
+  }
   else if (typeid(*value) == typeid(ENU_Frame_System_Descriptor))
   {
     sz_value.reserve_object_members(2);
@@ -7650,6 +8703,13 @@ ts::sz::Value serialize(Poly<const INode_Descriptor> const& value)
     sz_value.add_object_member("value", serialize((LPF_Descriptor&)*value));
     return std::move(sz_value);
   }
+  else if (typeid(*value) == typeid(Dynamic_Notch_Descriptor))
+  {
+    sz_value.reserve_object_members(2);
+    sz_value.add_object_member("type", "::Dynamic_Notch_Descriptor");
+    sz_value.add_object_member("value", serialize((Dynamic_Notch_Descriptor&)*value));
+    return std::move(sz_value);
+  }
   else if (typeid(*value) == typeid(MaxSonar_Descriptor))
   {
     sz_value.reserve_object_members(2);
@@ -7762,6 +8822,20 @@ ts::sz::Value serialize(Poly<const INode_Descriptor> const& value)
     sz_value.add_object_member("value", serialize((Raspicam_Descriptor&)*value));
     return std::move(sz_value);
   }
+  else if (typeid(*value) == typeid(Recorder_Descriptor))
+  {
+    sz_value.reserve_object_members(2);
+    sz_value.add_object_member("type", "::Recorder_Descriptor");
+    sz_value.add_object_member("value", serialize((Recorder_Descriptor&)*value));
+    return std::move(sz_value);
+  }
+  else if (typeid(*value) == typeid(Replay_Descriptor))
+  {
+    sz_value.reserve_object_members(2);
+    sz_value.add_object_member("type", "::Replay_Descriptor");
+    sz_value.add_object_member("value", serialize((Replay_Descriptor&)*value));
+    return std::move(sz_value);
+  }
   else if (typeid(*value) == typeid(RC5T619_Descriptor))
   {
     sz_value.reserve_object_members(2);
@@ -7891,6 +8965,11 @@ ts::Result<void> deserialize(Poly<const INode_Config>& value, ts::sz::Value cons
     value = Poly<const INode_Config>(new KF_ECEF_Config());
     return deserialize((KF_ECEF_Config&)*value, *value_sz_value);
   }
+  else if (path == "::ESKF_ECEF_Config")
+  {
+    value = Poly<const INode_Config>(new ESKF_ECEF_Config());
+    return deserialize((ESKF_ECEF_Config&)*value, *value_sz_value);
+  }
   else if (path == "::ENU_Frame_System_Config")
   {
     value = Poly<const INode_Config>(new ENU_Frame_System_Config());
@@ -7901,6 +8980,11 @@ ts::Result<void> deserialize(Poly<const INode_Config>& value, ts::sz::Value cons
     value = Poly<const INode_Config>(new LPF_Config());
     return deserialize((LPF_Config&)*value, *value_sz_value);
   }
+  else if (path == "::Dynamic_Notch_Config")
+  {
+    value = Poly<const INode_Config>(new Dynamic_Notch_Config());
+    return deserialize((Dynamic_Notch_Config&)*value, *value_sz_value);
+  }
   else if (path == "::MaxSonar_Config")
   {
     value = Poly<const INode_Config>(new MaxSonar_Config());
@@ -7981,6 +9065,16 @@ ts::Result<void> deserialize(Poly<const INode_Config>& value, ts::sz::Value cons
     value = Poly<const INode_Config>(new Raspicam_Config());
     return deserialize((Raspicam_Config&)*value, *value_sz_value);
   }
+  else if (path == "::Recorder_Config")
+  {
+    value = Poly<const INode_Config>(new Recorder_Config());
+    return deserialize((Recorder_Config&)*value, *value_sz_value);
+  }
+  else if (path == "::Replay_Config")
+  {
+    value = Poly<const INode_Config>(new Replay_Config());
+    return deserialize((Replay_Config&)*value, *value_sz_value);
+  }
   else if (path == "::RC5T619_Config")
   {
     value = Poly<const INode_Config>(new RC5T619_Config());
@@ -8100,6 +9194,13 @@ ts::sz::Value serialize(Poly<const INode_Config> const& value)
     sz_value.add_object_member("value", serialize((KF_ECEF_Config&)*value));
     return std::move(sz_value);
   }
+  else if (typeid(*value) == typeid(ESKF_ECEF_Config))
+  {
+    sz_value.reserve_object_members(2);
+    sz_value.add_object_member("type", "::ESKF_ECEF_Config");
+    sz_value.add_object_member("value", serialize((ESKF_ECEF_Config&)*value));
+    return std::move(sz_value);
+  }
   else if (typeid(*value) == typeid(ENU_Frame_System_Config))
   {
     sz_value.reserve_object_members(2);
@@ -8114,6 +9215,13 @@ ts::sz::Value serialize(Poly<const INode_Config> const& value)
     sz_value.add_object_member("value", serialize((LPF_Config&)*value));
     return std::move(sz_value);
   }
+  else if (typeid(*value) == typeid(Dynamic_Notch_Config))
+  {
+    sz_value.reserve_object_members(2);
+    sz_value.add_object_member("type", "::Dynamic_Notch_Config");
+    sz_value.add_object_member("value", serialize((Dynamic_Notch_Config&)*value));
+    return std::move(sz_value);
+  }
   else if (typeid(*value) == typeid(MaxSonar_Config))
   {
     sz_value.reserve_object_members(2);
@@ -8226,6 +9334,20 @@ ts::sz::Value serialize(Poly<const INode_Config> const& value)
     sz_value.add_object_member("value", serialize((Raspicam_Config&)*value));
     return std::move(sz_value);
   }
+  else if (typeid(*value) == typeid(Recorder_Config))
+  {
+    sz_value.reserve_object_members(2);
+    sz_value.add_object_member("type", "::Recorder_Config");
+    sz_value.add_object_member("value", serialize((Recorder_Config&)*value));
+    return std::move(sz_value);
+  }
+  else if (typeid(*value) == typeid(Replay_Config))
+  {
+    sz_value.reserve_object_members(2);
+    sz_value.add_object_member("type", "::Replay_Config");
+    sz_value.add_object_member("value", serialize((Replay_Config&)*value));
+    return std::move(sz_value);
+  }
   else if (typeid(*value) == typeid(RC5T619_Config))
   {
     sz_value.reserve_object_members(2);
@@ -8327,6 +9449,50 @@ ts::sz::Value serialize(std::vector<std::string> const& value)
   }
   return sz_value;
 }
+ts::Result<void> deserialize(std::vector<uint32_t>& value, ts::sz::Value const& sz_value)
+{
+  value.clear();
+  if (!sz_value.is_array()) { return ts::Error("Expected array value when deserializing"); }
+  value.resize(sz_value.get_array_element_count());
+  for (size_t i = 0; i < value.size(); i++)
+  {
+    auto result = deserialize(value[i], sz_value.get_array_element_value(i));
+    if (result != ts::success) { return result; }
+  }
+  return ts::success;
+}
+ts::sz::Value serialize(std::vector<uint32_t> const& value)
+{
+  ts::sz::Value sz_value(ts::sz::Value::Type::ARRAY);
+  sz_value.reserve_array_members(value.size());
+  for (size_t i = 0; i < value.size(); i++)
+  {
+    sz_value.add_array_element(serialize(value[i]));
+  }
+  return sz_value;
+}
+ts::Result<void> deserialize(std::vector<Settings::Thread_Profile>& value, ts::sz::Value const& sz_value)
+{
+  value.clear();
+  if (!sz_value.is_array()) { return ts::Error("Expected array value when deserializing"); }
+  value.resize(sz_value.get_array_element_count());
+  for (size_t i = 0; i < value.size(); i++)
+  {
+    auto result = deserialize(value[i], sz_value.get_array_element_value(i));
+    if (result != ts::success) { return result; }
+  }
+  return ts::success;
+}
+ts::sz::Value serialize(std::vector<Settings::Thread_Profile> const& value)
+{
+  ts::sz::Value sz_value(ts::sz::Value::Type::ARRAY);
+  sz_value.reserve_array_members(value.size());
+  for (size_t i = 0; i < value.size(); i++)
+  {
+    sz_value.add_array_element(serialize(value[i]));
+  }
+  return sz_value;
+}
 ts::Result<void> deserialize(Poly<const IUAV_Descriptor>& value, ts::sz::Value const& sz_value)
 {
   if (sz_value.is_empty()) { value = Poly<const IUAV_Descriptor>(); return ts::success; }
@@ -10033,27 +11199,92 @@ ts::sz::Value serialize(Comp_AHRS_Descriptor const& value)
   sz_value.add_object_member("rate", serialize(value.get_rate()));
   return sz_value;
 }
+ts::Result<void> deserialize(Comp_AHRS_Config::mode_t& value, ts::sz::Value const& sz_value)
+{
+  if (!sz_value.is_string()) { return ts::Error("Expected string value when deserializing"); }
+  std::string const& key = sz_value.get_as_string();
+  typedef Comp_AHRS_Config::mode_t _etype;
+  static std::map<std::string, _etype> s_map = {
+    { "COMPLEMENTARY", _etype::COMPLEMENTARY },
+    { "MAHONY", _etype::MAHONY },
+  };
+  auto it = s_map.find(key);
+  if (it == s_map.end()) { return ts::Error("Cannot find item " + key + " when deserializing"); }
+  value = it->second;
+  return ts::success;
+}
+ts::sz::Value serialize(Comp_AHRS_Config::mode_t const& value)
+{
+  typedef Comp_AHRS_Config::mode_t _etype;
+  static std::map<_etype, std::string> s_map = {
+    { _etype::COMPLEMENTARY, "COMPLEMENTARY" },
+    { _etype::MAHONY, "MAHONY" },
+  };
+  auto it = s_map.find(value);
+  if (it == s_map.end()) { TS_ASSERT(false); return ts::sz::Value(); }
+  return ts::sz::Value(it->second);
+}
 ts::Result<void> deserialize(Comp_AHRS_Config& value, ts::sz::Value const& sz_value)
 {
   if (!sz_value.is_object()) { return ts::Error("Expected object value when deserializing"); }
   for (size_t i = 0; i < sz_value.get_object_member_count(); i++)
   {
     ts::sz::Value const& member_sz_value = sz_value.get_object_member_value(i);
-    if (sz_value.get_object_member_name(i) == "drift_correction_factor")
+    if (sz_value.get_object_member_name(i) == "mode")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_mode())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_mode(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "drift_correction_factor")
     {
       std::remove_cv<std::remove_reference<decltype(value.get_drift_correction_factor())>::type>::type v;
       auto result = deserialize(v, member_sz_value);
       if (result != ts::success) { return result; }
       value.set_drift_correction_factor(std::move(v));
     }
+    else     if (sz_value.get_object_member_name(i) == "mahony_kp")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_mahony_kp())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_mahony_kp(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "mahony_ki")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_mahony_ki())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_mahony_ki(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "max_gyro_bias")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_max_gyro_bias())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_max_gyro_bias(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "magnetic_field_correction_rate")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_magnetic_field_correction_rate())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_magnetic_field_correction_rate(std::move(v));
+    }
   }
   return ts::success;
 }
 ts::sz::Value serialize(Comp_AHRS_Config const& value)
 {
   ts::sz::Value sz_value(ts::sz::Value::Type::OBJECT);
-  sz_value.reserve_object_members(1);
+  sz_value.reserve_object_members(6);
+  sz_value.add_object_member("mode", serialize(value.get_mode()));
   sz_value.add_object_member("drift_correction_factor", serialize(value.get_drift_correction_factor()));
+  sz_value.add_object_member("mahony_kp", serialize(value.get_mahony_kp()));
+  sz_value.add_object_member("mahony_ki", serialize(value.get_mahony_ki()));
+  sz_value.add_object_member("max_gyro_bias", serialize(value.get_max_gyro_bias()));
+  sz_value.add_object_member("magnetic_field_correction_rate", serialize(value.get_magnetic_field_correction_rate()));
   return sz_value;
 }
 ts::Result<void> deserialize(Combiner_Descriptor& value, ts::sz::Value const& sz_value)
@@ -10126,13 +11357,99 @@ ts::Result<void> deserialize(Gravity_Filter_Config& value, ts::sz::Value const&
   }
   return ts::success;
 }
-ts::sz::Value serialize(Gravity_Filter_Config const& value)
+ts::sz::Value serialize(Gravity_Filter_Config const& value)
+{
+  ts::sz::Value sz_value(ts::sz::Value::Type::OBJECT);
+  sz_value.reserve_object_members(0);
+  return sz_value;
+}
+ts::Result<void> deserialize(KF_ECEF_Descriptor& value, ts::sz::Value const& sz_value)
+{
+  if (!sz_value.is_object()) { return ts::Error("Expected object value when deserializing"); }
+  for (size_t i = 0; i < sz_value.get_object_member_count(); i++)
+  {
+    ts::sz::Value const& member_sz_value = sz_value.get_object_member_value(i);
+    if (sz_value.get_object_member_name(i) == "rate")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_rate())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_rate(std::move(v));
+    }
+  }
+  return ts::success;
+}
+ts::sz::Value serialize(KF_ECEF_Descriptor const& value)
+{
+  ts::sz::Value sz_value(ts::sz::Value::Type::OBJECT);
+  sz_value.reserve_object_members(1);
+  sz_value.add_object_member("rate", serialize(value.get_rate()));
+  return sz_value;
+}
+ts::Result<void> deserialize(KF_ECEF_Config& value, ts::sz::Value const& sz_value)
+{
+  if (!sz_value.is_object()) { return ts::Error("Expected object value when deserializing"); }
+  for (size_t i = 0; i < sz_value.get_object_member_count(); i++)
+  {
+    ts::sz::Value const& member_sz_value = sz_value.get_object_member_value(i);
+    if (sz_value.get_object_member_name(i) == "gps_position_lag")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_gps_position_lag())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_gps_position_lag(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "gps_position_accuracy")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_gps_position_accuracy())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_gps_position_accuracy(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "gps_velocity_lag")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_gps_velocity_lag())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_gps_velocity_lag(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "gps_velocity_accuracy")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_gps_velocity_accuracy())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_gps_velocity_accuracy(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "acceleration_lag")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_acceleration_lag())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_acceleration_lag(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "acceleration_accuracy")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_acceleration_accuracy())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_acceleration_accuracy(std::move(v));
+    }
+  }
+  return ts::success;
+}
+ts::sz::Value serialize(KF_ECEF_Config const& value)
 {
   ts::sz::Value sz_value(ts::sz::Value::Type::OBJECT);
-  sz_value.reserve_object_members(0);
+  sz_value.reserve_object_members(6);
+  sz_value.add_object_member("gps_position_lag", serialize(value.get_gps_position_lag()));
+  sz_value.add_object_member("gps_position_accuracy", serialize(value.get_gps_position_accuracy()));
+  sz_value.add_object_member("gps_velocity_lag", serialize(value.get_gps_velocity_lag()));
+  sz_value.add_object_member("gps_velocity_accuracy", serialize(value.get_gps_velocity_accuracy()));
+  sz_value.add_object_member("acceleration_lag", serialize(value.get_acceleration_lag()));
+  sz_value.add_object_member("acceleration_accuracy", serialize(value.get_acceleration_accuracy()));
   return sz_value;
 }
-ts::Result<void> deserialize(KF_ECEF_Descriptor& value, ts::sz::Value const& sz_value)
+ts::Result<void> deserialize(ESKF_ECEF_Descriptor& value, ts::sz::Value const& sz_value)
 {
   if (!sz_value.is_object()) { return ts::Error("Expected object value when deserializing"); }
   for (size_t i = 0; i < sz_value.get_object_member_count(); i++)
@@ -10148,25 +11465,25 @@ ts::Result<void> deserialize(KF_ECEF_Descriptor& value, ts::sz::Value const& sz_
   }
   return ts::success;
 }
-ts::sz::Value serialize(KF_ECEF_Descriptor const& value)
+ts::sz::Value serialize(ESKF_ECEF_Descriptor const& value)
 {
   ts::sz::Value sz_value(ts::sz::Value::Type::OBJECT);
   sz_value.reserve_object_members(1);
   sz_value.add_object_member("rate", serialize(value.get_rate()));
   return sz_value;
 }
-ts::Result<void> deserialize(KF_ECEF_Config& value, ts::sz::Value const& sz_value)
+ts::Result<void> deserialize(ESKF_ECEF_Config& value, ts::sz::Value const& sz_value)
 {
   if (!sz_value.is_object()) { return ts::Error("Expected object value when deserializing"); }
   for (size_t i = 0; i < sz_value.get_object_member_count(); i++)
   {
     ts::sz::Value const& member_sz_value = sz_value.get_object_member_value(i);
-    if (sz_value.get_object_member_name(i) == "gps_position_lag")
+    if (sz_value.get_object_member_name(i) == "gps_lag")
     {
-      std::remove_cv<std::remove_reference<decltype(value.get_gps_position_lag())>::type>::type v;
+      std::remove_cv<std::remove_reference<decltype(value.get_gps_lag())>::type>::type v;
       auto result = deserialize(v, member_sz_value);
       if (result != ts::success) { return result; }
-      value.set_gps_position_lag(std::move(v));
+      value.set_gps_lag(std::move(v));
     }
     else     if (sz_value.get_object_member_name(i) == "gps_position_accuracy")
     {
@@ -10175,26 +11492,26 @@ ts::Result<void> deserialize(KF_ECEF_Config& value, ts::sz::Value const& sz_valu
       if (result != ts::success) { return result; }
       value.set_gps_position_accuracy(std::move(v));
     }
-    else     if (sz_value.get_object_member_name(i) == "gps_velocity_lag")
+    else     if (sz_value.get_object_member_name(i) == "gps_velocity_accuracy")
     {
-      std::remove_cv<std::remove_reference<decltype(value.get_gps_velocity_lag())>::type>::type v;
+      std::remove_cv<std::remove_reference<decltype(value.get_gps_velocity_accuracy())>::type>::type v;
       auto result = deserialize(v, member_sz_value);
       if (result != ts::success) { return result; }
-      value.set_gps_velocity_lag(std::move(v));
+      value.set_gps_velocity_accuracy(std::move(v));
     }
-    else     if (sz_value.get_object_member_name(i) == "gps_velocity_accuracy")
+    else     if (sz_value.get_object_member_name(i) == "baro_lag")
     {
-      std::remove_cv<std::remove_reference<decltype(value.get_gps_velocity_accuracy())>::type>::type v;
+      std::remove_cv<std::remove_reference<decltype(value.get_baro_lag())>::type>::type v;
       auto result = deserialize(v, member_sz_value);
       if (result != ts::success) { return result; }
-      value.set_gps_velocity_accuracy(std::move(v));
+      value.set_baro_lag(std::move(v));
     }
-    else     if (sz_value.get_object_member_name(i) == "acceleration_lag")
+    else     if (sz_value.get_object_member_name(i) == "baro_accuracy")
     {
-      std::remove_cv<std::remove_reference<decltype(value.get_acceleration_lag())>::type>::type v;
+      std::remove_cv<std::remove_reference<decltype(value.get_baro_accuracy())>::type>::type v;
       auto result = deserialize(v, member_sz_value);
       if (result != ts::success) { return result; }
-      value.set_acceleration_lag(std::move(v));
+      value.set_baro_accuracy(std::move(v));
     }
     else     if (sz_value.get_object_member_name(i) == "acceleration_accuracy")
     {
@@ -10206,15 +11523,15 @@ ts::Result<void> deserialize(KF_ECEF_Config& value, ts::sz::Value const& sz_valu
   }
   return ts::success;
 }
-ts::sz::Value serialize(KF_ECEF_Config const& value)
+ts::sz::Value serialize(ESKF_ECEF_Config const& value)
 {
   ts::sz::Value sz_value(ts::sz::Value::Type::OBJECT);
   sz_value.reserve_object_members(6);
-  sz_value.add_object_member("gps_position_lag", serialize(value.get_gps_position_lag()));
+  sz_value.add_object_member("gps_lag", serialize(value.get_gps_lag()));
   sz_value.add_object_member("gps_position_accuracy", serialize(value.get_gps_position_accuracy()));
-  sz_value.add_object_member("gps_velocity_lag", serialize(value.get_gps_velocity_lag()));
   sz_value.add_object_member("gps_velocity_accuracy", serialize(value.get_gps_velocity_accuracy()));
-  sz_value.add_object_member("acceleration_lag", serialize(value.get_acceleration_lag()));
+  sz_value.add_object_member("baro_lag", serialize(value.get_baro_lag()));
+  sz_value.add_object_member("baro_accuracy", serialize(value.get_baro_accuracy()));
   sz_value.add_object_member("acceleration_accuracy", serialize(value.get_acceleration_accuracy()));
   return sz_value;
 }
@@ -10310,6 +11627,76 @@ ts::sz::Value serialize(LPF_Config const& value)
   sz_value.add_object_member("cutoff_frequency", serialize(value.get_cutoff_frequency()));
   return sz_value;
 }
+ts::Result<void> deserialize(Dynamic_Notch_Descriptor& value, ts::sz::Value const& sz_value)
+{
+  if (!sz_value.is_object()) { return ts::Error("Expected object value when deserializing"); }
+  for (size_t i = 0; i < sz_value.get_object_member_count(); i++)
+  {
+    ts::sz::Value const& member_sz_value = sz_value.get_object_member_value(i);
+    if (sz_value.get_object_member_name(i) == "rate")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_rate())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_rate(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "notch_count")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_notch_count())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_notch_count(std::move(v));
+    }
+  }
+  return ts::success;
+}
+ts::sz::Value serialize(Dynamic_Notch_Descriptor const& value)
+{
+  ts::sz::Value sz_value(ts::sz::Value::Type::OBJECT);
+  sz_value.reserve_object_members(2);
+  sz_value.add_object_member("rate", serialize(value.get_rate()));
+  sz_value.add_object_member("notch_count", serialize(value.get_notch_count()));
+  return sz_value;
+}
+ts::Result<void> deserialize(Dynamic_Notch_Config& value, ts::sz::Value const& sz_value)
+{
+  if (!sz_value.is_object()) { return ts::Error("Expected object value when deserializing"); }
+  for (size_t i = 0; i < sz_value.get_object_member_count(); i++)
+  {
+    ts::sz::Value const& member_sz_value = sz_value.get_object_member_value(i);
+    if (sz_value.get_object_member_name(i) == "min_frequency")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_min_frequency())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_min_frequency(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "max_frequency")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_max_frequency())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_max_frequency(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "q")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_q())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_q(std::move(v));
+    }
+  }
+  return ts::success;
+}
+ts::sz::Value serialize(Dynamic_Notch_Config const& value)
+{
+  ts::sz::Value sz_value(ts::sz::Value::Type::OBJECT);
+  sz_value.reserve_object_members(3);
+  sz_value.add_object_member("min_frequency", serialize(value.get_min_frequency()));
+  sz_value.add_object_member("max_frequency", serialize(value.get_max_frequency()));
+  sz_value.add_object_member("q", serialize(value.get_q()));
+  return sz_value;
+}
 ts::Result<void> deserialize(MaxSonar_Descriptor& value, ts::sz::Value const& sz_value)
 {
   if (!sz_value.is_object()) { return ts::Error("Expected object value when deserializing"); }
@@ -10403,13 +11790,45 @@ ts::sz::Value serialize(Motor_Mixer_Descriptor const& value)
   sz_value.add_object_member("rate", serialize(value.get_rate()));
   return sz_value;
 }
+ts::Result<void> deserialize(Motor_Mixer_Config::mode_t& value, ts::sz::Value const& sz_value)
+{
+  if (!sz_value.is_string()) { return ts::Error("Expected string value when deserializing"); }
+  std::string const& key = sz_value.get_as_string();
+  typedef Motor_Mixer_Config::mode_t _etype;
+  static std::map<std::string, _etype> s_map = {
+    { "ITERATIVE", _etype::ITERATIVE },
+    { "PSEUDO_INVERSE", _etype::PSEUDO_INVERSE },
+  };
+  auto it = s_map.find(key);
+  if (it == s_map.end()) { return ts::Error("Cannot find item " + key + " when deserializing"); }
+  value = it->second;
+  return ts::success;
+}
+ts::sz::Value serialize(Motor_Mixer_Config::mode_t const& value)
+{
+  typedef Motor_Mixer_Config::mode_t _etype;
+  static std::map<_etype, std::string> s_map = {
+    { _etype::ITERATIVE, "ITERATIVE" },
+    { _etype::PSEUDO_INVERSE, "PSEUDO_INVERSE" },
+  };
+  auto it = s_map.find(value);
+  if (it == s_map.end()) { TS_ASSERT(false); return ts::sz::Value(); }
+  return ts::sz::Value(it->second);
+}
 ts::Result<void> deserialize(Motor_Mixer_Config& value, ts::sz::Value const& sz_value)
 {
   if (!sz_value.is_object()) { return ts::Error("Expected object value when deserializing"); }
   for (size_t i = 0; i < sz_value.get_object_member_count(); i++)
   {
     ts::sz::Value const& member_sz_value = sz_value.get_object_member_value(i);
-    if (sz_value.get_object_member_name(i) == "armed_thrust")
+    if (sz_value.get_object_member_name(i) == "mode")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_mode())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_mode(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "armed_thrust")
     {
       std::remove_cv<std::remove_reference<decltype(value.get_armed_thrust())>::type>::type v;
       auto result = deserialize(v, member_sz_value);
@@ -10422,7 +11841,8 @@ ts::Result<void> deserialize(Motor_Mixer_Config& value, ts::sz::Value const& sz_
 ts::sz::Value serialize(Motor_Mixer_Config const& value)
 {
   ts::sz::Value sz_value(ts::sz::Value::Type::OBJECT);
-  sz_value.reserve_object_members(1);
+  sz_value.reserve_object_members(2);
+  sz_value.add_object_member("mode", serialize(value.get_mode()));
   sz_value.add_object_member("armed_thrust", serialize(value.get_armed_thrust()));
   return sz_value;
 }
@@ -10721,13 +12141,20 @@ ts::Result<void> deserialize(MPU9250_Descriptor& value, ts::sz::Value const& sz_
       if (result != ts::success) { return result; }
       value.set_angular_velocity_range(std::move(v));
     }
+    else     if (sz_value.get_object_member_name(i) == "data_ready_gpio")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_data_ready_gpio())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_data_ready_gpio(std::move(v));
+    }
   }
   return ts::success;
 }
 ts::sz::Value serialize(MPU9250_Descriptor const& value)
 {
   ts::sz::Value sz_value(ts::sz::Value::Type::OBJECT);
-  sz_value.reserve_object_members(7);
+  sz_value.reserve_object_members(8);
   sz_value.add_object_member("bus", serialize(value.get_bus()));
   sz_value.add_object_member("i2c_address", serialize(value.get_i2c_address()));
   sz_value.add_object_member("imu_rate", serialize(value.get_imu_rate()));
@@ -10735,6 +12162,7 @@ ts::sz::Value serialize(MPU9250_Descriptor const& value)
   sz_value.add_object_member("thermometer_rate", serialize(value.get_thermometer_rate()));
   sz_value.add_object_member("acceleration_range", serialize(value.get_acceleration_range()));
   sz_value.add_object_member("angular_velocity_range", serialize(value.get_angular_velocity_range()));
+  sz_value.add_object_member("data_ready_gpio", serialize(value.get_data_ready_gpio()));
   return sz_value;
 }
 ts::Result<void> deserialize(MPU9250_Config::Calibration& value, ts::sz::Value const& sz_value)
@@ -13360,6 +14788,163 @@ ts::sz::Value serialize(Raspicam_Config const& value)
   sz_value.add_object_member("vflip", serialize(value.get_vflip()));
   return sz_value;
 }
+ts::Result<void> deserialize(Recorder_Descriptor& value, ts::sz::Value const& sz_value)
+{
+  if (!sz_value.is_object()) { return ts::Error("Expected object value when deserializing"); }
+  for (size_t i = 0; i < sz_value.get_object_member_count(); i++)
+  {
+    ts::sz::Value const& member_sz_value = sz_value.get_object_member_value(i);
+    if (sz_value.get_object_member_name(i) == "input_count")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_input_count())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_input_count(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "directory")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_directory())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_directory(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "chunk_size")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_chunk_size())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_chunk_size(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "chunk_buffer_count")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_chunk_buffer_count())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_chunk_buffer_count(std::move(v));
+    }
+  }
+  return ts::success;
+}
+ts::sz::Value serialize(Recorder_Descriptor const& value)
+{
+  ts::sz::Value sz_value(ts::sz::Value::Type::OBJECT);
+  sz_value.reserve_object_members(4);
+  sz_value.add_object_member("input_count", serialize(value.get_input_count()));
+  sz_value.add_object_member("directory", serialize(value.get_directory()));
+  sz_value.add_object_member("chunk_size", serialize(value.get_chunk_size()));
+  sz_value.add_object_member("chunk_buffer_count", serialize(value.get_chunk_buffer_count()));
+  return sz_value;
+}
+ts::Result<void> deserialize(Recorder_Config& value, ts::sz::Value const& sz_value)
+{
+  if (!sz_value.is_object()) { return ts::Error("Expected object value when deserializing"); }
+  for (size_t i = 0; i < sz_value.get_object_member_count(); i++)
+  {
+    ts::sz::Value const& member_sz_value = sz_value.get_object_member_value(i);
+    if (sz_value.get_object_member_name(i) == "is_recording")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_is_recording())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_is_recording(std::move(v));
+    }
+  }
+  return ts::success;
+}
+ts::sz::Value serialize(Recorder_Config const& value)
+{
+  ts::sz::Value sz_value(ts::sz::Value::Type::OBJECT);
+  sz_value.reserve_object_members(1);
+  sz_value.add_object_member("is_recording", serialize(value.get_is_recording()));
+  return sz_value;
+}
+ts::Result<void> deserialize(Replay_Descriptor::clock_t& value, ts::sz::Value const& sz_value)
+{
+  if (!sz_value.is_string()) { return ts::Error("Expected string value when deserializing"); }
+  std::string const& key = sz_value.get_as_string();
+  typedef Replay_Descriptor::clock_t _etype;
+  static std::map<std::string, _etype> s_map = {
+    { "REAL_TIME", _etype::REAL_TIME },
+    { "AS_FAST_AS_POSSIBLE", _etype::AS_FAST_AS_POSSIBLE },
+  };
+  auto it = s_map.find(key);
+  if (it == s_map.end()) { return ts::Error("Cannot find item " + key + " when deserializing"); }
+  value = it->second;
+  return ts::success;
+}
+ts::sz::Value serialize(Replay_Descriptor::clock_t const& value)
+{
+  typedef Replay_Descriptor::clock_t _etype;
+  static std::map<_etype, std::string> s_map = {
+    { _etype::REAL_TIME, "REAL_TIME" },
+    { _etype::AS_FAST_AS_POSSIBLE, "AS_FAST_AS_POSSIBLE" },
+  };
+  auto it = s_map.find(value);
+  if (it == s_map.end()) { TS_ASSERT(false); return ts::sz::Value(); }
+  return ts::sz::Value(it->second);
+}
+ts::Result<void> deserialize(Replay_Descriptor& value, ts::sz::Value const& sz_value)
+{
+  if (!sz_value.is_object()) { return ts::Error("Expected object value when deserializing"); }
+  for (size_t i = 0; i < sz_value.get_object_member_count(); i++)
+  {
+    ts::sz::Value const& member_sz_value = sz_value.get_object_member_value(i);
+    if (sz_value.get_object_member_name(i) == "path")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_path())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_path(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "clock")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_clock())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_clock(std::move(v));
+    }
+  }
+  return ts::success;
+}
+ts::sz::Value serialize(Replay_Descriptor const& value)
+{
+  ts::sz::Value sz_value(ts::sz::Value::Type::OBJECT);
+  sz_value.reserve_object_members(2);
+  sz_value.add_object_member("path", serialize(value.get_path()));
+  sz_value.add_object_member("clock", serialize(value.get_clock()));
+  return sz_value;
+}
+ts::Result<void> deserialize(Replay_Config& value, ts::sz::Value const& sz_value)
+{
+  if (!sz_value.is_object()) { return ts::Error("Expected object value when deserializing"); }
+  for (size_t i = 0; i < sz_value.get_object_member_count(); i++)
+  {
+    ts::sz::Value const& member_sz_value = sz_value.get_object_member_value(i);
+    if (sz_value.get_object_member_name(i) == "speed")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_speed())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_speed(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "loop")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_loop())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_loop(std::move(v));
+    }
+  }
+  return ts::success;
+}
+ts::sz::Value serialize(Replay_Config const& value)
+{
+  ts::sz::Value sz_value(ts::sz::Value::Type::OBJECT);
+  sz_value.reserve_object_members(2);
+  sz_value.add_object_member("speed", serialize(value.get_speed()));
+  sz_value.add_object_member("loop", serialize(value.get_loop()));
+  return sz_value;
+}
 ts::Result<void> deserialize(RC5T619_Descriptor& value, ts::sz::Value const& sz_value)
 {
   if (!sz_value.is_object()) { return ts::Error("Expected object value when deserializing"); }
@@ -13445,27 +15030,68 @@ ts::sz::Value serialize(Resampler_Descriptor const& value)
   sz_value.add_object_member("output_rate", serialize(value.get_output_rate()));
   return sz_value;
 }
+ts::Result<void> deserialize(Resampler_Config::mode_t& value, ts::sz::Value const& sz_value)
+{
+  if (!sz_value.is_string()) { return ts::Error("Expected string value when deserializing"); }
+  std::string const& key = sz_value.get_as_string();
+  typedef Resampler_Config::mode_t _etype;
+  static std::map<std::string, _etype> s_map = {
+    { "HOLD_LPF", _etype::HOLD_LPF },
+    { "POLYPHASE_FIR", _etype::POLYPHASE_FIR },
+  };
+  auto it = s_map.find(key);
+  if (it == s_map.end()) { return ts::Error("Cannot find item " + key + " when deserializing"); }
+  value = it->second;
+  return ts::success;
+}
+ts::sz::Value serialize(Resampler_Config::mode_t const& value)
+{
+  typedef Resampler_Config::mode_t _etype;
+  static std::map<_etype, std::string> s_map = {
+    { _etype::HOLD_LPF, "HOLD_LPF" },
+    { _etype::POLYPHASE_FIR, "POLYPHASE_FIR" },
+  };
+  auto it = s_map.find(value);
+  if (it == s_map.end()) { TS_ASSERT(false); return ts::sz::Value(); }
+  return ts::sz::Value(it->second);
+}
 ts::Result<void> deserialize(Resampler_Config& value, ts::sz::Value const& sz_value)
 {
   if (!sz_value.is_object()) { return ts::Error("Expected object value when deserializing"); }
   for (size_t i = 0; i < sz_value.get_object_member_count(); i++)
   {
     ts::sz::Value const& member_sz_value = sz_value.get_object_member_value(i);
-    if (sz_value.get_object_member_name(i) == "lpf")
+    if (sz_value.get_object_member_name(i) == "mode")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_mode())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_mode(std::move(v));
+    }
+    else     if (sz_value.get_object_member_name(i) == "lpf")
     {
       std::remove_cv<std::remove_reference<decltype(value.get_lpf())>::type>::type v;
       auto result = deserialize(v, member_sz_value);
       if (result != ts::success) { return result; }
       value.set_lpf(std::move(v));
     }
+    else     if (sz_value.get_object_member_name(i) == "fir_zero_crossings")
+    {
+      std::remove_cv<std::remove_reference<decltype(value.get_fir_zero_crossings())>::type>::type v;
+      auto result = deserialize(v, member_sz_value);
+      if (result != ts::success) { return result; }
+      value.set_fir_zero_crossings(std::move(v));
+    }
   }
   return ts::success;
 }
 ts::sz::Value serialize(Resampler_Config const& value)
 {
   ts::sz::Value sz_value(ts::sz::Value::Type::OBJECT);
-  sz_value.reserve_object_members(1);
+  sz_value.reserve_object_members(3);
+  sz_value.add_object_member("mode", serialize(value.get_mode()));
   sz_value.add_object_member("lpf", serialize(value.get_lpf()));
+  sz_value.add_object_member("fir_zero_crossings", serialize(value.get_fir_zero_crossings()));
   return sz_value;
 }
 ts::Result<void> deserialize(Scalar_Generator_Descriptor& value, ts::sz::Value const& sz_value)
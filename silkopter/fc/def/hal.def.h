@@ -249,6 +249,118 @@ public:
     std::vector<std::string> m_input_paths;
   };
 
+  struct Frame_Trace
+  {
+  public:
+    virtual ~Frame_Trace() = default;
+    void set_is_enabled(bool const& value);
+    void set_is_enabled(bool&& value);
+    auto get_is_enabled() const -> bool const&;
+
+    void set_deadline_us(uint32_t const& value);
+    void set_deadline_us(uint32_t&& value);
+    auto get_deadline_us() const -> uint32_t const&;
+
+  private:
+    bool m_is_enabled = bool{true};
+    uint32_t m_deadline_us = uint32_t{10000};
+  };
+
+  struct Real_Time
+  {
+  public:
+    virtual ~Real_Time() = default;
+    void set_is_strict(bool const& value);
+    void set_is_strict(bool&& value);
+    auto get_is_strict() const -> bool const&;
+
+    void set_warmup_ms(uint32_t const& value);
+    void set_warmup_ms(uint32_t&& value);
+    auto get_warmup_ms() const -> uint32_t const&;
+
+  private:
+    bool m_is_strict = bool{false};
+    uint32_t m_warmup_ms = uint32_t{5000};
+  };
+
+  struct Thread_Profile
+  {
+  public:
+    enum class policy_t
+    {
+      OTHER = 0,
+      BATCH = 1,
+      IDLE = 2,
+      FIFO = 3,
+      RR = 4,
+    };
+
+    typedef int64_t priority_t;
+    virtual ~Thread_Profile() = default;
+    void set_name(std::string const& value);
+    void set_name(std::string&& value);
+    auto get_name() const -> std::string const&;
+
+    void set_policy(policy_t const& value);
+    void set_policy(policy_t&& value);
+    auto get_policy() const -> policy_t const&;
+
+    void set_priority(priority_t const& value);
+    void set_priority(priority_t&& value);
+    auto get_priority() const -> priority_t const&;
+
+    void set_cpus(std::vector<uint32_t> const& value);
+    void set_cpus(std::vector<uint32_t>&& value);
+    auto get_cpus() const -> std::vector<uint32_t> const&;
+    auto get_cpus() -> std::vector<uint32_t>&;
+
+  private:
+    std::string m_name;
+    policy_t m_policy = policy_t{Settings::Thread_Profile::policy_t::OTHER};
+    priority_t m_priority = priority_t{0};
+    std::vector<uint32_t> m_cpus;
+  };
+
+  struct Threads
+  {
+  public:
+    virtual ~Threads() = default;
+    void set_lock_memory(bool const& value);
+    void set_lock_memory(bool&& value);
+    auto get_lock_memory() const -> bool const&;
+
+    void set_profiles(std::vector<Settings::Thread_Profile> const& value);
+    void set_profiles(std::vector<Settings::Thread_Profile>&& value);
+    auto get_profiles() const -> std::vector<Settings::Thread_Profile> const&;
+    auto get_profiles() -> std::vector<Settings::Thread_Profile>&;
+
+  private:
+    bool m_lock_memory = bool{true};
+    std::vector<Settings::Thread_Profile> m_profiles;
+  };
+
+  struct Profiler
+  {
+  public:
+    virtual ~Profiler() = default;
+    void set_is_enabled(bool const& value);
+    void set_is_enabled(bool&& value);
+    auto get_is_enabled() const -> bool const&;
+
+    void set_write_trace(bool const& value);
+    void set_write_trace(bool&& value);
+    auto get_write_trace() const -> bool const&;
+
+    void set_summary_period_ms(uint32_t const& value);
+    void set_summary_period_ms(uint32_t&& value);
+    auto get_summary_period_ms() const -> uint32_t const&;
+
+  private:
+    bool m_is_enabled = bool{false};
+    bool m_write_trace = bool{true};
+    uint32_t m_summary_period_ms = uint32_t{0};
+  };
+
   virtual ~Settings() = default;
   void set_uav_descriptor(Poly<const IUAV_Descriptor> const& value);
   void set_uav_descriptor(Poly<const IUAV_Descriptor>&& value);
@@ -265,10 +377,34 @@ public:
   auto get_nodes() const -> std::vector<Settings::Node_Data> const&;
   auto get_nodes() -> std::vector<Settings::Node_Data>&;
 
+  void set_frame_trace(Frame_Trace const& value);
+  void set_frame_trace(Frame_Trace&& value);
+  auto get_frame_trace() const -> Frame_Trace const&;
+  auto get_frame_trace() -> Frame_Trace&;
+
+  void set_real_time(Real_Time const& value);
+  void set_real_time(Real_Time&& value);
+  auto get_real_time() const -> Real_Time const&;
+  auto get_real_time() -> Real_Time&;
+
+  void set_threads(Threads const& value);
+  void set_threads(Threads&& value);
+  auto get_threads() const -> Threads const&;
+  auto get_threads() -> Threads&;
+
+  void set_profiler(Profiler const& value);
+  void set_profiler(Profiler&& value);
+  auto get_profiler() const -> Profiler const&;
+  auto get_profiler() -> Profiler&;
+
 private:
   Poly<const IUAV_Descriptor> m_uav_descriptor;
   std::vector<Settings::Bus_Data> m_buses;
   std::vector<Settings::Node_Data> m_nodes;
+  Frame_Trace m_frame_trace;
+  Real_Time m_real_time;
+  Threads m_threads;
+  Profiler m_profiler;
 };
 
 struct Multirotor_Descriptor : public IUAV_Descriptor
@@ -775,13 +911,46 @@ private:
 struct Comp_AHRS_Config : public INode_Config
 {
 public:
+  enum class mode_t
+  {
+    COMPLEMENTARY = 0,
+    MAHONY = 1,
+  };
+
+  typedef float gain_t;
+  typedef uint32_t rate_t;
   virtual ~Comp_AHRS_Config() = default;
+  void set_mode(mode_t const& value);
+  void set_mode(mode_t&& value);
+  auto get_mode() const -> mode_t const&;
+
   void set_drift_correction_factor(muf_t const& value);
   void set_drift_correction_factor(muf_t&& value);
   auto get_drift_correction_factor() const -> muf_t const&;
 
+  void set_mahony_kp(gain_t const& value);
+  void set_mahony_kp(gain_t&& value);
+  auto get_mahony_kp() const -> gain_t const&;
+
+  void set_mahony_ki(gain_t const& value);
+  void set_mahony_ki(gain_t&& value);
+  auto get_mahony_ki() const -> gain_t const&;
+
+  void set_max_gyro_bias(ufloat const& value);
+  void set_max_gyro_bias(ufloat&& value);
+  auto get_max_gyro_bias() const -> ufloat const&;
+
+  void set_magnetic_field_correction_rate(uint32_t const& value);
+  void set_magnetic_field_correction_rate(uint32_t&& value);
+  auto get_magnetic_field_correction_rate() const -> uint32_t const&;
+
 private:
+  mode_t m_mode = mode_t{Comp_AHRS_Config::mode_t::COMPLEMENTARY};
   muf_t m_drift_correction_factor = muf_t{0.300000f};
+  gain_t m_mahony_kp = gain_t{1.000000f};
+  gain_t m_mahony_ki = gain_t{0.050000f};
+  ufloat m_max_gyro_bias = ufloat{0.200000f};
+  uint32_t m_magnetic_field_correction_rate = uint32_t{50};
 };
 
 struct Combiner_Descriptor : public INode_Descriptor
@@ -874,6 +1043,56 @@ private:
   ufloat m_acceleration_accuracy = ufloat{2.000000f};
 };
 
+struct ESKF_ECEF_Descriptor : public INode_Descriptor
+{
+public:
+  typedef uint32_t rate_t;
+  virtual ~ESKF_ECEF_Descriptor() = default;
+  void set_rate(uint32_t const& value);
+  void set_rate(uint32_t&& value);
+  auto get_rate() const -> uint32_t const&;
+
+private:
+  uint32_t m_rate = uint32_t{1};
+};
+
+struct ESKF_ECEF_Config : public INode_Config
+{
+public:
+  virtual ~ESKF_ECEF_Config() = default;
+  void set_gps_lag(ufloat const& value);
+  void set_gps_lag(ufloat&& value);
+  auto get_gps_lag() const -> ufloat const&;
+
+  void set_gps_position_accuracy(ufloat const& value);
+  void set_gps_position_accuracy(ufloat&& value);
+  auto get_gps_position_accuracy() const -> ufloat const&;
+
+  void set_gps_velocity_accuracy(ufloat const& value);
+  void set_gps_velocity_accuracy(ufloat&& value);
+  auto get_gps_velocity_accuracy() const -> ufloat const&;
+
+  void set_baro_lag(ufloat const& value);
+  void set_baro_lag(ufloat&& value);
+  auto get_baro_lag() const -> ufloat const&;
+
+  void set_baro_accuracy(ufloat const& value);
+  void set_baro_accuracy(ufloat&& value);
+  auto get_baro_accuracy() const -> ufloat const&;
+
+  void set_acceleration_accuracy(ufloat const& value);
+  void set_acceleration_accuracy(ufloat&& value);
+  auto get_acceleration_accuracy() const -> ufloat const&;
+
+private:
+  ufloat m_gps_lag = ufloat{0.100000f};
+  ufloat m_gps_position_accuracy = ufloat{2.000000f};
+  ufloat m_gps_velocity_accuracy = ufloat{0.200000f};
+  ufloat m_baro_lag = ufloat{0};
+  ufloat m_baro_accuracy = ufloat{0.500000f};
+  ufloat m_acceleration_accuracy = ufloat{2.000000f};
+};
+
 struct ENU_Frame_System_Descriptor : public INode_Descriptor
 {
 public:
@@ -925,6 +1144,48 @@ private:
   ufloat m_cutoff_frequency = ufloat{1.000000f};
 };
 
+struct Dynamic_Notch_Descriptor : public INode_Descriptor
+{
+public:
+  typedef uint32_t rate_t;
+  typedef uint32_t notch_count_t;
+  virtual ~Dynamic_Notch_Descriptor() = default;
+  void set_rate(uint32_t const& value);
+  void set_rate(uint32_t&& value);
+  auto get_rate() const -> uint32_t const&;
+
+  void set_notch_count(notch_count_t const& value);
+  void set_notch_count(notch_count_t&& value);
+  auto get_notch_count() const -> notch_count_t const&;
+
+private:
+  uint32_t m_rate = uint32_t{1};
+  notch_count_t m_notch_count = notch_count_t{2};
+};
+
+struct Dynamic_Notch_Config : public INode_Config
+{
+public:
+  typedef float q_t;
+  virtual ~Dynamic_Notch_Config() = default;
+  void set_min_frequency(ufloat const& value);
+  void set_min_frequency(ufloat&& value);
+  auto get_min_frequency() const -> ufloat const&;
+
+  void set_max_frequency(ufloat const& value);
+  void set_max_frequency(ufloat&& value);
+  auto get_max_frequency() const -> ufloat const&;
+
+  void set_q(q_t const& value);
+  void set_q(q_t&& value);
+  auto get_q() const -> q_t const&;
+
+private:
+  ufloat m_min_frequency = ufloat{80.000000f};
+  ufloat m_max_frequency = ufloat{400.000000f};
+  q_t m_q = q_t{4.000000f};
+};
+
 struct MaxSonar_Descriptor : public INode_Descriptor
 {
 public:
@@ -981,12 +1242,23 @@ private:
 struct Motor_Mixer_Config : public INode_Config
 {
 public:
+  enum class mode_t
+  {
+    ITERATIVE = 0,
+    PSEUDO_INVERSE = 1,
+  };
+
   virtual ~Motor_Mixer_Config() = default;
+  void set_mode(mode_t const& value);
+  void set_mode(mode_t&& value);
+  auto get_mode() const -> mode_t const&;
+
   void set_armed_thrust(ufloat const& value);
   void set_armed_thrust(ufloat&& value);
   auto get_armed_thrust() const -> ufloat const&;
 
 private:
+  mode_t m_mode = mode_t{Motor_Mixer_Config::mode_t::ITERATIVE};
   ufloat m_armed_thrust = ufloat{0};
 };
 
@@ -1081,6 +1353,7 @@ struct MPU9250_Descriptor : public INode_Descriptor
 public:
   typedef uint32_t rate_t;
   typedef uint8_t i2c_address_t;
+  typedef int8_t gpio_t;
   enum class imu_rate_t
   {
     _250 = 250,
@@ -1133,6 +1406,10 @@ public:
   void set_angular_velocity_range(angular_velocity_range_t&& value);
   auto get_angular_velocity_range() const -> angular_velocity_range_t const&;
 
+  void set_data_ready_gpio(int8_t const& value);
+  void set_data_ready_gpio(int8_t&& value);
+  auto get_data_ready_gpio() const -> int8_t const&;
+
 private:
   std::string m_bus;
   uint8_t m_i2c_address = uint8_t{105};
@@ -1141,6 +1418,7 @@ private:
   uint32_t m_thermometer_rate = uint32_t{10};
   acceleration_range_t m_acceleration_range = acceleration_range_t{MPU9250_Descriptor::acceleration_range_t::_8};
   angular_velocity_range_t m_angular_velocity_range = angular_velocity_range_t{MPU9250_Descriptor::angular_velocity_range_t::_500};
+  int8_t m_data_ready_gpio = int8_t{-1};
 };
 
 struct MPU9250_Config : public INode_Config
@@ -2564,6 +2842,89 @@ private:
   bool m_vflip = bool{false};
 };
 
+struct Recorder_Descriptor : public INode_Descriptor
+{
+public:
+  typedef int32_t input_count_t;
+  typedef uint32_t chunk_size_t;
+  typedef uint32_t chunk_buffer_count_t;
+  virtual ~Recorder_Descriptor() = default;
+  void set_input_count(input_count_t const& value);
+  void set_input_count(input_count_t&& value);
+  auto get_input_count() const -> input_count_t const&;
+
+  void set_directory(std::string const& value);
+  void set_directory(std::string&& value);
+  auto get_directory() const -> std::string const&;
+
+  void set_chunk_size(uint32_t const& value);
+  void set_chunk_size(uint32_t&& value);
+  auto get_chunk_size() const -> uint32_t const&;
+
+  void set_chunk_buffer_count(uint32_t const& value);
+  void set_chunk_buffer_count(uint32_t&& value);
+  auto get_chunk_buffer_count() const -> uint32_t const&;
+
+private:
+  input_count_t m_input_count = input_count_t{1};
+  std::string m_directory = std::string{"flight_logs"};
+  uint32_t m_chunk_size = uint32_t{262144};
+  uint32_t m_chunk_buffer_count = uint32_t{16};
+};
+
+struct Recorder_Config : public INode_Config
+{
+public:
+  virtual ~Recorder_Config() = default;
+  void set_is_recording(bool const& value);
+  void set_is_recording(bool&& value);
+  auto get_is_recording() const -> bool const&;
+
+private:
+  bool m_is_recording = bool{true};
+};
+
+struct Replay_Descriptor : public INode_Descriptor
+{
+public:
+  enum class clock_t
+  {
+    REAL_TIME = 0,
+    AS_FAST_AS_POSSIBLE = 1,
+  };
+
+  virtual ~Replay_Descriptor() = default;
+  void set_path(std::string const& value);
+  void set_path(std::string&& value);
+  auto get_path() const -> std::string const&;
+
+  void set_clock(clock_t const& value);
+  void set_clock(clock_t&& value);
+  auto get_clock() const -> clock_t const&;
+
+private:
+  std::string m_path;
+  clock_t m_clock = clock_t{Replay_Descriptor::clock_t::REAL_TIME};
+};
+
+struct Replay_Config : public INode_Config
+{
+public:
+  typedef float speed_t;
+  virtual ~Replay_Config() = default;
+  void set_speed(speed_t const& value);
+  void set_speed(speed_t&& value);
+  auto get_speed() const -> speed_t const&;
+
+  void set_loop(bool const& value);
+  void set_loop(bool&& value);
+  auto get_loop() const -> bool const&;
+
+private:
+  speed_t m_speed = speed_t{1.000000f};
+  bool m_loop = bool{false};
+};
+
 struct RC5T619_Descriptor : public INode_Descriptor
 {
 public:
@@ -2615,14 +2976,31 @@ private:
 struct Resampler_Config : public INode_Config
 {
 public:
+  enum class mode_t
+  {
+    HOLD_LPF = 0,
+    POLYPHASE_FIR = 1,
+  };
+
+  typedef uint32_t zero_crossings_t;
   virtual ~Resampler_Config() = default;
+  void set_mode(mode_t const& value);
+  void set_mode(mode_t&& value);
+  auto get_mode() const -> mode_t const&;
+
   void set_lpf(LPF_Config const& value);
   void set_lpf(LPF_Config&& value);
   auto get_lpf() const -> LPF_Config const&;
   auto get_lpf() -> LPF_Config&;
 
+  void set_fir_zero_crossings(zero_crossings_t const& value);
+  void set_fir_zero_crossings(zero_crossings_t&& value);
+  auto get_fir_zero_crossings() const -> zero_crossings_t const&;
+
 private:
+  mode_t m_mode = mode_t{Resampler_Config::mode_t::HOLD_LPF};
   LPF_Config m_lpf;
+  zero_crossings_t m_fir_zero_crossings = zero_crossings_t{4};
 };
 
 struct Scalar_Generator_Descriptor : public INode_Descriptor
@@ -3048,6 +3426,18 @@ ts::Result<void> deserialize(Settings::Bus_Data& value, ts::sz::Value const& sz_
 ts::sz::Value serialize(Settings::Bus_Data const& value);
 ts::Result<void> deserialize(Settings::Node_Data& value, ts::sz::Value const& sz_value);
 ts::sz::Value serialize(Settings::Node_Data const& value);
+ts::Result<void> deserialize(Settings::Frame_Trace& value, ts::sz::Value const& sz_value);
+ts::sz::Value serialize(Settings::Frame_Trace const& value);
+ts::Result<void> deserialize(Settings::Real_Time& value, ts::sz::Value const& sz_value);
+ts::sz::Value serialize(Settings::Real_Time const& value);
+ts::Result<void> deserialize(Settings::Thread_Profile::policy_t& value, ts::sz::Value const& sz_value);
+ts::sz::Value serialize(Settings::Thread_Profile::policy_t const& value);
+ts::Result<void> deserialize(Settings::Thread_Profile& value, ts::sz::Value const& sz_value);
+ts::sz::Value serialize(Settings::Thread_Profile const& value);
+ts::Result<void> deserialize(Settings::Threads& value, ts::sz::Value const& sz_value);
+ts::sz::Value serialize(Settings::Threads const& value);
+ts::Result<void> deserialize(Settings::Profiler& value, ts::sz::Value const& sz_value);
+ts::sz::Value serialize(Settings::Profiler const& value);
 ts::Result<void> deserialize(Settings& value, ts::sz::Value const& sz_value);
 ts::sz::Value serialize(Settings const& value);
 ts::Result<void> deserialize(Poly<const IBus_Descriptor>& value, ts::sz::Value const& sz_value);
@@ -3058,6 +3448,10 @@ ts::Result<void> deserialize(Poly<const INode_Config>& value, ts::sz::Value cons
 ts::sz::Value serialize(Poly<const INode_Config> const& value);
 ts::Result<void> deserialize(std::vector<std::string>& value, ts::sz::Value const& sz_value);
 ts::sz::Value serialize(std::vector<std::string> const& value);
+ts::Result<void> deserialize(std::vector<uint32_t>& value, ts::sz::Value const& sz_value);
+ts::sz::Value serialize(std::vector<uint32_t> const& value);
+ts::Result<void> deserialize(std::vector<Settings::Thread_Profile>& value, ts::sz::Value const& sz_value);
+ts::sz::Value serialize(std::vector<Settings::Thread_Profile> const& value);
 ts::Result<void> deserialize(Poly<const IUAV_Descriptor>& value, ts::sz::Value const& sz_value);
 ts::sz::Value serialize(Poly<const IUAV_Descriptor> const& value);
 ts::Result<void> deserialize(std::vector<Settings::Bus_Data>& value, ts::sz::Value const& sz_value);
@@ -3126,6 +3520,8 @@ ts::Result<void> deserialize(AVRADC_Config& value, ts::sz::Value const& sz_value
 ts::sz::Value serialize(AVRADC_Config const& value);
 ts::Result<void> deserialize(Comp_AHRS_Descriptor& value, ts::sz::Value const& sz_value);
 ts::sz::Value serialize(Comp_AHRS_Descriptor const& value);
+ts::Result<void> deserialize(Comp_AHRS_Config::mode_t& value, ts::sz::Value const& sz_value);
+ts::sz::Value serialize(Comp_AHRS_Config::mode_t const& value);
 ts::Result<void> deserialize(Comp_AHRS_Config& value, ts::sz::Value const& sz_value);
 ts::sz::Value serialize(Comp_AHRS_Config const& value);
 ts::Result<void> deserialize(Combiner_Descriptor& value, ts::sz::Value const& sz_value);
@@ -3140,6 +3536,10 @@ ts::Result<void> deserialize(KF_ECEF_Descriptor& value, ts::sz::Value const& sz_
 ts::sz::Value serialize(KF_ECEF_Descriptor const& value);
 ts::Result<void> deserialize(KF_ECEF_Config& value, ts::sz::Value const& sz_value);
 ts::sz::Value serialize(KF_ECEF_Config const& value);
+ts::Result<void> deserialize(ESKF_ECEF_Descriptor& value, ts::sz::Value const& sz_value);
+ts::sz::Value serialize(ESKF_ECEF_Descriptor const& value);
+ts::Result<void> deserialize(ESKF_ECEF_Config& value, ts::sz::Value const& sz_value);
+ts::sz::Value serialize(ESKF_ECEF_Config const& value);
 ts::Result<void> deserialize(ENU_Frame_System_Descriptor& value, ts::sz::Value const& sz_value);
 ts::sz::Value serialize(ENU_Frame_System_Descriptor const& value);
 ts::Result<void> deserialize(ENU_Frame_System_Config& value, ts::sz::Value const& sz_value);
@@ -3148,12 +3548,18 @@ ts::Result<void> deserialize(LPF_Descriptor& value, ts::sz::Value const& sz_valu
 ts::sz::Value serialize(LPF_Descriptor const& value);
 ts::Result<void> deserialize(LPF_Config& value, ts::sz::Value const& sz_value);
 ts::sz::Value serialize(LPF_Config const& value);
+ts::Result<void> deserialize(Dynamic_Notch_Descriptor& value, ts::sz::Value const& sz_value);
+ts::sz::Value serialize(Dynamic_Notch_Descriptor const& value);
+ts::Result<void> deserialize(Dynamic_Notch_Config& value, ts::sz::Value const& sz_value);
+ts::sz::Value serialize(Dynamic_Notch_Config const& value);
 ts::Result<void> deserialize(MaxSonar_Descriptor& value, ts::sz::Value const& sz_value);
 ts::sz::Value serialize(MaxSonar_Descriptor const& value);
 ts::Result<void> deserialize(MaxSonar_Config& value, ts::sz::Value const& sz_value);
 ts::sz::Value serialize(MaxSonar_Config const& value);
 ts::Result<void> deserialize(Motor_Mixer_Descriptor& value, ts::sz::Value const& sz_value);
 ts::sz::Value serialize(Motor_Mixer_Descriptor const& value);
+ts::Result<void> deserialize(Motor_Mixer_Config::mode_t& value, ts::sz::Value const& sz_value);
+ts::sz::Value serialize(Motor_Mixer_Config::mode_t const& value);
 ts::Result<void> deserialize(Motor_Mixer_Config& value, ts::sz::Value const& sz_value);
 ts::sz::Value serialize(Motor_Mixer_Config const& value);
 ts::Result<void> deserialize(Quad_Multirotor_Motor_Mixer_Descriptor& value, ts::sz::Value const& sz_value);
@@ -3292,12 +3698,24 @@ ts::Result<void> deserialize(Raspicam_Config::awb_mode_t& value, ts::sz::Value c
 ts::sz::Value serialize(Raspicam_Config::awb_mode_t const& value);
 ts::Result<void> deserialize(Raspicam_Config& value, ts::sz::Value const& sz_value);
 ts::sz::Value serialize(Raspicam_Config const& value);
+ts::Result<void> deserialize(Recorder_Descriptor& value, ts::sz::Value const& sz_value);
+ts::sz::Value serialize(Recorder_Descriptor const& value);
+ts::Result<void> deserialize(Recorder_Config& value, ts::sz::Value const& sz_value);
+ts::sz::Value serialize(Recorder_Config const& value);
+ts::Result<void> deserialize(Replay_Descriptor::clock_t& value, ts::sz::Value const& sz_value);
+ts::sz::Value serialize(Replay_Descriptor::clock_t const& value);
+ts::Result<void> deserialize(Replay_Descriptor& value, ts::sz::Value const& sz_value);
+ts::sz::Value serialize(Replay_Descriptor const& value);
+ts::Result<void> deserialize(Replay_Config& value, ts::sz::Value const& sz_value);
+ts::sz::Value serialize(Replay_Config const& value);
 ts::Result<void> deserialize(RC5T619_Descriptor& value, ts::sz::Value const& sz_value);
 ts::sz::Value serialize(RC5T619_Descriptor const& value);
 ts::Result<void> deserialize(RC5T619_Config& value, ts::sz::Value const& sz_value);
 ts::sz::Value serialize(RC5T619_Config const& value);
 ts::Result<void> deserialize(Resampler_Descriptor& value, ts::sz::Value const& sz_value);
 ts::sz::Value serialize(Resampler_Descriptor const& value);
+ts::Result<void> deserialize(Resampler_Config::mode_t& value, ts::sz::Value const& sz_value);
+ts::sz::Value serialize(Resampler_Config::mode_t const& value);
 ts::Result<void> deserialize(Resampler_Config& value, ts::sz::Value const& sz_value);
 ts::sz::Value serialize(Resampler_Config const& value);
 ts::Result<void> deserialize(Scalar_Generator_Descriptor& value, ts::sz::Value const& sz_value);
@@ -0,0 +1,45 @@
+#The Comp_AHRS/Mahony_AHRS_Filter benchmark, it needs only the fc headers and qmath
+TEMPLATE = app
+CONFIG += console
+CONFIG -= qt
+CONFIG += c++11
+
+TARGET = bench_ahrs
+
+rpi {
+    QMAKE_MAKEFILE = "Makefile.rpi.bench_ahrs"
+    MAKEFILE = "Makefile.rpi.bench_ahrs"
+    CONFIG(debug, debug|release) {
+        DEST_FOLDER = rpi/debug
+    }
+    CONFIG(release, debug|release) {
+        DEST_FOLDER = rpi/release
+        DEFINES += NDEBUG
+    }
+} else {
+    QMAKE_MAKEFILE = "Makefile.bench_ahrs"
+    MAKEFILE = "Makefile.bench_ahrs"
+    CONFIG(debug, debug|release) {
+        DEST_FOLDER = pc/debug
+    }
+    CONFIG(release, debug|release) {
+        DEST_FOLDER = pc/release
+        DEFINES += NDEBUG
+    }
+}
+
+#it shares the folder with fc
+OBJECTS_DIR = ./.obj/bench_ahrs/$${DEST_FOLDER}
+DESTDIR = ../../bin/$${DEST_FOLDER}
+
+QMAKE_CXXFLAGS += -Wno-psabi
+
+INCLUDEPATH += ../../../libs
+INCLUDEPATH += ../../src
+INCLUDEPATH += ../../../../qmath/include
+
+ROOT_LIBS_PATH = ../../../..
+
+LIBS += -L$${ROOT_LIBS_PATH}/qmath/lib/$${DEST_FOLDER} -lqmath
+
+SOURCES += ../../test/bench_ahrs.cpp
@@ -0,0 +1,44 @@
+#The Butterworth/Biquad_Cascade benchmark, it needs only the utils headers and qmath
+TEMPLATE = app
+CONFIG += console
+CONFIG -= qt
+CONFIG += c++11
+
+TARGET = bench_biquad
+
+rpi {
+    QMAKE_MAKEFILE = "Makefile.rpi.bench_biquad"
+    MAKEFILE = "Makefile.rpi.bench_biquad"
+    CONFIG(debug, debug|release) {
+        DEST_FOLDER = rpi/debug
+    }
+    CONFIG(release, debug|release) {
+        DEST_FOLDER = rpi/release
+        DEFINES += NDEBUG
+    }
+} else {
+    QMAKE_MAKEFILE = "Makefile.bench_biquad"
+    MAKEFILE = "Makefile.bench_biquad"
+    CONFIG(debug, debug|release) {
+        DEST_FOLDER = pc/debug
+    }
+    CONFIG(release, debug|release) {
+        DEST_FOLDER = pc/release
+        DEFINES += NDEBUG
+    }
+}
+
+#it shares the folder with fc
+OBJECTS_DIR = ./.obj/bench_biquad/$${DEST_FOLDER}
+DESTDIR = ../../bin/$${DEST_FOLDER}
+
+QMAKE_CXXFLAGS += -Wno-psabi
+
+INCLUDEPATH += ../../../libs
+INCLUDEPATH += ../../../../qmath/include
+
+ROOT_LIBS_PATH = ../../../..
+
+LIBS += -L$${ROOT_LIBS_PATH}/qmath/lib/$${DEST_FOLDER} -lqmath
+
+SOURCES += ../../test/bench_biquad.cpp
@@ -0,0 +1,47 @@
+#The KF_ECEF/ESKF_ECEF_Filter benchmark, it needs the utils, qmath and eigen headers and the coordinates code
+TEMPLATE = app
+CONFIG += console
+CONFIG -= qt
+CONFIG += c++11
+
+TARGET = bench_eskf
+
+rpi {
+    QMAKE_MAKEFILE = "Makefile.rpi.bench_eskf"
+    MAKEFILE = "Makefile.rpi.bench_eskf"
+    CONFIG(debug, debug|release) {
+        DEST_FOLDER = rpi/debug
+    }
+    CONFIG(release, debug|release) {
+        DEST_FOLDER = rpi/release
+        DEFINES += NDEBUG
+    }
+} else {
+    QMAKE_MAKEFILE = "Makefile.bench_eskf"
+    MAKEFILE = "Makefile.bench_eskf"
+    CONFIG(debug, debug|release) {
+        DEST_FOLDER = pc/debug
+    }
+    CONFIG(release, debug|release) {
+        DEST_FOLDER = pc/release
+        DEFINES += NDEBUG
+    }
+}
+
+#it shares the folder with fc
+OBJECTS_DIR = ./.obj/bench_eskf/$${DEST_FOLDER}
+DESTDIR = ../../bin/$${DEST_FOLDER}
+
+QMAKE_CXXFLAGS += -Wno-psabi
+
+INCLUDEPATH += ../../../libs
+INCLUDEPATH += ../../src
+INCLUDEPATH += ../../../../qmath/include
+INCLUDEPATH += ../../../../eigen
+
+ROOT_LIBS_PATH = ../../../..
+
+LIBS += -L$${ROOT_LIBS_PATH}/qmath/lib/$${DEST_FOLDER} -lqmath
+
+SOURCES += ../../test/bench_eskf.cpp
+SOURCES += ../../../libs/utils/Coordinates.cpp
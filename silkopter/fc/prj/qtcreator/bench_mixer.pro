@@ -0,0 +1,46 @@
+#The Motor_Mixer/Motor_Allocation benchmark, it needs the fc headers, qmath and eigen
+TEMPLATE = app
+CONFIG += console
+CONFIG -= qt
+CONFIG += c++11
+
+TARGET = bench_mixer
+
+rpi {
+    QMAKE_MAKEFILE = "Makefile.rpi.bench_mixer"
+    MAKEFILE = "Makefile.rpi.bench_mixer"
+    CONFIG(debug, debug|release) {
+        DEST_FOLDER = rpi/debug
+    }
+    CONFIG(release, debug|release) {
+        DEST_FOLDER = rpi/release
+        DEFINES += NDEBUG
+    }
+} else {
+    QMAKE_MAKEFILE = "Makefile.bench_mixer"
+    MAKEFILE = "Makefile.bench_mixer"
+    CONFIG(debug, debug|release) {
+        DEST_FOLDER = pc/debug
+    }
+    CONFIG(release, debug|release) {
+        DEST_FOLDER = pc/release
+        DEFINES += NDEBUG
+    }
+}
+
+#it shares the folder with fc
+OBJECTS_DIR = ./.obj/bench_mixer/$${DEST_FOLDER}
+DESTDIR = ../../bin/$${DEST_FOLDER}
+
+QMAKE_CXXFLAGS += -Wno-psabi
+
+INCLUDEPATH += ../../../libs
+INCLUDEPATH += ../../src
+INCLUDEPATH += ../../../../qmath/include
+INCLUDEPATH += ../../../../eigen
+
+ROOT_LIBS_PATH = ../../../..
+
+LIBS += -L$${ROOT_LIBS_PATH}/qmath/lib/$${DEST_FOLDER} -lqmath
+
+SOURCES += ../../test/bench_mixer.cpp
@@ -0,0 +1,18 @@
+#The fc project with the bench main instead of the fc one
+include(fc.pro)
+
+TARGET = bench_replay
+INSTALLS =
+
+#it shares the folder with fc
+rpi {
+    QMAKE_MAKEFILE = "Makefile.rpi.bench_replay"
+    MAKEFILE = "Makefile.rpi.bench_replay"
+} else {
+    QMAKE_MAKEFILE = "Makefile.bench_replay"
+    MAKEFILE = "Makefile.bench_replay"
+}
+OBJECTS_DIR = ./.obj/bench_replay/$${DEST_FOLDER}
+
+SOURCES -= ../../src/main.cpp
+SOURCES += ../../test/bench_replay.cpp
@@ -13,6 +13,11 @@ CONFIG *= precompile_header
 
 DEFINES += BOOST_ERROR_CODE_HEADER_ONLY
 DEFINES += ASIO_STANDALONE
+
+#the profiler zones (qbase/include/Profiler.h) are compiled in only with: qmake CONFIG+=profiler
+profiler {
+    DEFINES += __PROFILER_ENABLED__
+}
 rpi {
     DEFINES+=RASPBERRY_PI
     QMAKE_MAKEFILE = "Makefile.rpi"
@@ -87,6 +92,8 @@ rpi {
 SOURCES += \
     ../../src/main.cpp \
     ../../src/sink/PIGPIO.cpp \
+    ../../src/sink/Recorder.cpp \
+    ../../src/source/Replay.cpp \
     ../../src/source/MPU9250.cpp \
     ../../src/source/MS5611.cpp \
     ../../src/source/Raspicam.cpp \
@@ -97,6 +104,7 @@ SOURCES += \
     ../../src/processor/ADC_Voltmeter.cpp \
     ../../src/processor/Comp_AHRS.cpp \
     ../../src/processor/Gravity_Filter.cpp \
+    ../../src/processor/Dynamic_Notch.cpp \
     ../../src/source/EHealth.cpp \
     ../../src/controller/Rate_Controller.cpp \
     ../../src/simulator/Multirotor_Simulation.cpp \
@@ -112,8 +120,11 @@ SOURCES += \
     ../../src/source/MaxSonar.cpp \
     ../../src/processor/Throttle_To_PWM.cpp \
     ../../../libs/utils/Coordinates.cpp \
+    ../../../libs/utils/Frame_Trace.cpp \
+    ../../../libs/utils/Thread_Registry.cpp \
     ../../src/processor/Comp_ECEF.cpp \
     ../../src/processor/KF_ECEF.cpp \
+    ../../src/processor/ESKF_ECEF.cpp \
     ../../src/processor/Proximity.cpp \
     ../../src/source/AVRADC.cpp \
     ../../src/processor/Pressure_Velocity.cpp \
@@ -127,6 +138,11 @@ SOURCES += \
     ../../src/HAL.cpp \
     ../../src/RC_Comms.cpp \
     ../../src/GS_Comms.cpp \
+    ../../src/Node_Executor.cpp \
+    ../../src/Allocation_Tracker.cpp \
+    ../../src/Frame_Arena.cpp \
+    ../../src/Flight_Log.cpp \
+    ../../src/Event_Loop.cpp \
     ../../src/uav_properties/Hexa_Multirotor_Properties.cpp \
     ../../src/uav_properties/Hexatri_Multirotor_Properties.cpp \
     ../../src/uav_properties/Octo_Multirotor_Properties.cpp \
@@ -290,11 +306,14 @@ HEADERS += \
     ../../../libs/utils/chrono.h \
     ../../../libs/utils/PID.h \
     ../../../libs/utils/Timed_Scope.h \
+    ../../../libs/utils/Latency_Histogram.h \
     ../../../libs/physics/constants.h \
     ../../../libs/common/Comm_Data.h \
     ../../../libs/common/Manual_Clock.h \
     ../../../libs/common/node/source/IInertial.h \
     ../../src/sink/PIGPIO.h \
+    ../../src/sink/Recorder.h \
+    ../../src/source/Replay.h \
     ../../src/source/MPU9250.h \
     ../../src/source/MS5611.h \
     ../../src/source/Raspicam.h \
@@ -305,11 +324,16 @@ HEADERS += \
     ../../src/processor/ADC_Ammeter.h \
     ../../src/processor/EKF_AHRS.h \
     ../../src/processor/Comp_AHRS.h \
+    ../../src/processor/Mahony_AHRS_Filter.h \
+    ../../../libs/utils/Biquad_Cascade.h \
     ../../../libs/utils/Butterworth.h \
+    ../../../libs/utils/Notch_Bank.h \
+    ../../../libs/utils/Polyphase_FIR.h \
     ../../../libs/common/node/INode.h \
     ../../../libs/common/node/ISink.h \
     ../../../libs/common/node/ISource.h \
     ../../src/processor/Gravity_Filter.h \
+    ../../src/processor/Dynamic_Notch.h \
     ../../src/Globals.h \
     ../../../libs/common/node/data/IData.h \
     ../../../libs/common/node/IProcessor.h \
@@ -331,11 +355,21 @@ HEADERS += \
     ../../../libs/common/node/IConfig.h \
     ../../src/processor/Servo_Gimbal.h \
     ../../src/processor/Motor_Mixer.h \
+    ../../src/processor/Motor_Allocation.h \
     ../../src/sink/PCA9685.h \
     ../../src/generator/Oscillator.h \
     ../../src/Sample_Accumulator.h \
     ../../src/MPL_Helper.h \
     ../../src/Basic_Output_Stream.h \
+    ../../src/Capture_Context.h \
+    ../../src/Frame_Clock.h \
+    ../../src/Allocation_Tracker.h \
+    ../../src/Frame_Arena.h \
+    ../../src/Flight_Log.h \
+    ../../src/Sample_Ring.h \
+    ../../src/Stream_Handle.h \
+    ../../src/Node_Executor.h \
+    ../../src/Event_Loop.h \
     ../../../libs/lz4/lz4.h \
     ../../src/source/OpenCV_Capture.h \
     ../../../libs/utils/Serialization.h \
@@ -346,6 +380,8 @@ HEADERS += \
     ../../src/source/MaxSonar.h \
     ../../src/processor/Throttle_To_PWM.h \
     ../../../libs/utils/Coordinates.h \
+    ../../../libs/utils/Frame_Trace.h \
+    ../../../libs/utils/Thread_Registry.h \
     ../../../libs/common/stream/IAcceleration.h \
     ../../../libs/common/stream/IADC.h \
     ../../../libs/common/stream/IAngular_Velocity.h \
@@ -387,6 +423,9 @@ HEADERS += \
     ../../../libs/kalman/kvector_impl.hpp \
     ../../src/processor/Comp_ECEF.h \
     ../../src/processor/KF_ECEF.h \
+    ../../src/processor/KF_ECEF_Filter.h \
+    ../../src/processor/ESKF_ECEF.h \
+    ../../src/processor/ESKF_ECEF_Filter.h \
     ../../src/processor/Proximity.h \
     ../../../libs/common/stream/IMultirotor_Commands.h \
     ../../src/source/AVRADC.h \
@@ -430,6 +469,7 @@ HEADERS += \
     ../../../libs/utils/hw/II2C.h \
     ../../../libs/utils/hw/ISPI.h \
     ../../../libs/utils/hw/IUART.h \
+    ../../../libs/utils/hw/Bus_Stats.h \
     ../../../libs/utils/hw/SPI_BCM.h \
     ../../../libs/utils/hw/UART_BB.h \
     ../../../libs/utils/hw/UART_Dev.h \
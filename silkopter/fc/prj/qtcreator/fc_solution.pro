@@ -6,7 +6,7 @@ rpi {
     MKFL = "Makefile"
 }
 
-SUBDIRS += qmath qbase def_lang fc
+SUBDIRS += qmath qbase def_lang fc bench_replay bench_biquad bench_eskf bench_ahrs bench_mixer
 
 def_lang.file = ../../../../def_lang/prj/qtcreator/def_lang.pro
 def_lang.makefile = $${MKFL}
@@ -18,3 +18,22 @@ qmath.makefile = $${MKFL}
 fc.file = fc.pro
 fc.depends = def_lang qbase qmath
 
+bench_replay.file = bench_replay.pro
+bench_replay.makefile = $${MKFL}.bench_replay
+bench_replay.depends = def_lang qbase qmath
+
+bench_biquad.file = bench_biquad.pro
+bench_biquad.makefile = $${MKFL}.bench_biquad
+bench_biquad.depends = qmath
+
+bench_eskf.file = bench_eskf.pro
+bench_eskf.makefile = $${MKFL}.bench_eskf
+bench_eskf.depends = qmath
+
+bench_ahrs.file = bench_ahrs.pro
+bench_ahrs.makefile = $${MKFL}.bench_ahrs
+bench_ahrs.depends = qmath
+
+bench_mixer.file = bench_mixer.pro
+bench_mixer.makefile = $${MKFL}.bench_mixer
+bench_mixer.depends = qmath
@@ -0,0 +1,119 @@
+#include "FCStdAfx.h"
+#include "Allocation_Tracker.h"
+
+#include <new>
+#include <unistd.h>
+
+namespace silk
+{
+
+thread_local uint64_t Allocation_Tracker::s_allocation_count = 0;
+thread_local char const* Allocation_Tracker::s_section_name = nullptr;
+std::atomic_bool Allocation_Tracker::s_is_strict = { false };
+
+void Allocation_Tracker::set_strict(bool yes)
+{
+    s_is_strict.store(yes, std::memory_order_relaxed);
+}
+bool Allocation_Tracker::is_strict()
+{
+    return s_is_strict.load(std::memory_order_relaxed);
+}
+
+void Allocation_Tracker::on_allocation(size_t size)
+{
+    s_allocation_count++;
+
+    if (s_section_name && s_is_strict.load(std::memory_order_relaxed))
+    {
+        //no logging here, it would allocate
+        char message[256];
+        int length = snprintf(message, sizeof(message), "Strict real-time mode: heap allocation of %zu bytes in '%s'. Aborting.\n", size, s_section_name);
+        if (length > 0 && write(STDERR_FILENO, message, std::min<size_t>(length, sizeof(message) - 1)) < 0)
+        {
+            //nothing left to do
+        }
+        abort();
+    }
+}
+
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void* allocate(size_t size)
+{
+    silk::Allocation_Tracker::on_allocation(size);
+
+    size = size > 0 ? size : 1;
+    while (true)
+    {
+        void* ptr = malloc(size);
+        if (ptr)
+        {
+            return ptr;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (!handler)
+        {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void* operator new(size_t size)
+{
+    return allocate(size);
+}
+void* operator new[](size_t size)
+{
+    return allocate(size);
+}
+void* operator new(size_t size, std::nothrow_t const&) noexcept
+{
+    try
+    {
+        return allocate(size);
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+void* operator new[](size_t size, std::nothrow_t const&) noexcept
+{
+    try
+    {
+        return allocate(size);
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+void operator delete(void* ptr) noexcept
+{
+    free(ptr);
+}
+void operator delete[](void* ptr) noexcept
+{
+    free(ptr);
+}
+void operator delete(void* ptr, size_t) noexcept
+{
+    free(ptr);
+}
+void operator delete[](void* ptr, size_t) noexcept
+{
+    free(ptr);
+}
+void operator delete(void* ptr, std::nothrow_t const&) noexcept
+{
+    free(ptr);
+}
+void operator delete[](void* ptr, std::nothrow_t const&) noexcept
+{
+    free(ptr);
+}
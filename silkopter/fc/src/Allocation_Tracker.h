@@ -0,0 +1,49 @@
+#pragma once
+
+namespace silk
+{
+
+//Counts the heap allocations made by each thread. The global operator new is replaced in Allocation_Tracker.cpp.
+//The node executor reads the count around every node to find the nodes still allocating once the FC is running.
+//In strict mode an allocation made inside a Real_Time_Section aborts so the core dump points at the culprit.
+//Only allocations through operator new are seen - the C libraries calling malloc directly are not.
+class Allocation_Tracker
+{
+public:
+    static uint64_t get_thread_allocation_count();
+
+    static void set_strict(bool yes);
+    static bool is_strict();
+
+    //marks the code that shouldn't allocate. The name shows up in the strict mode abort message
+    class Real_Time_Section
+    {
+    public:
+        Real_Time_Section(char const* name)
+            : m_old_name(s_section_name)
+        {
+            s_section_name = name;
+        }
+        ~Real_Time_Section()
+        {
+            s_section_name = m_old_name;
+        }
+    private:
+        char const* m_old_name;
+    };
+
+    //called by operator new
+    static void on_allocation(size_t size);
+
+private:
+    static thread_local uint64_t s_allocation_count;
+    static thread_local char const* s_section_name;
+    static std::atomic_bool s_is_strict;
+};
+
+inline uint64_t Allocation_Tracker::get_thread_allocation_count()
+{
+    return s_allocation_count;
+}
+
+}
@@ -2,26 +2,56 @@
 
 #include <type_traits>
 #include "utils/Clock.h"
+#include "Sample_Ring.h"
+#include "Capture_Context.h"
+#include "Frame_Clock.h"
 
 namespace silk
 {
 
 
+//The samples are stored once, in a ring that keeps the samples a consumer didn't get to yet. get_samples() is a view
+// of the ones pushed in the current frame, until the producer clears them, and the Sample_Accumulator reads the
+// ring in place.
+//Samples are filled in place so values owning memory (vectors, strings) reuse the capacity of the sample they
+// overwrite instead of allocating. Every slot holds on to that memory so these streams keep a short ring.
+//Pushed samples are stamped with the capture time of the inputs they derive from (see Capture_Context), or with
+// their own sample time when the node has no inputs.
 template<class Base>
-class Basic_Output_Stream : public Base
+class Basic_Output_Stream : public Base, public ISample_Ring_Source<typename Base::Sample>
 {
 public:
     typedef typename Base::Sample Sample;
     typedef typename Sample::Value Value;
 
-    Basic_Output_Stream() = default;
+    //enough history for consumers that fall behind by a few frames
+    static constexpr size_t MIN_RING_CAPACITY = 64;
+    static constexpr uint32_t RING_HISTORY_DIVIDER = 4; //rate / 4 -> 250ms
+    static constexpr size_t NON_TRIVIAL_RING_CAPACITY = 8; //video frames, proximity rays
 
-    Sample const& get_last_sample() const { return m_last_sample; }
-    std::vector<Sample> const& get_samples() const { return m_samples; }
+    Basic_Output_Stream()
+    {
+        m_ring.set_capacity(IS_TRIVIAL ? size_t(MIN_RING_CAPACITY) : size_t(NON_TRIVIAL_RING_CAPACITY));
+    }
+
+    //a default sample until the first push after the rate changes
+    Sample const& get_last_sample() const
+    {
+        uint64_t end = m_ring.get_end_index();
+        return end > m_ring.get_begin_index() ? m_ring.get(end - 1) : m_default_sample;
+    }
+    stream::Sample_View<Sample> get_samples() const { return m_ring.get_view(m_frame_begin_index.load(std::memory_order_relaxed)); }
+    Sample_Ring<Sample> const& get_sample_ring() const override { return m_ring; }
     uint32_t get_rate() const { return m_rate; }
 
     void set_rate(uint32_t rate)
     {
+        if (rate != m_rate && IS_TRIVIAL)
+        {
+            m_ring.set_capacity(std::max(size_t(MIN_RING_CAPACITY), size_t(rate / RING_HISTORY_DIVIDER)));
+            m_frame_begin_index = m_ring.get_end_index();
+        }
+
         if (rate > 0)
         {
             m_dt = std::chrono::nanoseconds(1000000000 / rate);
@@ -55,51 +85,78 @@ public:
 //        m_samples.push_back(m_last_sample);
 //    }
 
+    //repeats the last value so it keeps the capture time of the last sample as well
     void push_last_sample(bool is_healthy)
     {
-        push_sample(m_last_sample.value, is_healthy);
+        Sample const& last_sample = get_last_sample();
+        push_sample(last_sample.value, is_healthy, last_sample.capture_tp);
     }
 
     void push_sample(Value const& value, bool is_healthy)
+    {
+        push_sample(value, is_healthy, Capture_Context::get());
+    }
+
+    //for nodes that don't get their inputs through a Sample_Accumulator and know the capture time themselves.
+    //0 uses the sample time
+    void push_sample(Value const& value, bool is_healthy, stream::Capture_Tp capture_tp)
     {
         m_tp += m_dt;
 
-        auto future = Clock::now() + m_dt * 5;
-        if (m_tp > future && !m_future_warning)
+        auto now = Frame_Clock::now();
+        if (m_tp > now + m_dt * 5 && !m_future_warning)
         {
             m_future_warning = true;
-            QLOGW("Samples from the future: {}", m_tp - Clock::now());
+            QLOGW("Samples from the future: {}", m_tp - now);
         }
 
-        m_last_sample.value = value;
-        m_last_sample.is_healthy = is_healthy;
-        m_samples.push_back(m_last_sample);
+        store_sample(value, is_healthy, capture_tp);
+    }
+
+    //for samples that keep the time they were recorded at (replays). Their times come from the log so they are not
+    // checked for samples from the future
+    void push_sample_at(Value const& value, bool is_healthy, Clock::time_point tp, stream::Capture_Tp capture_tp)
+    {
+        m_tp = tp;
+        store_sample(value, is_healthy, capture_tp);
     }
 
     void clear()
     {
-        m_samples.clear();
+        m_frame_begin_index = m_ring.get_end_index();
         m_future_warning = false;
     }
 
+    //the samples owed since the last push, at the Frame_Clock time
     size_t compute_samples_needed()
     {
-        auto dt = Clock::now() - m_tp;
+        auto dt = Frame_Clock::now() - m_tp;
         if (dt < Clock::duration(0))
         {
             return 0;
         }
         size_t samples_needed = dt / m_dt;
-        m_samples.reserve(samples_needed);
         return samples_needed;
     }
 
 private:
+    static constexpr bool IS_TRIVIAL = std::is_trivially_copyable<Value>::value;
+
+    void store_sample(Value const& value, bool is_healthy, stream::Capture_Tp capture_tp)
+    {
+        Sample& sample = m_ring.begin_push();
+        sample.value = value;
+        sample.is_healthy = is_healthy;
+        sample.capture_tp = capture_tp != 0 ? capture_tp : stream::to_capture_tp(m_tp);
+        m_ring.end_push();
+    }
+
     Clock::duration m_dt;
     Clock::time_point m_tp = Clock::now();
     uint32_t m_rate = 0;
-    std::vector<Sample> m_samples;
-    Sample m_last_sample;
+    Sample_Ring<Sample> m_ring;
+    std::atomic<uint64_t> m_frame_begin_index = { 0 }; //get_samples() can be called while a detached producer pushes
+    Sample m_default_sample;
     bool m_future_warning = false;
 };
 
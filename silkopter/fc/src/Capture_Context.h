@@ -0,0 +1,33 @@
+#pragma once
+
+#include "common/stream/IStream.h"
+
+namespace silk
+{
+
+//The capture time of the input samples the current node is working on, so the samples it pushes inherit it
+// without every node having to carry it from its inputs to its outputs.
+//The Sample_Accumulator sets it to the oldest capture time of each sample set before calling the node with it,
+// Basic_Output_Stream::push_sample stamps it on the pushed sample and the node executor clears it before every node.
+//With no input (sources) it stays unknown and the output stream stamps the sample time instead.
+class Capture_Context
+{
+public:
+    static void clear()
+    {
+        s_capture_tp = 0;
+    }
+    static void set(stream::Capture_Tp capture_tp)
+    {
+        s_capture_tp = capture_tp;
+    }
+    static auto get() -> stream::Capture_Tp
+    {
+        return s_capture_tp;
+    }
+
+private:
+    static thread_local stream::Capture_Tp s_capture_tp;
+};
+
+}
@@ -0,0 +1,257 @@
+#include "FCStdAfx.h"
+#include "Event_Loop.h"
+
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace silk
+{
+
+constexpr size_t MAX_EVENT_COUNT = 16;
+
+enum class Source : uint32_t
+{
+    EVENT,
+    TIMER,
+    GPIO
+};
+
+static uint64_t make_epoll_data(Source source, size_t index)
+{
+    return (static_cast<uint64_t>(source) << 32) | static_cast<uint64_t>(index);
+}
+
+static timespec to_timespec(Clock::duration d)
+{
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+    timespec ts;
+    ts.tv_sec = static_cast<time_t>(ns / 1000000000LL);
+    ts.tv_nsec = static_cast<long>(ns % 1000000000LL);
+    return ts;
+}
+
+Event_Loop::Event_Loop()
+{
+}
+
+Event_Loop::~Event_Loop()
+{
+    close_timers();
+    remove_gpio_fds();
+    if (m_event_fd >= 0)
+    {
+        ::close(m_event_fd);
+    }
+    if (m_epoll_fd >= 0)
+    {
+        ::close(m_epoll_fd);
+    }
+}
+
+ts::Result<void> Event_Loop::init()
+{
+    QLOG_TOPIC("event_loop::init");
+
+    m_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (m_epoll_fd < 0)
+    {
+        return make_error("Cannot create epoll: {}", strerror(errno));
+    }
+
+    m_event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (m_event_fd < 0)
+    {
+        return make_error("Cannot create eventfd: {}", strerror(errno));
+    }
+
+    epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.u64 = make_epoll_data(Source::EVENT, 0);
+    if (epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, m_event_fd, &ev) < 0)
+    {
+        return make_error("Cannot add eventfd to epoll: {}", strerror(errno));
+    }
+
+    return ts::success;
+}
+
+void Event_Loop::close_timers()
+{
+    for (Timer const& timer: m_timers)
+    {
+        if (m_epoll_fd >= 0)
+        {
+            epoll_ctl(m_epoll_fd, EPOLL_CTL_DEL, timer.fd, nullptr);
+        }
+        ::close(timer.fd);
+    }
+    m_timers.clear();
+}
+
+ts::Result<void> Event_Loop::set_timer_rates(std::vector<uint32_t> const& rates)
+{
+    QLOG_TOPIC("event_loop::set_timer_rates");
+
+    close_timers();
+
+    std::vector<uint32_t> unique_rates = rates;
+    std::sort(unique_rates.begin(), unique_rates.end());
+    unique_rates.erase(std::unique(unique_rates.begin(), unique_rates.end()), unique_rates.end());
+
+    auto now = Clock::now();
+    for (uint32_t rate: unique_rates)
+    {
+        if (rate == 0)
+        {
+            continue;
+        }
+
+        Timer timer;
+        timer.period = std::chrono::nanoseconds(1000000000 / rate);
+        timer.next_tp = now + timer.period;
+
+        timer.fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        if (timer.fd < 0)
+        {
+            return make_error("Cannot create timer for {}Hz: {}", rate, strerror(errno));
+        }
+
+        //absolute times so we know exactly when each expiration was due. Clock is CLOCK_MONOTONIC
+        itimerspec spec;
+        spec.it_value = to_timespec(timer.next_tp.time_since_epoch());
+        spec.it_interval = to_timespec(timer.period);
+        if (timerfd_settime(timer.fd, TFD_TIMER_ABSTIME, &spec, nullptr) < 0)
+        {
+            ::close(timer.fd);
+            return make_error("Cannot start timer for {}Hz: {}", rate, strerror(errno));
+        }
+
+        epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.u64 = make_epoll_data(Source::TIMER, m_timers.size());
+        if (epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, timer.fd, &ev) < 0)
+        {
+            ::close(timer.fd);
+            return make_error("Cannot add timer for {}Hz to epoll: {}", rate, strerror(errno));
+        }
+
+        m_timers.push_back(timer);
+        QLOGI("Waking up at {}Hz", rate);
+    }
+
+    return ts::success;
+}
+
+void Event_Loop::remove_gpio_fds()
+{
+    //the fds of removed nodes are already closed, which also took them out of epoll
+    for (int fd: m_gpio_fds)
+    {
+        if (m_epoll_fd >= 0)
+        {
+            epoll_ctl(m_epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+        }
+    }
+    m_gpio_fds.clear();
+}
+
+ts::Result<void> Event_Loop::set_gpio_fds(std::vector<int> const& fds)
+{
+    QLOG_TOPIC("event_loop::set_gpio_fds");
+
+    remove_gpio_fds();
+
+    for (int fd: fds)
+    {
+        //sysfs reports GPIO edges as priority data
+        epoll_event ev;
+        ev.events = EPOLLPRI | EPOLLERR;
+        ev.data.u64 = make_epoll_data(Source::GPIO, m_gpio_fds.size());
+        if (epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0)
+        {
+            return make_error("Cannot add GPIO fd {} to epoll: {}", fd, strerror(errno));
+        }
+        m_gpio_fds.push_back(fd);
+        QLOGI("Waking up on data-ready GPIO fd {}", fd);
+    }
+
+    return ts::success;
+}
+
+void Event_Loop::signal()
+{
+    uint64_t value = 1;
+    if (::write(m_event_fd, &value, sizeof(value)) < 0 && errno != EAGAIN)
+    {
+        QLOGW("Cannot signal the event loop: {}", strerror(errno));
+    }
+}
+
+auto Event_Loop::wait(Clock::duration timeout) -> boost::optional<Clock::duration>
+{
+    std::array<epoll_event, MAX_EVENT_COUNT> events;
+
+    int timeout_ms = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(timeout).count());
+    int count = epoll_wait(m_epoll_fd, events.data(), static_cast<int>(events.size()), std::max(timeout_ms, 0));
+    if (count < 0)
+    {
+        if (errno != EINTR)
+        {
+            QLOGW("epoll_wait failed: {}", strerror(errno));
+        }
+        return boost::none;
+    }
+
+    auto now = Clock::now();
+    boost::optional<Clock::duration> latency;
+
+    for (int i = 0; i < count; i++)
+    {
+        uint64_t data = events[i].data.u64;
+        Source source = static_cast<Source>(data >> 32);
+        size_t index = static_cast<size_t>(data & 0xFFFFFFFF);
+
+        if (source == Source::TIMER)
+        {
+            QASSERT(index < m_timers.size());
+            Timer& timer = m_timers[index];
+
+            uint64_t expirations = 0;
+            if (::read(timer.fd, &expirations, sizeof(expirations)) != sizeof(expirations) || expirations == 0)
+            {
+                continue;
+            }
+
+            //the latest expiration is the one we woke up for, the previous ones were missed entirely
+            Clock::time_point due_tp = timer.next_tp + timer.period * (expirations - 1);
+            timer.next_tp = due_tp + timer.period;
+
+            Clock::duration timer_latency = now - due_tp;
+            latency = latency ? std::min(*latency, timer_latency) : timer_latency;
+        }
+        else if (source == Source::EVENT)
+        {
+            uint64_t value = 0;
+            if (::read(m_event_fd, &value, sizeof(value)) < 0 && errno != EAGAIN)
+            {
+                QLOGW("Cannot read the event loop signal: {}", strerror(errno));
+            }
+        }
+        else if (source == Source::GPIO)
+        {
+            //the edge is acknowledged by reading the value from the start, otherwise epoll keeps reporting it
+            QASSERT(index < m_gpio_fds.size());
+            char value[8];
+            if (lseek(m_gpio_fds[index], 0, SEEK_SET) < 0 || ::read(m_gpio_fds[index], value, sizeof(value)) < 0)
+            {
+                QLOGW("Cannot acknowledge GPIO edge: {}", strerror(errno));
+            }
+        }
+    }
+
+    return latency;
+}
+
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <boost/optional.hpp>
+
+#include "utils/Clock.h"
+
+namespace silk
+{
+
+//Puts the main thread to sleep until there is something to process:
+// - a timer at the rate of a source stream is due
+// - a comms thread signals new data
+// - a sensor data-ready GPIO line has an edge
+//This replaces spinning and fixed sleeps so the FC wakes up exactly when the next sample is due.
+class Event_Loop : q::util::Noncopyable
+{
+public:
+    Event_Loop();
+    ~Event_Loop();
+
+    ts::Result<void> init();
+
+    //creates one periodic timer per distinct rate, replacing the previous timers
+    ts::Result<void> set_timer_rates(std::vector<uint32_t> const& rates);
+
+    //wakes up on edges of the GPIO data-ready lines, replacing the previous ones.
+    //The fds are open sysfs 'value' files with the 'edge' already configured. They stay owned by the caller
+    ts::Result<void> set_gpio_fds(std::vector<int> const& fds);
+
+    //thread safe. Wakes up the loop
+    void signal();
+
+    //blocks until an event happens or the timeout expires.
+    //Returns how late the loop woke up compared to when the earliest expired timer was due, or none if no timer expired.
+    auto wait(Clock::duration timeout) -> boost::optional<Clock::duration>;
+
+private:
+    struct Timer
+    {
+        int fd = -1;
+        Clock::duration period;
+        Clock::time_point next_tp;
+    };
+
+    void close_timers();
+    void remove_gpio_fds();
+
+    int m_epoll_fd = -1;
+    int m_event_fd = -1;
+    std::vector<Timer> m_timers;
+    std::vector<int> m_gpio_fds;
+};
+
+}
@@ -0,0 +1,588 @@
+#include "FCStdAfx.h"
+#include "Flight_Log.h"
+#include "utils/Thread_Registry.h"
+#include "lz4/lz4.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace silk
+{
+namespace flight_log
+{
+
+static std::array<uint32_t, 256> make_crc32_table()
+{
+    std::array<uint32_t, 256> table;
+    for (uint32_t i = 0; i < 256; i++)
+    {
+        uint32_t c = i;
+        for (int k = 0; k < 8; k++)
+        {
+            c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        }
+        table[i] = c;
+    }
+    return table;
+}
+
+auto crc32(uint8_t const* data, size_t size, uint32_t crc) -> uint32_t
+{
+    static const std::array<uint32_t, 256> s_table = make_crc32_table();
+
+    crc = ~crc;
+    for (size_t i = 0; i < size; i++)
+    {
+        crc = s_table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+auto get_header_crc(Chunk_Header const& header) -> uint32_t
+{
+    return crc32(reinterpret_cast<uint8_t const*>(&header), offsetof(Chunk_Header, header_crc));
+}
+
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+//the file grows and is mapped this much at a time
+constexpr uint64_t SEGMENT_SIZE = 16 * 1024 * 1024;
+
+void Flight_Log_Writer::Chunk_Queue::init(size_t capacity)
+{
+    items.assign(capacity + 1, nullptr);
+    head = 0;
+    tail = 0;
+}
+bool Flight_Log_Writer::Chunk_Queue::push(Chunk* chunk)
+{
+    size_t tail_idx = tail.load(std::memory_order_relaxed);
+    size_t next = (tail_idx + 1) % items.size();
+    if (next == head.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+    items[tail_idx] = chunk;
+    tail.store(next, std::memory_order_release);
+    return true;
+}
+bool Flight_Log_Writer::Chunk_Queue::pop(Chunk*& chunk)
+{
+    size_t head_idx = head.load(std::memory_order_relaxed);
+    if (head_idx == tail.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+    chunk = items[head_idx];
+    head.store((head_idx + 1) % items.size(), std::memory_order_release);
+    return true;
+}
+
+Flight_Log_Writer::~Flight_Log_Writer()
+{
+    close();
+}
+
+ts::Result<void> Flight_Log_Writer::open(std::string const& path, size_t chunk_size, size_t buffer_count)
+{
+    QLOG_TOPIC("flight_log_writer::open");
+
+    close();
+
+    m_fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (m_fd < 0)
+    {
+        return make_error("Cannot create '{}': {}", path, strerror(errno));
+    }
+    std::string index_path = path + ".idx";
+    m_index_fd = ::open(index_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_APPEND, 0644);
+    if (m_index_fd < 0)
+    {
+        ::close(m_fd);
+        m_fd = -1;
+        return make_error("Cannot create '{}': {}", index_path, strerror(errno));
+    }
+
+    m_path = path;
+    m_chunk_size = chunk_size;
+    m_file_size = 0;
+    m_chunk_index = 0;
+    m_segment = nullptr;
+    m_written_chunk_count = 0;
+    m_dropped_chunk_count = 0;
+    m_compressed.resize(sizeof(flight_log::Chunk_Header) + LZ4_compressBound(static_cast<int>(chunk_size)));
+
+    m_chunks.clear();
+    m_free_queue.init(buffer_count);
+    m_full_queue.init(buffer_count);
+    for (size_t i = 0; i < buffer_count; i++)
+    {
+        m_chunks.emplace_back(new Chunk());
+        m_chunks.back()->data.resize(chunk_size);
+        m_free_queue.push(m_chunks.back().get());
+    }
+
+    flight_log::File_Header header;
+    std::copy(std::begin(flight_log::FILE_MAGIC), std::end(flight_log::FILE_MAGIC), header.magic);
+    header.chunk_size = static_cast<uint32_t>(chunk_size);
+    header.start_tp_ns = flight_log::to_ns(Clock::now());
+    header.start_system_tp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    ts::Result<void> result = append(reinterpret_cast<uint8_t const*>(&header), sizeof(header));
+    if (result != ts::success)
+    {
+        close();
+        return result;
+    }
+
+    m_exit = false;
+    m_io_thread = std::thread([this]() { io_thread_proc(); });
+
+    QLOGI("Recording to '{}' in chunks of {} bytes", path, chunk_size);
+    return ts::success;
+}
+
+void Flight_Log_Writer::close()
+{
+    if (m_io_thread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lg(m_io_mutex);
+            m_exit = true;
+        }
+        m_io_cv.notify_all();
+        m_io_thread.join();
+    }
+
+    if (m_segment)
+    {
+        munmap(m_segment, SEGMENT_SIZE);
+        m_segment = nullptr;
+    }
+    if (m_fd >= 0)
+    {
+        //the last segment was extended past the data
+        if (ftruncate(m_fd, static_cast<off_t>(m_file_size)) != 0)
+        {
+            QLOGW("Cannot truncate '{}': {}", m_path, strerror(errno));
+        }
+        fsync(m_fd);
+        ::close(m_fd);
+        m_fd = -1;
+    }
+    if (m_index_fd >= 0)
+    {
+        fsync(m_index_fd);
+        ::close(m_index_fd);
+        m_index_fd = -1;
+    }
+}
+
+auto Flight_Log_Writer::is_open() const -> bool
+{
+    return m_fd >= 0;
+}
+
+auto Flight_Log_Writer::acquire_buffer() -> util::serialization::Buffer_t*
+{
+    Chunk* chunk = nullptr;
+    if (!m_free_queue.pop(chunk))
+    {
+        m_dropped_chunk_count++;
+        return nullptr;
+    }
+    return &chunk->data;
+}
+
+void Flight_Log_Writer::submit_buffer(util::serialization::Buffer_t* buffer, size_t size, Clock::time_point first_tp, Clock::time_point last_tp)
+{
+    auto it = std::find_if(m_chunks.begin(), m_chunks.end(), [buffer](std::unique_ptr<Chunk> const& c) { return &c->data == buffer; });
+    QASSERT(it != m_chunks.end());
+    Chunk* chunk = it->get();
+    chunk->size = std::min(size, chunk->data.size());
+    chunk->first_tp_ns = flight_log::to_ns(first_tp);
+    chunk->last_tp_ns = flight_log::to_ns(last_tp);
+
+    //the queue has room for all the chunks so this can't fail
+    bool pushed = m_full_queue.push(chunk);
+    QASSERT(pushed);
+    m_io_cv.notify_one();
+}
+
+auto Flight_Log_Writer::get_chunk_size() const -> size_t
+{
+    return m_chunk_size;
+}
+auto Flight_Log_Writer::get_written_chunk_count() const -> uint32_t
+{
+    return m_written_chunk_count;
+}
+auto Flight_Log_Writer::get_dropped_chunk_count() const -> uint32_t
+{
+    return m_dropped_chunk_count;
+}
+
+void Flight_Log_Writer::io_thread_proc()
+{
+    util::Thread_Registry::register_current_thread("recorder io");
+
+    while (true)
+    {
+        Chunk* chunk = nullptr;
+        if (!m_full_queue.pop(chunk))
+        {
+            if (m_exit)
+            {
+                break; //everything submitted is written
+            }
+            std::unique_lock<std::mutex> lock(m_io_mutex);
+            m_io_cv.wait_for(lock, std::chrono::milliseconds(50));
+            continue;
+        }
+
+        ts::Result<void> result = write_chunk(*chunk);
+        if (result != ts::success)
+        {
+            QLOGE("Failed to write chunk {} to '{}': {}", m_chunk_index, m_path, result.error().what());
+            m_dropped_chunk_count++;
+        }
+        m_free_queue.push(chunk);
+    }
+}
+
+ts::Result<void> Flight_Log_Writer::write_chunk(Chunk const& chunk)
+{
+    //the producer can overshoot the chunk size with its last sample
+    size_t bound = sizeof(flight_log::Chunk_Header) + LZ4_compressBound(static_cast<int>(chunk.size));
+    if (m_compressed.size() < bound)
+    {
+        m_compressed.resize(bound);
+    }
+
+    int compressed_size = LZ4_compress_default(reinterpret_cast<char const*>(chunk.data.data()),
+                                               reinterpret_cast<char*>(m_compressed.data() + sizeof(flight_log::Chunk_Header)),
+                                               static_cast<int>(chunk.size),
+                                               static_cast<int>(m_compressed.size() - sizeof(flight_log::Chunk_Header)));
+    if (compressed_size <= 0)
+    {
+        return make_error("LZ4 compression failed");
+    }
+
+    flight_log::Chunk_Header header;
+    header.index = m_chunk_index;
+    header.compressed_size = static_cast<uint32_t>(compressed_size);
+    header.uncompressed_size = static_cast<uint32_t>(chunk.size);
+    header.first_tp_ns = chunk.first_tp_ns;
+    header.last_tp_ns = chunk.last_tp_ns;
+    header.payload_crc = flight_log::crc32(m_compressed.data() + sizeof(header), header.compressed_size);
+    header.header_crc = flight_log::get_header_crc(header);
+    memcpy(m_compressed.data(), &header, sizeof(header));
+
+    flight_log::Index_Entry entry;
+    entry.index = m_chunk_index;
+    entry.offset = m_file_size;
+    entry.first_tp_ns = chunk.first_tp_ns;
+    entry.last_tp_ns = chunk.last_tp_ns;
+
+    ts::Result<void> result = append(m_compressed.data(), sizeof(header) + header.compressed_size);
+    if (result != ts::success)
+    {
+        return result;
+    }
+    if (write(m_index_fd, &entry, sizeof(entry)) != static_cast<ssize_t>(sizeof(entry)))
+    {
+        QLOGW("Cannot write the index of chunk {}: {}", m_chunk_index, strerror(errno));
+    }
+
+    m_chunk_index++;
+    m_written_chunk_count++;
+    return ts::success;
+}
+
+ts::Result<void> Flight_Log_Writer::append(uint8_t const* data, size_t size)
+{
+    uint64_t const start = m_file_size;
+    while (size > 0)
+    {
+        uint64_t segment_offset = m_file_size - m_file_size % SEGMENT_SIZE;
+        if (!m_segment || segment_offset != m_segment_offset)
+        {
+            ts::Result<void> result = map_segment(segment_offset);
+            if (result != ts::success)
+            {
+                return result;
+            }
+        }
+
+        size_t off = static_cast<size_t>(m_file_size - m_segment_offset);
+        size_t count = std::min<size_t>(size, SEGMENT_SIZE - off);
+        memcpy(m_segment + off, data, count);
+        data += count;
+        size -= count;
+        m_file_size += count;
+    }
+
+    //flush the pages of what was just written so a crash loses at most the chunks still in flight
+    uint64_t page_size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    uint64_t sync_start = std::max(start, m_segment_offset);
+    sync_start -= sync_start % page_size;
+    if (m_file_size > sync_start && msync(m_segment + (sync_start - m_segment_offset), m_file_size - sync_start, MS_SYNC) != 0)
+    {
+        QLOGW("Cannot sync '{}': {}", m_path, strerror(errno));
+    }
+    return ts::success;
+}
+
+ts::Result<void> Flight_Log_Writer::map_segment(uint64_t offset)
+{
+    if (m_segment)
+    {
+        munmap(m_segment, SEGMENT_SIZE);
+        m_segment = nullptr;
+    }
+    if (ftruncate(m_fd, static_cast<off_t>(offset + SEGMENT_SIZE)) != 0)
+    {
+        return make_error("Cannot extend the log: {}", strerror(errno));
+    }
+    void* ptr = mmap(nullptr, SEGMENT_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, static_cast<off_t>(offset));
+    if (ptr == MAP_FAILED)
+    {
+        return make_error("Cannot map the log: {}", strerror(errno));
+    }
+    m_segment = reinterpret_cast<uint8_t*>(ptr);
+    m_segment_offset = offset;
+    return ts::success;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+Flight_Log_Reader::~Flight_Log_Reader()
+{
+    close();
+}
+
+ts::Result<void> Flight_Log_Reader::open(std::string const& path)
+{
+    QLOG_TOPIC("flight_log_reader::open");
+
+    close();
+
+    m_fd = ::open(path.c_str(), O_RDONLY);
+    if (m_fd < 0)
+    {
+        return make_error("Cannot open '{}': {}", path, strerror(errno));
+    }
+    struct stat st;
+    if (fstat(m_fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(flight_log::File_Header)))
+    {
+        close();
+        return make_error("'{}' is not a flight log", path);
+    }
+    m_size = static_cast<size_t>(st.st_size);
+    void* ptr = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_fd, 0);
+    if (ptr == MAP_FAILED)
+    {
+        close();
+        return make_error("Cannot map '{}': {}", path, strerror(errno));
+    }
+    m_data = reinterpret_cast<uint8_t const*>(ptr);
+
+    flight_log::File_Header file_header;
+    memcpy(&file_header, m_data, sizeof(file_header));
+    if (!std::equal(std::begin(flight_log::FILE_MAGIC), std::end(flight_log::FILE_MAGIC), file_header.magic) ||
+            file_header.version != flight_log::VERSION)
+    {
+        close();
+        return make_error("'{}' is not a flight log or has an unsupported version", path);
+    }
+
+    //find the good chunks
+    uint64_t off = sizeof(flight_log::File_Header);
+    while (off + sizeof(flight_log::Chunk_Header) <= m_size)
+    {
+        Chunk chunk;
+        memcpy(&chunk.header, m_data + off, sizeof(chunk.header));
+        chunk.payload_offset = off + sizeof(chunk.header);
+        if (chunk.header.magic != flight_log::CHUNK_MAGIC ||
+                chunk.header.header_crc != flight_log::get_header_crc(chunk.header) ||
+                chunk.payload_offset + chunk.header.compressed_size > m_size ||
+                chunk.header.payload_crc != flight_log::crc32(m_data + chunk.payload_offset, chunk.header.compressed_size))
+        {
+            break;
+        }
+        m_chunks.push_back(chunk);
+        off = chunk.payload_offset + chunk.header.compressed_size;
+    }
+    if (off < m_size)
+    {
+        QLOGW("'{}' ends with {} bytes that are not a valid chunk, probably cut short", path, m_size - off);
+    }
+
+    //collect the streams and count the samples
+    rewind();
+    Samples samples;
+    while (read_samples(samples))
+    {
+        m_sample_count += samples.count;
+    }
+    rewind();
+
+    QLOGI("Opened '{}': {} chunks, {} streams, {} samples", path, m_chunks.size(), m_streams.size(), m_sample_count);
+    return ts::success;
+}
+
+void Flight_Log_Reader::close()
+{
+    if (m_data)
+    {
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+        m_data = nullptr;
+    }
+    if (m_fd >= 0)
+    {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+    m_size = 0;
+    m_chunks.clear();
+    m_streams.clear();
+    m_sample_count = 0;
+    rewind();
+}
+
+auto Flight_Log_Reader::get_streams() const -> std::vector<Stream> const&
+{
+    return m_streams;
+}
+auto Flight_Log_Reader::get_chunk_count() const -> size_t
+{
+    return m_chunks.size();
+}
+auto Flight_Log_Reader::get_sample_count() const -> uint64_t
+{
+    return m_sample_count;
+}
+auto Flight_Log_Reader::get_first_tp_ns() const -> int64_t
+{
+    return m_chunks.empty() ? 0 : m_chunks.front().header.first_tp_ns;
+}
+auto Flight_Log_Reader::get_last_tp_ns() const -> int64_t
+{
+    return m_chunks.empty() ? 0 : m_chunks.back().header.last_tp_ns;
+}
+
+void Flight_Log_Reader::rewind()
+{
+    m_chunk_idx = 0;
+    m_chunk_data.clear();
+    m_chunk_off = 0;
+    m_stream_indices.clear();
+}
+
+ts::Result<void> Flight_Log_Reader::load_chunk(size_t chunk_idx)
+{
+    Chunk const& chunk = m_chunks[chunk_idx];
+    m_chunk_data.resize(chunk.header.uncompressed_size);
+    int size = LZ4_decompress_safe(reinterpret_cast<char const*>(m_data + chunk.payload_offset),
+                                   reinterpret_cast<char*>(m_chunk_data.data()),
+                                   static_cast<int>(chunk.header.compressed_size),
+                                   static_cast<int>(chunk.header.uncompressed_size));
+    if (size != static_cast<int>(chunk.header.uncompressed_size))
+    {
+        m_chunk_data.clear();
+        return make_error("Cannot decompress chunk {}", chunk.header.index);
+    }
+    m_chunk_off = 0;
+    m_stream_indices.clear();
+    return ts::success;
+}
+
+auto Flight_Log_Reader::read_stream_record(size_t& off, Stream& stream, uint16_t& id) const -> bool
+{
+    return util::serialization::deserialize(m_chunk_data, id, off) &&
+            util::serialization::deserialize(m_chunk_data, stream.path, off) &&
+            util::serialization::deserialize(m_chunk_data, stream.type, off) &&
+            util::serialization::deserialize(m_chunk_data, stream.rate, off);
+}
+
+auto Flight_Log_Reader::read_samples(Samples& samples) -> bool
+{
+    while (true)
+    {
+        if (m_chunk_off >= m_chunk_data.size())
+        {
+            if (m_chunk_idx >= m_chunks.size())
+            {
+                return false;
+            }
+            ts::Result<void> result = load_chunk(m_chunk_idx++);
+            if (result != ts::success)
+            {
+                QLOGW("{}, skipping it", result.error().what());
+                continue;
+            }
+        }
+
+        size_t off = m_chunk_off;
+        flight_log::Record record;
+        if (!util::serialization::deserialize(m_chunk_data, record, off))
+        {
+            m_chunk_off = m_chunk_data.size();
+            continue;
+        }
+
+        if (record == flight_log::Record::STREAM)
+        {
+            Stream stream;
+            uint16_t id = 0;
+            if (!read_stream_record(off, stream, id))
+            {
+                QLOGW("Bad stream record in chunk {}, skipping the rest of it", m_chunk_idx - 1);
+                m_chunk_off = m_chunk_data.size();
+                continue;
+            }
+            auto it = std::find_if(m_streams.begin(), m_streams.end(), [&stream](Stream const& s)
+            {
+                return s.path == stream.path && s.type == stream.type && s.rate == stream.rate;
+            });
+            if (it == m_streams.end())
+            {
+                it = m_streams.insert(m_streams.end(), stream);
+            }
+            if (m_stream_indices.size() <= id)
+            {
+                m_stream_indices.resize(id + 1, std::numeric_limits<size_t>::max());
+            }
+            m_stream_indices[id] = static_cast<size_t>(std::distance(m_streams.begin(), it));
+            m_chunk_off = off;
+            continue;
+        }
+
+        uint16_t id = 0;
+        uint32_t size = 0;
+        if (record != flight_log::Record::SAMPLES ||
+                !util::serialization::deserialize(m_chunk_data, id, off) ||
+                !util::serialization::deserialize(m_chunk_data, samples.tp_ns, off) ||
+                !util::serialization::deserialize(m_chunk_data, samples.count, off) ||
+                !util::serialization::deserialize(m_chunk_data, size, off) ||
+                off + size > m_chunk_data.size() ||
+                id >= m_stream_indices.size() ||
+                m_stream_indices[id] >= m_streams.size())
+        {
+            QLOGW("Bad record in chunk {}, skipping the rest of it", m_chunk_idx - 1);
+            m_chunk_off = m_chunk_data.size();
+            continue;
+        }
+
+        samples.stream_idx = m_stream_indices[id];
+        samples.data = &m_chunk_data;
+        samples.offset = off;
+        m_chunk_off = off + size;
+        return true;
+    }
+}
+
+}
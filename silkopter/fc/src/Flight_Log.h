@@ -0,0 +1,218 @@
+#pragma once
+
+#include <thread>
+#include <condition_variable>
+
+#include "utils/Clock.h"
+#include "utils/Serialization.h"
+#include "common/stream/IStream.h"
+
+namespace silk
+{
+
+//Flight logs are a file header followed by independent chunks:
+//  [Chunk_Header][LZ4 payload]...
+//The header has CRCs of itself and of the payload so a log cut short by a crash is readable up to the last good chunk.
+//Each uncompressed payload starts with a STREAM record for every recorded stream so chunks can be decoded on their own,
+// followed by SAMPLES records. Next to the log an index file has one Index_Entry per chunk for seeking.
+namespace flight_log
+{
+
+constexpr char FILE_MAGIC[8] = { 'S', 'I', 'L', 'K', 'L', 'O', 'G', '1' };
+constexpr uint32_t CHUNK_MAGIC = 0x4b4e4843; //CHNK
+constexpr uint32_t VERSION = 2; //2 adds the capture time of the samples
+
+#pragma pack(push, 1)
+struct File_Header
+{
+    char magic[8];
+    uint32_t version = VERSION;
+    uint32_t chunk_size = 0;        //the max uncompressed size of a chunk
+    int64_t start_tp_ns = 0;        //Clock time when the log was opened
+    int64_t start_system_tp_ns = 0; //wall time at the same moment
+};
+
+struct Chunk_Header
+{
+    uint32_t magic = CHUNK_MAGIC;
+    uint32_t index = 0;
+    uint32_t compressed_size = 0;
+    uint32_t uncompressed_size = 0;
+    int64_t first_tp_ns = 0;
+    int64_t last_tp_ns = 0;
+    uint32_t payload_crc = 0;
+    uint32_t header_crc = 0; //of all the fields above
+};
+
+struct Index_Entry
+{
+    uint32_t index = 0;
+    uint64_t offset = 0; //of the chunk header in the log file
+    int64_t first_tp_ns = 0;
+    int64_t last_tp_ns = 0;
+};
+#pragma pack(pop)
+
+enum class Record : uint8_t
+{
+    //uint16_t stream id, std::string path, stream::Type type, uint32_t rate
+    STREAM,
+    //uint16_t stream id, int64_t tp_ns of the last sample, uint32_t count, uint32_t size in bytes, count serialized samples
+    // each followed by its stream::Capture_Tp. The samples before the last are one stream period apart
+    SAMPLES
+};
+
+auto crc32(uint8_t const* data, size_t size, uint32_t crc = 0) -> uint32_t;
+auto get_header_crc(Chunk_Header const& header) -> uint32_t;
+
+inline int64_t to_ns(Clock::time_point tp)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(tp.time_since_epoch()).count();
+}
+
+}
+
+//Writes chunks to a log file on its own thread.
+//The producer gets an empty chunk buffer, fills it and submits it without ever waiting for the storage. Buffers are
+// reused so nothing is allocated after open. When the storage falls behind and no buffer is free the chunk is dropped
+// and counted - the recorder never stalls the rate loop.
+//The file is extended and mapped in large segments and the chunks are copied in the mapping, so appending a chunk is
+// a memcpy and an msync.
+class Flight_Log_Writer
+{
+public:
+    Flight_Log_Writer() = default;
+    ~Flight_Log_Writer();
+
+    //buffer_count buffers of chunk_size bytes are allocated here
+    ts::Result<void> open(std::string const& path, size_t chunk_size, size_t buffer_count);
+    void close();
+    auto is_open() const -> bool;
+
+    //real-time side, only one producer thread
+    auto acquire_buffer() -> util::serialization::Buffer_t*; //nullptr if the writer fell behind
+    void submit_buffer(util::serialization::Buffer_t* buffer, size_t size, Clock::time_point first_tp, Clock::time_point last_tp);
+
+    auto get_chunk_size() const -> size_t;
+    auto get_written_chunk_count() const -> uint32_t;
+    auto get_dropped_chunk_count() const -> uint32_t; //no free buffer when asked for one, or failed to write
+
+private:
+    struct Chunk
+    {
+        util::serialization::Buffer_t data;
+        size_t size = 0;
+        int64_t first_tp_ns = 0;
+        int64_t last_tp_ns = 0;
+    };
+
+    //single producer, single consumer ring of chunk pointers
+    struct Chunk_Queue
+    {
+        std::vector<Chunk*> items;
+        std::atomic<size_t> head = { 0 }; //written by the consumer
+        std::atomic<size_t> tail = { 0 }; //written by the producer
+
+        void init(size_t capacity);
+        bool push(Chunk* chunk);
+        bool pop(Chunk*& chunk);
+    };
+
+    void io_thread_proc();
+    ts::Result<void> write_chunk(Chunk const& chunk);
+    ts::Result<void> append(uint8_t const* data, size_t size);
+    ts::Result<void> map_segment(uint64_t offset);
+
+    std::string m_path;
+    size_t m_chunk_size = 0;
+
+    std::vector<std::unique_ptr<Chunk>> m_chunks;
+    Chunk_Queue m_free_queue;  //io thread -> producer
+    Chunk_Queue m_full_queue;  //producer -> io thread
+
+    std::thread m_io_thread;
+    std::mutex m_io_mutex;
+    std::condition_variable m_io_cv;
+    std::atomic_bool m_exit = { false };
+
+    //io thread only
+    int m_fd = -1;
+    int m_index_fd = -1;
+    uint64_t m_file_size = 0;     //bytes written so far
+    uint8_t* m_segment = nullptr; //the mapped segment of the file
+    uint64_t m_segment_offset = 0;
+    std::vector<uint8_t> m_compressed;
+    uint32_t m_chunk_index = 0;
+
+    std::atomic<uint32_t> m_written_chunk_count = { 0 };
+    std::atomic<uint32_t> m_dropped_chunk_count = { 0 };
+};
+
+//Reads the records of a flight log in the order they were written.
+//The log is mapped in memory and checked when opened - it ends at the first chunk with a bad header or CRC, which is
+// where a crash cut it short. Not real-time safe, chunks are decompressed as the records get to them.
+class Flight_Log_Reader
+{
+public:
+    Flight_Log_Reader() = default;
+    ~Flight_Log_Reader();
+
+    struct Stream
+    {
+        std::string path;
+        stream::Type type;
+        uint32_t rate = 0;
+    };
+
+    //A SAMPLES record. The samples are serialized in data, starting at offset
+    struct Samples
+    {
+        size_t stream_idx = 0; //in get_streams()
+        int64_t tp_ns = 0; //of the last sample
+        uint32_t count = 0;
+        util::serialization::Buffer_t const* data = nullptr;
+        size_t offset = 0;
+    };
+
+    ts::Result<void> open(std::string const& path);
+    void close();
+
+    //all the streams recorded in the log
+    auto get_streams() const -> std::vector<Stream> const&;
+    auto get_chunk_count() const -> size_t;
+    auto get_sample_count() const -> uint64_t;
+    auto get_first_tp_ns() const -> int64_t;
+    auto get_last_tp_ns() const -> int64_t;
+
+    //back to the first record
+    void rewind();
+
+    //the next SAMPLES record. False at the end of the log.
+    //The data is valid until the next call
+    auto read_samples(Samples& samples) -> bool;
+
+private:
+    struct Chunk
+    {
+        flight_log::Chunk_Header header;
+        uint64_t payload_offset = 0;
+    };
+
+    ts::Result<void> load_chunk(size_t chunk_idx);
+    auto read_stream_record(size_t& off, Stream& stream, uint16_t& id) const -> bool;
+
+    int m_fd = -1;
+    uint8_t const* m_data = nullptr;
+    size_t m_size = 0;
+
+    std::vector<Chunk> m_chunks;
+    std::vector<Stream> m_streams;
+    uint64_t m_sample_count = 0;
+
+    size_t m_chunk_idx = 0; //the next chunk to load
+    util::serialization::Buffer_t m_chunk_data;
+    size_t m_chunk_off = 0;
+    std::vector<size_t> m_stream_indices; //in m_streams for each stream id of the current chunk
+};
+
+}
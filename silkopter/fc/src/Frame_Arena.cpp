@@ -0,0 +1,83 @@
+#include "FCStdAfx.h"
+#include "Frame_Arena.h"
+#include "Allocation_Tracker.h"
+
+namespace silk
+{
+
+constexpr size_t k_initial_capacity = 64 * 1024;
+
+Frame_Arena& Frame_Arena::get()
+{
+    static thread_local Frame_Arena s_arena;
+    return s_arena;
+}
+
+Frame_Arena::Frame_Arena()
+{
+    m_capacity = k_initial_capacity;
+    m_buffer = reinterpret_cast<uint8_t*>(malloc(m_capacity));
+    QASSERT(m_buffer);
+    m_overflow.reserve(16);
+}
+
+Frame_Arena::~Frame_Arena()
+{
+    reset();
+    free(m_buffer);
+}
+
+auto Frame_Arena::allocate(size_t size, size_t alignment) -> void*
+{
+    size_t offset = (m_offset + alignment - 1) & ~(alignment - 1);
+    if (offset + size <= m_capacity)
+    {
+        m_offset = offset + size;
+        return m_buffer + offset;
+    }
+
+    //doesn't fit, take it from the heap for this node and remember to grow
+    Allocation_Tracker::on_allocation(size + alignment);
+    void* ptr = malloc(size + alignment);
+    QASSERT(ptr);
+    m_overflow.push_back(ptr);
+    m_overflow_size += size + alignment;
+
+    uintptr_t address = (reinterpret_cast<uintptr_t>(ptr) + alignment - 1) & ~(uintptr_t(alignment) - 1);
+    return reinterpret_cast<void*>(address);
+}
+
+void Frame_Arena::reset()
+{
+    for (void* ptr: m_overflow)
+    {
+        free(ptr);
+    }
+    m_overflow.clear();
+
+    if (m_overflow_size > 0)
+    {
+        size_t capacity = m_capacity;
+        while (capacity < m_offset + m_overflow_size)
+        {
+            capacity *= 2;
+        }
+        uint8_t* buffer = reinterpret_cast<uint8_t*>(malloc(capacity));
+        if (buffer)
+        {
+            free(m_buffer);
+            m_buffer = buffer;
+            m_capacity = capacity;
+        }
+        m_overflow_size = 0;
+    }
+
+    m_offset = 0;
+}
+
+auto Frame_Arena::get_capacity() const -> size_t
+{
+    return m_capacity;
+}
+
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+namespace silk
+{
+
+//Bump allocator for the scratch memory a node needs only while it processes. Every thread has its own arena and the
+// node executor resets it before each node it runs, so nothing allocated from it can outlive the node's process().
+//When a node needs more than the buffer, the overflow comes from the heap - counted as a heap allocation of the node -
+// and the buffer grows to the high water mark on the next reset, so after a few frames the arena stops touching the heap.
+class Frame_Arena
+{
+public:
+    static Frame_Arena& get();
+
+    auto allocate(size_t size, size_t alignment) -> void*;
+    void reset();
+
+    auto get_capacity() const -> size_t;
+
+private:
+    Frame_Arena();
+    ~Frame_Arena();
+
+    uint8_t* m_buffer = nullptr;
+    size_t m_capacity = 0;
+    size_t m_offset = 0;
+
+    std::vector<void*> m_overflow;
+    size_t m_overflow_size = 0;
+};
+
+//stateless allocator over the thread's frame arena. Deallocation is a no-op, the memory goes away when the arena resets
+template<class T>
+struct Frame_Allocator
+{
+    typedef T value_type;
+
+    Frame_Allocator() = default;
+    template<class U> Frame_Allocator(Frame_Allocator<U> const&) {}
+
+    auto allocate(size_t n) -> T*
+    {
+        return reinterpret_cast<T*>(Frame_Arena::get().allocate(n * sizeof(T), alignof(T)));
+    }
+    void deallocate(T*, size_t) {}
+
+    template<class U> bool operator==(Frame_Allocator<U> const&) const { return true; }
+    template<class U> bool operator!=(Frame_Allocator<U> const&) const { return false; }
+};
+
+//containers for the temporaries of a node's process(). Don't keep them in members
+template<class T> using Frame_Vector = std::vector<T, Frame_Allocator<T>>;
+typedef std::basic_string<char, std::char_traits<char>, Frame_Allocator<char>> Frame_String;
+
+}
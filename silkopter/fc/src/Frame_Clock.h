@@ -0,0 +1,30 @@
+#pragma once
+
+#include <atomic>
+#include "utils/Clock.h"
+
+namespace silk
+{
+
+//The time of the frame the node executor is processing - the wall clock, or the virtual clock of a replay running
+// faster than real time. The output streams compute how many samples they owe against it so the nodes pacing their
+// outputs keep up with the replayed sources instead of with the wall clock.
+//The node executor sets it at the start of every frame. Before the first frame it's the wall clock.
+class Frame_Clock
+{
+public:
+    static void set(Clock::time_point tp)
+    {
+        s_frame_ns.store(std::chrono::duration_cast<std::chrono::nanoseconds>(tp.time_since_epoch()).count(), std::memory_order_relaxed);
+    }
+    static auto now() -> Clock::time_point
+    {
+        int64_t ns = s_frame_ns.load(std::memory_order_relaxed);
+        return ns != 0 ? Clock::time_point(std::chrono::duration_cast<Clock::duration>(std::chrono::nanoseconds(ns))) : Clock::now();
+    }
+
+private:
+    static std::atomic<int64_t> s_frame_ns;
+};
+
+}
@@ -2,6 +2,7 @@
 #include "GS_Comms.h"
 #include "RC_Comms.h"
 #include "utils/Timed_Scope.h"
+#include "Sample_Ring.h"
 
 #include "common/stream/IAcceleration.h"
 #include "common/stream/IAngular_Velocity.h"
@@ -58,6 +59,11 @@ GS_Comms::GS_Comms(HAL& hal, RC_Comms& rc_comms)
 {
 }
 
+void GS_Comms::set_data_received_callback(std::function<void()> callback)
+{
+    m_data_received_callback = callback;
+}
+
 auto GS_Comms::start_udp(uint16_t send_port, uint16_t receive_port) -> bool
 {
     try
@@ -69,6 +75,17 @@ auto GS_Comms::start_udp(uint16_t send_port, uint16_t receive_port) -> bool
         util::comms::RCP::Socket_Handle handle = m_rcp->add_socket(m_socket.get());
         if (handle >= 0)
         {
+            //the RCP installed its own callback, chain ours after it
+            auto rcp_receive_callback = m_socket->receive_callback;
+            m_socket->receive_callback = [this, rcp_receive_callback](uint8_t* data, size_t size)
+            {
+                rcp_receive_callback(data, size);
+                if (m_data_received_callback)
+                {
+                    m_data_received_callback();
+                }
+            };
+
             m_rcp->set_internal_socket_handle(handle);
             m_rcp->set_socket_handle(SETUP_CHANNEL, handle);
             m_rcp->set_socket_handle(TELEMETRY_CHANNEL, handle);
@@ -138,7 +155,18 @@ template<class Stream> auto GS_Comms::gather_telemetry_stream(Stream_Telemetry_D
     if (_stream.get_type() == Stream::TYPE)
     {
         auto const& stream = static_cast<Stream const&>(_stream);
-        auto const& samples = stream.get_samples();
+        auto samples = stream.get_samples();
+
+        //streams with a sample ring are read from where the last gather stopped so the samples of a detached producer
+        // that runs across frames are sent once
+        auto ring_source = dynamic_cast<ISample_Ring_Source<typename Stream::Sample> const*>(&stream);
+        if (ring_source)
+        {
+            Sample_Ring<typename Stream::Sample> const& ring = ring_source->get_sample_ring();
+            uint64_t end = ring.get_end_index();
+            samples = ring.get_view(std::min(ts.ring_read_index, end), end); //a new stream starts from its end
+            ts.ring_read_index = end;
+        }
 
         if (ts.sample_count < 1000000)
         {
@@ -159,12 +187,24 @@ template<class Stream> auto GS_Comms::gather_telemetry_stream(Stream_Telemetry_D
     return false;
 }
 
+//p50, p99, p99.9 and max in microseconds
+static void serialize_latency_histogram(std::vector<uint8_t>& data, util::Latency_Histogram const& histogram, size_t& off)
+{
+    for (float percentile: { 0.5f, 0.99f, 0.999f })
+    {
+        auto dt = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(histogram.get_percentile(percentile)).count());
+        util::serialization::serialize(data, dt, off);
+    }
+    auto dt = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(histogram.get_max()).count());
+    util::serialization::serialize(data, dt, off);
+}
+
 void GS_Comms::gather_telemetry_data()
 {
     //first we gather samples and we send them at 30Hz. This improves bandwidth by reducing header overhead and allowing for better compression
     for (auto& ts: m_stream_telemetry_data)
     {
-        auto stream = ts.stream.lock();
+        auto stream = ts.stream.get();
         if (stream)
         {
             if (gather_telemetry_stream<stream::IAcceleration>(ts, *stream) ||
@@ -245,18 +285,60 @@ void GS_Comms::gather_telemetry_data()
 
         util::serialization::serialize(m_internal_telemetry_data.data, static_cast<uint32_t>(telemetry_data.nodes.size()), off);
 
-        for (auto const& nt: telemetry_data.nodes)
+        for (auto const& node_telemetry_data: telemetry_data.nodes)
         {
-            auto const& node_name = nt.first;
-            auto const& node_telemetry_data = nt.second;
-
-            util::serialization::serialize(m_internal_telemetry_data.data, node_name, off);
+            util::serialization::serialize(m_internal_telemetry_data.data, node_telemetry_data.name, off);
 
             auto dt = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(node_telemetry_data.process_duration).count());
             util::serialization::serialize(m_internal_telemetry_data.data, dt, off);
 
-            dt = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(node_telemetry_data.max_process_duration).count());
+            serialize_latency_histogram(m_internal_telemetry_data.data, node_telemetry_data.process_histogram, off);
+
+            util::serialization::serialize(m_internal_telemetry_data.data, node_telemetry_data.allocation_count, off);
+
+            serialize_latency_histogram(m_internal_telemetry_data.data, node_telemetry_data.input_age_histogram, off);
+        }
+
+        util::serialization::serialize(m_internal_telemetry_data.data, static_cast<uint32_t>(telemetry_data.branches.size()), off);
+
+        for (auto const& branch_telemetry_data: telemetry_data.branches)
+        {
+            util::serialization::serialize(m_internal_telemetry_data.data, branch_telemetry_data.name, off);
+
+            auto dt = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(branch_telemetry_data.process_duration).count());
             util::serialization::serialize(m_internal_telemetry_data.data, dt, off);
+
+            dt = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(branch_telemetry_data.max_process_duration).count());
+            util::serialization::serialize(m_internal_telemetry_data.data, dt, off);
+        }
+
+        serialize_latency_histogram(m_internal_telemetry_data.data, telemetry_data.wakeup_latency, off);
+
+        util::serialization::serialize(m_internal_telemetry_data.data, static_cast<uint32_t>(telemetry_data.threads.size()), off);
+
+        for (auto const& thread_telemetry_data: telemetry_data.threads)
+        {
+            util::serialization::serialize(m_internal_telemetry_data.data, thread_telemetry_data.name, off);
+            util::serialization::serialize(m_internal_telemetry_data.data, thread_telemetry_data.cpu_usage, off);
+            util::serialization::serialize(m_internal_telemetry_data.data, thread_telemetry_data.involuntary_context_switches, off);
+        }
+
+        util::serialization::serialize(m_internal_telemetry_data.data, static_cast<uint32_t>(telemetry_data.buses.size()), off);
+
+        for (auto const& bus_telemetry_data: telemetry_data.buses)
+        {
+            util::serialization::serialize(m_internal_telemetry_data.data, bus_telemetry_data.name, off);
+            util::serialization::serialize(m_internal_telemetry_data.data, static_cast<uint32_t>(bus_telemetry_data.clients.size()), off);
+            for (auto const& client: bus_telemetry_data.clients)
+            {
+                util::serialization::serialize(m_internal_telemetry_data.data, client.address, off);
+                util::serialization::serialize(m_internal_telemetry_data.data, client.transaction_count, off);
+                util::serialization::serialize(m_internal_telemetry_data.data, client.byte_count, off);
+                util::serialization::serialize(m_internal_telemetry_data.data, client.error_count, off);
+                util::serialization::serialize(m_internal_telemetry_data.data, client.busy_count, off);
+                util::serialization::serialize(m_internal_telemetry_data.data, client.usage, off);
+                serialize_latency_histogram(m_internal_telemetry_data.data, client.duration_histogram, off);
+            }
         }
     }
 }
@@ -570,17 +652,16 @@ void GS_Comms::handle_req(gs_comms::setup::Remove_Node_Req const& req)
 
     gs_comms::setup::FC_Res response;
 
-    std::shared_ptr<node::INode> node = m_hal.get_node_registry().find_by_name<node::INode>(req.get_name());
-    if (!node)
+    HAL::Graph_Edit edit;
+    edit.remove_node(req.get_name());
+    auto result = m_hal.apply_graph_edit(edit);
+    if (result != ts::success)
     {
-        response = make_error_response(req.get_req_id(), "Cannot find node '{}'", req.get_name());
+        response = make_error_response(req.get_req_id(), "Cannot remove node '{}': {}", req.get_name(), result.error().what());
         serialize_and_send(SETUP_CHANNEL, response);
         return;
     }
 
-    m_hal.remove_node(node);
-    m_hal.save_settings();
-
     gs_comms::setup::Remove_Node_Res res;
     res.set_req_id(req.get_req_id());
     response = res;
@@ -611,19 +692,21 @@ void GS_Comms::handle_req(gs_comms::setup::Add_Node_Req const& req)
         return;
     }
 
-    auto create_node_result = m_hal.create_node(req.get_def_name(), req.get_name(), *descriptor);
-    if (create_node_result != ts::success)
+    HAL::Graph_Edit edit;
+    edit.add_node(req.get_def_name(), req.get_name(), descriptor.get_shared_ptr());
+    auto edit_result = m_hal.apply_graph_edit(edit);
+    std::shared_ptr<node::INode> node = m_hal.get_node_registry().find_by_name<node::INode>(req.get_name());
+    if (edit_result != ts::success || !node)
     {
-        response = make_error_response(req.get_req_id(), "Cannot create node {}: {}", req.get_def_name(), create_node_result.error().what());
+        response = make_error_response(req.get_req_id(), "Cannot create node {}: {}", req.get_def_name(), edit_result != ts::success ? edit_result.error().what() : std::string());
         serialize_and_send(SETUP_CHANNEL, response);
         return;
     }
-    m_hal.save_settings();
 
     gs_comms::setup::Add_Node_Res res;
     res.set_req_id(req.get_req_id());
 
-    boost::variant<gs_comms::setup::Node_Data, gs_comms::setup::Error> result = get_node_data(req.get_name(), *create_node_result.payload());
+    boost::variant<gs_comms::setup::Node_Data, gs_comms::setup::Error> result = get_node_data(req.get_name(), *node);
     if (auto* error = boost::get<gs_comms::setup::Error>(&result))
     {
         response = std::move(*error);
@@ -713,14 +796,15 @@ void GS_Comms::handle_req(gs_comms::setup::Set_Node_Input_Stream_Path_Req const&
         const node::INode::Input& input = inputs[idx];
         if (input.name == input_name)
         {
-            auto set_input_result = node->set_input_stream_path(idx, req.get_stream_path());
+            HAL::Graph_Edit edit;
+            edit.set_input_stream_path(node_name, idx, req.get_stream_path());
+            auto set_input_result = m_hal.apply_graph_edit(edit);
             if (set_input_result != ts::success)
             {
                 response = make_error_response(req.get_req_id(), set_input_result.error().what());
                 serialize_and_send(SETUP_CHANNEL, response);
                 return;
             }
-            m_hal.save_settings();
 
             boost::variant<gs_comms::setup::Node_Data, gs_comms::setup::Error> result = get_node_data(node_name, *node);
             if (auto* error = boost::get<gs_comms::setup::Error>(&result))
@@ -828,14 +912,15 @@ void GS_Comms::handle_req(gs_comms::setup::Set_Node_Config_Req const& req)
         return;
     }
 
-    auto set_config_result = node->set_config(*config);
+    HAL::Graph_Edit edit;
+    edit.set_node_config(node_name, config.get_shared_ptr());
+    auto set_config_result = m_hal.apply_graph_edit(edit);
     if (set_config_result != ts::success)
     {
         response = make_error_response(req.get_req_id(), "Cannot set config for node '{}': {}", node_name, set_config_result.error().what());
         serialize_and_send(SETUP_CHANNEL, response);
         return;
     }
-    m_hal.save_settings();
 
     boost::variant<gs_comms::setup::Node_Data, gs_comms::setup::Error> result = get_node_data(node_name, *node);
     if (auto* error = boost::get<gs_comms::setup::Error>(&result))
@@ -887,6 +972,7 @@ void GS_Comms::handle_req(gs_comms::setup::Send_Node_Message_Req const& req)
         return;
     }
 
+    m_hal.wait_for_detached_nodes();
     auto send_message_result = node->send_message(*message);
     if (send_message_result != ts::success)
     {
@@ -60,6 +60,9 @@ public:
 
     auto start_udp(uint16_t send_port, uint16_t receive_port) -> bool;
 
+    //called from the socket thread every time data is received. Has to be set before starting
+    void set_data_received_callback(std::function<void()> callback);
+
     auto is_connected() const -> bool;
 
     void process();
@@ -71,9 +74,10 @@ private:
     {
         std::string stream_path;
         stream::Type stream_type;
-        std::weak_ptr<stream::IStream> stream;
+        Stream_Handle<stream::IStream> stream;
         uint32_t sample_count = 0;
         std::vector<uint8_t> data;
+        uint64_t ring_read_index = std::numeric_limits<uint64_t>::max(); //for streams with a sample ring
     };
     std::vector<Stream_Telemetry_Data> m_stream_telemetry_data;
 
@@ -121,6 +125,7 @@ private:
 
     HAL& m_hal;
     RC_Comms& m_rc_comms;
+    std::function<void()> m_data_received_callback;
     Clock::time_point m_uav_sent_tp = Clock::now();
 
     std::vector<stream::IMultirotor_Commands::Value> m_multirotor_commands_values;
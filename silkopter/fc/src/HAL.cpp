@@ -5,7 +5,9 @@
 #include "HAL.h"
 #include "RC_Comms.h"
 #include "GS_Comms.h"
+#include "Allocation_Tracker.h"
 #include "utils/Timed_Scope.h"
+#include "Profiler.h"
 
 /////////////////////////////////////////////////////////////////////////////////////
 
@@ -28,17 +30,21 @@
 #include "source/UBLOX.h"
 #include "source/CPPM_Receiver.h"
 #include "source/UltimateSensorFusion.h"
+#include "source/Replay.h"
 #include "sink/PIGPIO.h"
 #include "sink/PCA9685.h"
+#include "sink/Recorder.h"
 
 #include "common/stream/IForce.h"
 
 #include "processor/ADC_Voltmeter.h"
 #include "processor/ADC_Ammeter.h"
 #include "processor/Gravity_Filter.h"
+#include "processor/Dynamic_Notch.h"
 #include "processor/Comp_AHRS.h"
 //#include "processor/Comp_ECEF.h"
 #include "processor/KF_ECEF.h"
+#include "processor/ESKF_ECEF.h"
 #include "processor/Motor_Mixer.h"
 #include "processor/Quad_Multirotor_Motor_Mixer.h"
 #include "processor/Servo_Gimbal.h"
@@ -153,6 +159,10 @@ namespace silk
 {
 
 static const std::string k_settings_filename("settings.json");
+
+std::atomic<uint32_t> Graph_Generation::s_generation = { 0 };
+
+constexpr size_t MAX_NODE_WORKER_COUNT = 2;
 extern std::string s_program_path;
 
 
@@ -188,25 +198,60 @@ void HAL::save_settings()
 
     settings.set_uav_descriptor(hal::Poly<const hal::IUAV_Descriptor>(m_uav_descriptor));
 
-    std::vector<hal::Settings::Node_Data>& node_datas = settings.get_nodes();
+    //only the nodes edited since the last save are serialized again
     auto const& nodes = get_node_registry().get_all();
+    std::vector<std::shared_ptr<const ts::sz::Value>> sz_node_datas;
+    sz_node_datas.reserve(nodes.size());
     for (auto const& n: nodes)
     {
-        hal::Settings::Node_Data node_data;
+        std::shared_ptr<const ts::sz::Value>& sz_node_data = m_node_settings_cache[n.name];
+        if (!sz_node_data)
+        {
+            hal::Settings::Node_Data node_data;
 
-        node_data.set_name(n.name);
-        node_data.set_type(n.type);
-        node_data.set_descriptor(hal::Poly<const hal::INode_Descriptor>(n.ptr->get_descriptor()));
-        node_data.set_config(hal::Poly<const hal::INode_Config>(n.ptr->get_config()));
+            node_data.set_name(n.name);
+            node_data.set_type(n.type);
+            node_data.set_descriptor(hal::Poly<const hal::INode_Descriptor>(n.ptr->get_descriptor()));
+            node_data.set_config(hal::Poly<const hal::INode_Config>(n.ptr->get_config()));
 
-        for (auto const& si: n.ptr->get_inputs())
-        {
-            node_data.get_input_paths().push_back(si.stream_path);
+            for (auto const& si: n.ptr->get_inputs())
+            {
+                node_data.get_input_paths().push_back(si.stream_path);
+            }
+
+            sz_node_data = std::make_shared<const ts::sz::Value>(hal::serialize(node_data));
         }
+        sz_node_datas.push_back(sz_node_data);
+    }
+
+    hal::Settings::Frame_Trace& frame_trace = settings.get_frame_trace();
+    frame_trace.set_is_enabled(m_frame_deadline != boost::none);
+    if (m_frame_deadline)
+    {
+        frame_trace.set_deadline_us(static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(*m_frame_deadline).count()));
+    }
+
+    hal::Settings::Real_Time& real_time = settings.get_real_time();
+    real_time.set_is_strict(m_is_real_time_strict);
+    real_time.set_warmup_ms(static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(m_real_time_warmup).count()));
 
-        node_datas.push_back(std::move(node_data));
+    hal::Settings::Threads& threads = settings.get_threads();
+    threads.set_lock_memory(m_lock_memory);
+    for (auto const& p: m_thread_profiles)
+    {
+        hal::Settings::Thread_Profile profile;
+        profile.set_name(p.first);
+        profile.set_policy(static_cast<hal::Settings::Thread_Profile::policy_t>(p.second.policy));
+        profile.set_priority(p.second.priority);
+        profile.set_cpus(p.second.cpus);
+        threads.get_profiles().push_back(std::move(profile));
     }
 
+    hal::Settings::Profiler& profiler = settings.get_profiler();
+    profiler.set_is_enabled(m_is_profiler_enabled);
+    profiler.set_write_trace(m_profiler_write_trace);
+    profiler.set_summary_period_ms(static_cast<uint32_t>(m_profiler_summary_period.count()));
+
     std::vector<hal::Settings::Bus_Data>& bus_datas = settings.get_buses();
     auto const& buses = get_bus_registry().get_all();
     for (auto const& b: buses)
@@ -222,11 +267,33 @@ void HAL::save_settings()
 
     ts::sz::Value sz_value = hal::serialize(settings);
 
-    silk::async(std::function<void()>([sz_value]()
+    silk::async(std::function<void()>([sz_value, sz_node_datas]()
     {
         TIMED_FUNCTION();
 
-        std::string json = ts::sz::to_json(sz_value, true);
+        //the settings were serialized without nodes, put the cached ones in
+        ts::sz::Value sz_nodes(ts::sz::Value::Type::ARRAY);
+        sz_nodes.reserve_array_members(sz_node_datas.size());
+        for (std::shared_ptr<const ts::sz::Value> const& sz_node_data: sz_node_datas)
+        {
+            sz_nodes.add_array_element(*sz_node_data);
+        }
+        ts::sz::Value sz_settings(ts::sz::Value::Type::OBJECT);
+        sz_settings.reserve_object_members(sz_value.get_object_member_count());
+        for (size_t i = 0; i < sz_value.get_object_member_count(); i++)
+        {
+            std::string const& name = sz_value.get_object_member_name(i);
+            if (name == "nodes")
+            {
+                sz_settings.add_object_member(name, std::move(sz_nodes));
+            }
+            else
+            {
+                sz_settings.add_object_member(name, sz_value.get_object_member_value(i));
+            }
+        }
+
+        std::string json = ts::sz::to_json(sz_settings, true);
 
         std::string settings_path = s_program_path + "/" + k_settings_filename;
         std::ofstream fs(settings_path);
@@ -247,6 +314,39 @@ HAL::Telemetry_Data const& HAL::get_telemetry_data() const
     return m_telemetry_data;
 }
 
+auto HAL::get_frame_deadline() const -> boost::optional<Clock::duration>
+{
+    return m_frame_deadline;
+}
+
+void HAL::set_virtual_clock(Manual_Clock const* clock)
+{
+    if (clock != m_virtual_clock)
+    {
+        m_virtual_clock = clock;
+        m_executor.restart_rate_groups();
+    }
+}
+auto HAL::get_virtual_clock() const -> Manual_Clock const*
+{
+    return m_virtual_clock;
+}
+
+auto HAL::get_source_rates() const -> std::vector<uint32_t> const&
+{
+    return m_source_rates;
+}
+
+auto HAL::get_data_ready_fds() const -> std::vector<int> const&
+{
+    return m_data_ready_fds;
+}
+
+void HAL::add_wakeup_latency(Clock::duration latency)
+{
+    m_telemetry_data.crt_wakeup_latency.add(latency);
+}
+
 HAL::Bus_Factory const& HAL::get_bus_factory() const
 {
     return m_bus_factory;
@@ -358,7 +458,7 @@ auto HAL::get_uav_properties() const -> std::shared_ptr<const IUAV_Properties>
     return m_uav_properties;
 }
 
-auto HAL::remove_node(std::shared_ptr<node::INode> node) -> bool
+void HAL::remove_node(std::shared_ptr<node::INode> node)
 {
     m_nodes.remove(node);
     std::vector<node::INode::Output> outputs = node->get_outputs();
@@ -366,7 +466,6 @@ auto HAL::remove_node(std::shared_ptr<node::INode> node) -> bool
     {
         m_streams.remove(output.stream);
     }
-    return true;
 }
 
 template<class T>
@@ -434,20 +533,613 @@ ts::Result<std::shared_ptr<node::INode>> HAL::create_node(std::string const& typ
         std::string stream_name = q::util::format<std::string>("{}/{}", name, x.name);
         if (!m_streams.add(stream_name, std::string(), x.stream))
         {
-            m_nodes.remove(node);
+            remove_node(node);
             return make_error("Cannot add stream '{}'", stream_name);
         }
     }
     return node;
 }
 
-void HAL::sort_nodes(std::shared_ptr<node::INode> first_node)
+//Tarjan's algorithm over the nodes not scheduled yet, following the producer -> consumer edges.
+//Fills the strongly connected component of each of them, scheduled nodes get UNSET
+constexpr size_t UNSET = std::numeric_limits<size_t>::max();
+
+struct Unscheduled_Components
 {
-    QASSERT(first_node);
-    if (!first_node)
+    Unscheduled_Components(std::vector<std::vector<size_t>> const& _consumers, std::vector<bool> const& _scheduled)
+        : consumers(_consumers)
+        , scheduled(_scheduled)
+        , indices(_consumers.size(), UNSET)
+        , low_links(_consumers.size(), 0)
+        , on_stack(_consumers.size(), false)
+        , components(_consumers.size(), UNSET)
     {
-        return;
+        for (size_t i = 0; i < consumers.size(); i++)
+        {
+            if (!scheduled[i] && indices[i] == UNSET)
+            {
+                visit(i);
+            }
+        }
+    }
+
+    void visit(size_t v)
+    {
+        indices[v] = next_index;
+        low_links[v] = next_index;
+        next_index++;
+        stack.push_back(v);
+        on_stack[v] = true;
+
+        for (size_t c: consumers[v])
+        {
+            if (scheduled[c])
+            {
+                continue;
+            }
+            if (indices[c] == UNSET)
+            {
+                visit(c);
+                low_links[v] = std::min(low_links[v], low_links[c]);
+            }
+            else if (on_stack[c])
+            {
+                low_links[v] = std::min(low_links[v], indices[c]);
+            }
+        }
+
+        if (low_links[v] == indices[v])
+        {
+            size_t w = UNSET;
+            do
+            {
+                w = stack.back();
+                stack.pop_back();
+                on_stack[w] = false;
+                components[w] = component_count;
+            } while (w != v);
+            component_count++;
+        }
+    }
+
+    std::vector<std::vector<size_t>> const& consumers;
+    std::vector<bool> const& scheduled;
+    std::vector<size_t> indices;
+    std::vector<size_t> low_links;
+    std::vector<bool> on_stack;
+    std::vector<size_t> stack;
+    size_t next_index = 0;
+
+    std::vector<size_t> components;
+    size_t component_count = 0;
+};
+
+void HAL::sort_nodes()
+{
+    QLOG_TOPIC("hal::sort_nodes");
+
+    std::vector<Node_Registry::Item> const& items = m_nodes.get_all();
+    size_t const count = items.size();
+
+    //map each stream path to the index of the node producing it
+    std::map<std::string, size_t> producers;
+    for (size_t i = 0; i < count; i++)
+    {
+        for (node::INode::Output const& output: items[i].ptr->get_outputs())
+        {
+            producers[q::util::format<std::string>("{}/{}", items[i].name, output.name)] = i;
+        }
+    }
+
+    //for each node count how many producers it waits for and remember who consumes its outputs
+    std::vector<size_t> dependency_counts(count, 0);
+    std::vector<std::vector<size_t>> consumers(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        for (node::INode::Input const& input: items[i].ptr->get_inputs())
+        {
+            auto it = producers.find(input.stream_path);
+            if (it == producers.end() || it->second == i)
+            {
+                continue;
+            }
+            dependency_counts[i]++;
+            consumers[it->second].push_back(i);
+        }
+    }
+
+    //Kahn's algorithm. Ready nodes are picked in registry order to keep the schedule stable between sorts
+    std::set<size_t> ready;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (dependency_counts[i] == 0)
+        {
+            ready.insert(i);
+        }
+    }
+
+    std::vector<bool> scheduled(count, false);
+    std::vector<size_t> sorted_indices;
+    sorted_indices.reserve(count);
+    while (sorted_indices.size() < count)
+    {
+        if (ready.empty())
+        {
+            //only nodes waiting on each other or on a cycle are left (like a simulator fed by the motors it drives, and
+            // the sinks of those motors). A component no other unscheduled node feeds is a cycle with all its outside
+            // producers scheduled, so break that one at its first node in registry order. Its inputs coming from
+            // inside the cycle will be one frame late.
+            Unscheduled_Components scc(consumers, scheduled);
+            std::vector<bool> is_fed(scc.component_count, false);
+            for (size_t i = 0; i < count; i++)
+            {
+                if (scheduled[i])
+                {
+                    continue;
+                }
+                for (size_t c: consumers[i])
+                {
+                    if (!scheduled[c] && scc.components[c] != scc.components[i])
+                    {
+                        is_fed[scc.components[c]] = true;
+                    }
+                }
+            }
+            size_t first = count;
+            for (size_t i = 0; i < count && first == count; i++)
+            {
+                if (!scheduled[i] && !is_fed[scc.components[i]])
+                {
+                    first = i;
+                }
+            }
+            QASSERT(first < count);
+
+            std::string names;
+            for (size_t i = 0; i < count; i++)
+            {
+                if (!scheduled[i] && scc.components[i] == scc.components[first])
+                {
+                    names += names.empty() ? items[i].name : ", " + items[i].name;
+                }
+            }
+            QLOGW("Dependency cycle detected between nodes: {}. Breaking it at node '{}'", names, items[first].name);
+            dependency_counts[first] = 0;
+            ready.insert(first);
+        }
+
+        size_t idx = *ready.begin();
+        ready.erase(ready.begin());
+        scheduled[idx] = true;
+        sorted_indices.push_back(idx);
+
+        for (size_t c: consumers[idx])
+        {
+            if (!scheduled[c] && dependency_counts[c] > 0 && --dependency_counts[c] == 0)
+            {
+                ready.insert(c);
+            }
+        }
+    }
+
+    std::vector<Node_Registry::Item> sorted;
+    sorted.reserve(count);
+    for (size_t idx: sorted_indices)
+    {
+        sorted.push_back(items[idx]);
+    }
+    m_nodes.set_all(sorted);
+
+    set_schedule();
+}
+
+void HAL::update_schedule(std::set<std::string> const& edited_node_names)
+{
+    QLOG_TOPIC("hal::update_schedule");
+
+    //The registry was in schedule order before the edit. Removing nodes keeps it ordered and added nodes are at the end,
+    // so it's still a valid order unless an edited node now reads a stream produced after it.
+    std::vector<Node_Registry::Item> const& items = m_nodes.get_all();
+    std::map<std::string, size_t> positions;
+    std::map<std::string, size_t> producers;
+    for (size_t i = 0; i < items.size(); i++)
+    {
+        positions[items[i].name] = i;
+        for (node::INode::Output const& output: items[i].ptr->get_outputs())
+        {
+            producers[q::util::format<std::string>("{}/{}", items[i].name, output.name)] = i;
+        }
+    }
+
+    for (std::string const& name: edited_node_names)
+    {
+        auto it = positions.find(name);
+        if (it == positions.end())
+        {
+            continue; //removed
+        }
+        for (node::INode::Input const& input: items[it->second].ptr->get_inputs())
+        {
+            auto producer_it = producers.find(input.stream_path);
+            if (producer_it != producers.end() && producer_it->second > it->second)
+            {
+                QLOGI("Node '{}' reads from '{}' which runs after it, sorting all nodes", name, input.stream_path);
+                sort_nodes();
+                return;
+            }
+        }
+    }
+
+    set_schedule();
+}
+
+void HAL::set_schedule()
+{
+    std::vector<Node_Registry::Item> const& sorted = m_nodes.get_all();
+    size_t const count = sorted.size();
+
+    //consumers of each node, by schedule position
+    std::map<std::string, size_t> producers;
+    for (size_t i = 0; i < count; i++)
+    {
+        for (node::INode::Output const& output: sorted[i].ptr->get_outputs())
+        {
+            producers[q::util::format<std::string>("{}/{}", sorted[i].name, output.name)] = i;
+        }
+    }
+    std::vector<std::vector<size_t>> consumers(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        for (node::INode::Input const& input: sorted[i].ptr->get_inputs())
+        {
+            auto it = producers.find(input.stream_path);
+            if (it != producers.end() && it->second != i)
+            {
+                consumers[it->second].push_back(i);
+            }
+        }
+    }
+
+    m_source_rates.clear();
+    m_data_ready_fds.clear();
+    for (Node_Registry::Item const& item: sorted)
+    {
+        int fd = item.ptr->get_data_ready_fd();
+        if (fd >= 0)
+        {
+            m_data_ready_fds.push_back(fd);
+        }
+
+        node::Type type = item.ptr->get_type();
+        if (type == node::Type::SOURCE || type == node::Type::GENERATOR || type == node::Type::SIMULATOR)
+        {
+            for (node::INode::Output const& output: item.ptr->get_outputs())
+            {
+                m_source_rates.push_back(output.stream->get_rate());
+            }
+        }
+    }
+    std::sort(m_source_rates.begin(), m_source_rates.end());
+    m_source_rates.erase(std::unique(m_source_rates.begin(), m_source_rates.end()), m_source_rates.end());
+
+    //the dependencies in schedule order for the executor
+    std::vector<std::vector<size_t>> dependencies(count);
+    for (size_t p = 0; p < count; p++)
+    {
+        for (size_t c: consumers[p])
+        {
+            //edges broken to solve cycles are reversed so the producer still doesn't run at the same time as its consumer
+            if (p < c)
+            {
+                dependencies[c].push_back(p);
+            }
+            else
+            {
+                dependencies[p].push_back(c);
+            }
+        }
+    }
+
+    //nodes sharing a bus cannot run in parallel so chain them in schedule order
+    std::vector<std::vector<size_t>> bus_dependencies(count);
+    std::map<std::string, size_t> last_bus_users;
+    for (size_t i = 0; i < count; i++)
+    {
+        std::string bus_name = sorted[i].ptr->get_bus_name();
+        if (!bus_name.empty())
+        {
+            auto it = last_bus_users.find(bus_name);
+            if (it != last_bus_users.end())
+            {
+                bus_dependencies[i].push_back(it->second);
+            }
+            last_bus_users[bus_name] = i;
+        }
+    }
+
+    //a node has to keep up with its fastest input and output stream
+    std::vector<node::INode*> nodes(count);
+    std::vector<std::string> names(count);
+    std::vector<uint32_t> rates(count, 0);
+    for (size_t i = 0; i < count; i++)
+    {
+        nodes[i] = sorted[i].ptr.get();
+        names[i] = sorted[i].name;
+        for (node::INode::Output const& output: sorted[i].ptr->get_outputs())
+        {
+            rates[i] = std::max(rates[i], output.stream->get_rate());
+        }
+        for (node::INode::Input const& input: sorted[i].ptr->get_inputs())
+        {
+            if (!input.stream_path.empty())
+            {
+                rates[i] = std::max(rates[i], input.rate);
+            }
+        }
+    }
+    m_executor.set_graph(nodes, names, dependencies, bus_dependencies, rates);
+
+    //nodes that are still there keep their stats
+    std::vector<Telemetry_Data::Node> old_telemetry_nodes = std::move(m_telemetry_data.nodes);
+    m_telemetry_data.nodes.clear();
+    m_telemetry_data.nodes.resize(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        auto it = std::find_if(old_telemetry_nodes.begin(), old_telemetry_nodes.end(), [&sorted, i](Telemetry_Data::Node const& n) { return n.name == sorted[i].name; });
+        if (it != old_telemetry_nodes.end())
+        {
+            m_telemetry_data.nodes[i] = std::move(*it);
+        }
+        m_telemetry_data.nodes[i].name = sorted[i].name;
+    }
+
+    m_telemetry_data.branches.clear();
+    m_telemetry_data.branches.resize(m_executor.get_branch_count());
+    for (size_t b = 0; b < m_executor.get_branch_count(); b++)
+    {
+        std::vector<size_t> const& branch_nodes = m_executor.get_branch_nodes(b);
+        QASSERT(!branch_nodes.empty());
+        Telemetry_Data::Branch& branch = m_telemetry_data.branches[b];
+        branch.name = sorted[branch_nodes.front()].name;
+        if (branch_nodes.size() > 1)
+        {
+            branch.name += ".." + sorted[branch_nodes.back()].name;
+        }
+    }
+}
+
+void HAL::Graph_Edit::add_node(std::string const& type, std::string const& name, std::shared_ptr<const hal::INode_Descriptor> descriptor)
+{
+    Operation op;
+    op.type = Operation::Type::ADD_NODE;
+    op.node_type = type;
+    op.node_name = name;
+    op.descriptor = std::move(descriptor);
+    m_operations.push_back(std::move(op));
+}
+void HAL::Graph_Edit::remove_node(std::string const& name)
+{
+    Operation op;
+    op.type = Operation::Type::REMOVE_NODE;
+    op.node_name = name;
+    m_operations.push_back(std::move(op));
+}
+void HAL::Graph_Edit::set_input_stream_path(std::string const& node_name, size_t input_idx, std::string const& stream_path)
+{
+    Operation op;
+    op.type = Operation::Type::SET_INPUT_STREAM_PATH;
+    op.node_name = node_name;
+    op.input_idx = input_idx;
+    op.stream_path = stream_path;
+    m_operations.push_back(std::move(op));
+}
+void HAL::Graph_Edit::set_node_config(std::string const& node_name, std::shared_ptr<const hal::INode_Config> config)
+{
+    Operation op;
+    op.type = Operation::Type::SET_NODE_CONFIG;
+    op.node_name = node_name;
+    op.config = std::move(config);
+    m_operations.push_back(std::move(op));
+}
+bool HAL::Graph_Edit::is_empty() const
+{
+    return m_operations.empty();
+}
+
+void HAL::Graph_Edit_Rollback::save_node_state(std::shared_ptr<node::INode> const& node)
+{
+    auto it = std::find_if(node_states.begin(), node_states.end(), [&node](Node_State const& state) { return state.node == node; });
+    if (it != node_states.end())
+    {
+        return; //only the state before the edit matters
+    }
+
+    Node_State state;
+    state.node = node;
+    for (node::INode::Input const& input: node->get_inputs())
+    {
+        state.input_paths.push_back(input.stream_path);
+    }
+    //configs are changed in place so keep a serialized copy
+    state.config = hal::serialize(hal::Poly<const hal::INode_Config>(node->get_config()));
+    node_states.push_back(std::move(state));
+}
+
+ts::Result<void> HAL::apply_graph_operation(Graph_Edit::Operation const& op, Graph_Edit_Rollback& rollback, std::set<std::string>& edited_node_names)
+{
+    typedef Graph_Edit::Operation::Type Type;
+
+    if (op.type == Type::ADD_NODE)
+    {
+        if (!op.descriptor)
+        {
+            return make_error("No descriptor for node '{}'", op.node_name);
+        }
+        ts::Result<std::shared_ptr<node::INode>> result = create_node(op.node_type, op.node_name, *op.descriptor);
+        if (result != ts::success)
+        {
+            return make_error("Cannot create node '{}' of type '{}': {}", op.node_name, op.node_type, result.error().what());
+        }
+        rollback.added_nodes.push_back(result.payload());
+        edited_node_names.insert(op.node_name);
+        return ts::success;
+    }
+
+    std::shared_ptr<node::INode> node = m_nodes.find_by_name<node::INode>(op.node_name);
+    if (!node)
+    {
+        return make_error("Cannot find node '{}'", op.node_name);
+    }
+    edited_node_names.insert(op.node_name);
+
+    if (op.type == Type::REMOVE_NODE)
+    {
+        //disconnect the nodes reading its streams
+        std::set<std::string> stream_paths;
+        for (node::INode::Output const& output: node->get_outputs())
+        {
+            stream_paths.insert(q::util::format<std::string>("{}/{}", op.node_name, output.name));
+        }
+        for (Node_Registry::Item const& item: m_nodes.get_all())
+        {
+            if (item.ptr == node)
+            {
+                continue;
+            }
+            std::vector<node::INode::Input> inputs = item.ptr->get_inputs();
+            for (size_t i = 0; i < inputs.size(); i++)
+            {
+                if (stream_paths.find(inputs[i].stream_path) != stream_paths.end())
+                {
+                    rollback.save_node_state(item.ptr);
+                    ts::Result<void> result = item.ptr->set_input_stream_path(i, std::string());
+                    if (result != ts::success)
+                    {
+                        return make_error("Cannot disconnect node '{}' from '{}': {}", item.name, inputs[i].stream_path, result.error().what());
+                    }
+                    edited_node_names.insert(item.name);
+                }
+            }
+        }
+        remove_node(node);
+        return ts::success;
+    }
+
+    rollback.save_node_state(node);
+
+    if (op.type == Type::SET_INPUT_STREAM_PATH)
+    {
+        if (op.input_idx >= node->get_inputs().size())
+        {
+            return make_error("Node '{}' has no input {}", op.node_name, op.input_idx);
+        }
+        ts::Result<void> result = node->set_input_stream_path(op.input_idx, op.stream_path);
+        if (result != ts::success)
+        {
+            return make_error("Cannot set input {} of node '{}': {}", op.input_idx, op.node_name, result.error().what());
+        }
+        return ts::success;
+    }
+
+    QASSERT(op.type == Type::SET_NODE_CONFIG);
+    if (!op.config)
+    {
+        return make_error("No config for node '{}'", op.node_name);
+    }
+    ts::Result<void> result = node->set_config(*op.config);
+    if (result != ts::success)
+    {
+        return make_error("Cannot set config for node '{}': {}", op.node_name, result.error().what());
+    }
+    return ts::success;
+}
+
+void HAL::rollback_graph_edit(Graph_Edit_Rollback& rollback)
+{
+    QLOG_TOPIC("hal::rollback_graph_edit");
+
+    //the removed nodes and streams come back first so the inputs can be bound to them again
+    m_nodes.set_all(rollback.nodes);
+    m_streams.set_all(rollback.streams);
+
+    for (Graph_Edit_Rollback::Node_State const& state: rollback.node_states)
+    {
+        for (size_t i = 0; i < state.input_paths.size(); i++)
+        {
+            ts::Result<void> result = state.node->set_input_stream_path(i, state.input_paths[i]);
+            if (result != ts::success)
+            {
+                QLOGE("Cannot restore input stream '{}': {}", state.input_paths[i], result.error().what());
+            }
+        }
+
+        hal::Poly<const hal::INode_Config> config;
+        ts::Result<void> result = hal::deserialize(config, state.config);
+        if (result == ts::success && config)
+        {
+            result = state.node->set_config(*config);
+        }
+        if (result != ts::success)
+        {
+            QLOGE("Cannot restore config: {}", result.error().what());
+        }
+    }
+}
+
+ts::Result<void> HAL::apply_graph_edit(Graph_Edit const& edit)
+{
+    QLOG_TOPIC("hal::apply_graph_edit");
+
+    wait_for_detached_nodes();
+
+    //new nodes and configs allocate until they settle
+    restart_real_time_warmup();
+
+    Graph_Edit_Rollback rollback;
+    rollback.nodes = m_nodes.get_all();
+    rollback.streams = m_streams.get_all();
+
+    std::set<std::string> edited_node_names;
+    bool is_topology_changed = false;
+    for (Graph_Edit::Operation const& op: edit.m_operations)
+    {
+        is_topology_changed |= op.type != Graph_Edit::Operation::Type::SET_NODE_CONFIG;
+        ts::Result<void> result = apply_graph_operation(op, rollback, edited_node_names);
+        if (result != ts::success)
+        {
+            rollback_graph_edit(rollback);
+            return result;
+        }
     }
+
+    //the added nodes start only once the whole edit went through
+    Clock::time_point now = Clock::now();
+    for (Node_Registry::Item const& item: m_nodes.get_all())
+    {
+        if (std::find(rollback.added_nodes.begin(), rollback.added_nodes.end(), item.ptr) != rollback.added_nodes.end())
+        {
+            ts::Result<void> result = item.ptr->start(now);
+            if (result != ts::success)
+            {
+                rollback_graph_edit(rollback);
+                return make_error("Cannot start node '{}': {}", item.name, result.error().what());
+            }
+        }
+    }
+
+    for (std::string const& name: edited_node_names)
+    {
+        m_node_settings_cache.erase(name);
+    }
+
+    //config changes don't touch the executor
+    if (is_topology_changed)
+    {
+        update_schedule(edited_node_names);
+    }
+    save_settings();
+
+    return ts::success;
 }
 
 auto HAL::init(RC_Comms& rc_comms, GS_Comms& gs_comms) -> bool
@@ -489,9 +1181,11 @@ auto HAL::init(RC_Comms& rc_comms, GS_Comms& gs_comms) -> bool
     m_node_factory.add<UBLOX>("UBLOX", *this);
     m_node_factory.add<CPPM_Receiver>("CPPM Receiver", *this);
     m_node_factory.add<UltimateSensorFusion>("Ultimate Sensor Fusion", *this);
+    m_node_factory.add<Replay>("Replay", *this);
 
     m_node_factory.add<PIGPIO>("PIGPIO", *this);
     m_node_factory.add<PCA9685>("PCA9685", *this);
+    m_node_factory.add<Recorder>("Recorder", *this);
 
     m_node_factory.add<Multirotor_Brain>("Multirotor Brain", *this);
     m_node_factory.add<Multirotor_Pilot>("Multirotor Pilot", *this, rc_comms);
@@ -501,7 +1195,9 @@ auto HAL::init(RC_Comms& rc_comms, GS_Comms& gs_comms) -> bool
     m_node_factory.add<Comp_AHRS>("Comp AHRS", *this);
 //    m_node_factory.add<Comp_ECEF>("Comp ECEF", *this);
     m_node_factory.add<KF_ECEF>("EKF ECEF", *this);
+    m_node_factory.add<ESKF_ECEF>("ESKF ECEF", *this);
     m_node_factory.add<Gravity_Filter>("Gravity Filter", *this);
+    m_node_factory.add<Dynamic_Notch>("Dynamic Notch", *this);
     m_node_factory.add<Throttle_To_PWM>("Throttle To PWM", *this);
     m_node_factory.add<Proximity>("Proximity", *this);
     m_node_factory.add<Pressure_Velocity>("Pressure Velocity", *this);
@@ -700,6 +1396,8 @@ auto HAL::init(RC_Comms& rc_comms, GS_Comms& gs_comms) -> bool
     //clear
     m_streams.remove_all();
     m_nodes.remove_all();
+    m_node_settings_cache.clear();
+    m_thread_profiles = make_default_thread_profiles();
 
     std::string data;
 
@@ -737,6 +1435,45 @@ auto HAL::init(RC_Comms& rc_comms, GS_Comms& gs_comms) -> bool
         return false;
     }
 
+    {
+        hal::Settings::Frame_Trace const& frame_trace = settings.get_frame_trace();
+        m_frame_deadline = boost::none;
+        if (frame_trace.get_is_enabled())
+        {
+            m_frame_deadline = std::chrono::microseconds(frame_trace.get_deadline_us());
+        }
+    }
+    {
+        hal::Settings::Real_Time const& real_time = settings.get_real_time();
+        m_is_real_time_strict = real_time.get_is_strict();
+        m_real_time_warmup = std::chrono::milliseconds(real_time.get_warmup_ms());
+    }
+    {
+        //older settings don't have thread profiles, keep the defaults for those
+        hal::Settings::Threads const& threads = settings.get_threads();
+        m_lock_memory = threads.get_lock_memory();
+        if (!threads.get_profiles().empty())
+        {
+            m_thread_profiles.clear();
+            for (hal::Settings::Thread_Profile const& p: threads.get_profiles())
+            {
+                util::Thread_Registry::Profile profile;
+                profile.policy = static_cast<util::Thread_Registry::Policy>(p.get_policy());
+                profile.priority = p.get_priority();
+                profile.cpus = p.get_cpus();
+                m_thread_profiles[p.get_name()] = profile;
+            }
+        }
+        apply_thread_profiles();
+    }
+    {
+        hal::Settings::Profiler const& profiler = settings.get_profiler();
+        m_is_profiler_enabled = profiler.get_is_enabled();
+        m_profiler_write_trace = profiler.get_write_trace();
+        m_profiler_summary_period = std::chrono::milliseconds(profiler.get_summary_period_ms());
+        apply_profiler_settings();
+    }
+
     if (settings.get_uav_descriptor())
     {
         auto result = set_uav_descriptor(settings.get_uav_descriptor().get_shared_ptr());
@@ -795,6 +1532,13 @@ auto HAL::init(RC_Comms& rc_comms, GS_Comms& gs_comms) -> bool
         }
     }
 
+    //now that all the inputs are connected, order the nodes by their dependencies
+    sort_nodes();
+
+    //the main thread is one of the workers as well. Leave one core for comms and the async io
+    size_t core_count = std::max(std::thread::hardware_concurrency(), 1u);
+    m_executor.start(std::min<size_t>(core_count - 1, MAX_NODE_WORKER_COUNT));
+
     //start the system
     auto now = Clock::now();
     for (auto const& n: m_nodes.get_all())
@@ -808,24 +1552,148 @@ auto HAL::init(RC_Comms& rc_comms, GS_Comms& gs_comms) -> bool
     }
 
     save_settings();
+    restart_real_time_warmup();
 
     return true;
 }
 
+auto HAL::make_default_thread_profiles() -> std::map<std::string, util::Thread_Registry::Profile>
+{
+    typedef util::Thread_Registry::Policy Policy;
+    typedef util::Thread_Registry::Profile Profile;
+
+    std::map<std::string, Profile> profiles;
+
+#if defined RASPBERRY_PI
+    //The rate loop owns the cores from 1 up: the main thread at the top priority and the node workers pinned one per core just below it.
+    //Everything else shares core 0 below the rate loop so comms bursts can't preempt it.
+    size_t core_count = std::max(std::thread::hardware_concurrency(), 1u);
+    profiles["main"] = Profile { Policy::FIFO, 99, {} };
+    for (size_t i = 1; i <= MAX_NODE_WORKER_COUNT; i++)
+    {
+        profiles["node worker " + std::to_string(i)] = Profile { Policy::FIFO, 98, { static_cast<uint32_t>(i % core_count) } };
+    }
+    profiles["rc phy"] = Profile { Policy::FIFO, 10, { 0 } };
+    profiles["fec tx"] = Profile { Policy::FIFO, 10, { 0 } };
+    profiles["fec rx"] = Profile { Policy::FIFO, 10, { 0 } };
+    profiles["rfmon tx"] = Profile { Policy::FIFO, 10, { 0 } };
+    profiles["rfmon rx"] = Profile { Policy::FIFO, 10, { 0 } };
+    profiles["rf4463"] = Profile { Policy::FIFO, 10, { 0 } };
+    profiles["udp io"] = Profile { Policy::OTHER, 0, { 0 } };
+    profiles["opencv capture"] = Profile { Policy::OTHER, 0, { 0 } };
+    profiles["raspicam recording"] = Profile { Policy::IDLE, 0, { 0 } };
+    profiles["recorder io"] = Profile { Policy::OTHER, 0, { 0 } };
+    profiles["log"] = Profile { Policy::OTHER, 0, { 0 } };
+    profiles["profiler"] = Profile { Policy::OTHER, 0, { 0 } };
+    profiles["async"] = Profile { Policy::IDLE, 0, { 0 } };
+#endif
+
+    return profiles;
+}
+
+void HAL::apply_thread_profiles()
+{
+    util::Thread_Registry::clear_profiles();
+    for (auto const& p: m_thread_profiles)
+    {
+        util::Thread_Registry::set_profile(p.first, p.second);
+    }
+    if (m_lock_memory)
+    {
+        util::Thread_Registry::lock_memory();
+    }
+}
+
+void HAL::apply_profiler_settings()
+{
+    q::profiler::stop();
+    if (!m_is_profiler_enabled)
+    {
+        return;
+    }
+
+#if !defined(__PROFILER_ENABLED__)
+    QLOGW("The profiler is enabled in the settings but the FC was built without the profiler zones");
+#endif
+
+    q::profiler::Settings settings;
+    if (m_profiler_write_trace)
+    {
+        settings.trace_path = s_program_path + "/profiler_trace.json";
+    }
+    settings.summary_period = m_profiler_summary_period;
+    settings.thread_init = []() { util::Thread_Registry::register_current_thread("profiler"); };
+    if (!q::profiler::start(settings))
+    {
+        QLOGW("Cannot start the profiler");
+    }
+}
+
+void HAL::read_thread_stats()
+{
+    //publish what was read last time and start reading the next ones
+    std::shared_ptr<Thread_Stats_State> state = m_thread_stats_state;
+    {
+        std::lock_guard<std::mutex> lg(state->mutex);
+        m_telemetry_data.threads = state->threads;
+    }
+    if (state->is_reading.exchange(true))
+    {
+        return; //the async thread is lagging, skip a second
+    }
+
+    silk::async(std::function<void()>([state]()
+    {
+        std::vector<util::Thread_Registry::Stats> stats = util::Thread_Registry::read_stats();
+        Clock::time_point now = Clock::now();
+        float dt = std::max(std::chrono::duration<float>(now - state->last_tp).count(), 0.001f);
+
+        std::vector<Telemetry_Data::Thread> threads(stats.size());
+        for (size_t i = 0; i < stats.size(); i++)
+        {
+            util::Thread_Registry::Stats const& s = stats[i];
+            threads[i].name = s.name;
+
+            auto it = std::find_if(state->last_stats.begin(), state->last_stats.end(), [&s](util::Thread_Registry::Stats const& ls) { return ls.tid == s.tid; });
+            if (it != state->last_stats.end())
+            {
+                threads[i].cpu_usage = std::chrono::duration<float>(s.cpu_time - it->cpu_time).count() / dt;
+                threads[i].involuntary_context_switches = static_cast<uint32_t>((s.involuntary_context_switches - it->involuntary_context_switches) / dt + 0.5f);
+            }
+        }
+
+        state->last_stats = std::move(stats);
+        state->last_tp = now;
+        {
+            std::lock_guard<std::mutex> lg(state->mutex);
+            state->threads = std::move(threads);
+        }
+        state->is_reading = false;
+    }));
+}
+
+void HAL::wait_for_detached_nodes()
+{
+    m_executor.wait_for_detached_branches();
+}
+
+void HAL::restart_real_time_warmup()
+{
+    Allocation_Tracker::set_strict(false);
+    m_real_time_warmup_tp = Clock::now();
+}
+
 void HAL::shutdown()
 {
+    m_executor.stop();
+    q::profiler::stop();
+
 #if defined (RASPBERRY_PI)
     shutdown_bcm();
     shutdown_pigpio();
 #endif
 }
 
-void HAL::remove_add_nodes()
-{
-    m_streams.remove_all();
-    m_nodes.remove_all();
-}
-
 void HAL::generate_settings_file()
 {
 #if defined RASPBERRY_PI
@@ -913,25 +1781,42 @@ void HAL::generate_settings_file()
 
 void HAL::process()
 {
+    PROFILE_SCOPED();
+
 //    for (auto const& n: m_buses.get_all())
 //    {
 //        n->process();
 //    }
 
-    auto now = Clock::now();
+    auto total_start = Clock::now();
 
-    auto total_start = now;
-    auto node_start = total_start;
+    m_executor.process(m_virtual_clock ? m_virtual_clock->now() : total_start);
 
-    for (auto const& n: m_nodes.get_all())
+    //the node id is the position in the schedule so this is just an index, no lookup
+    for (size_t i = 0; i < m_telemetry_data.nodes.size(); i++)
     {
-        n.ptr->process();
-
-        auto now = Clock::now();
-        Telemetry_Data::Node& node_telemetry = m_telemetry_data.nodes[n.name];
-        node_telemetry.crt_process_duration += now - node_start;
-        node_telemetry.crt_max_process_duration = std::max(node_telemetry.crt_max_process_duration, now - node_start);
-        node_start = now;
+        if (!m_executor.was_node_processed(i))
+        {
+            continue; //not in this frame's rate group
+        }
+        auto dt = m_executor.get_node_duration(i);
+        Telemetry_Data::Node& node_telemetry = m_telemetry_data.nodes[i];
+        node_telemetry.crt_process_duration += dt;
+        node_telemetry.crt_process_histogram.add(dt);
+        node_telemetry.crt_allocation_count += m_executor.get_node_allocation_count(i);
+
+        Clock::duration input_age;
+        if (m_executor.get_node_input_age(i, input_age))
+        {
+            node_telemetry.crt_input_age_histogram.add(input_age);
+        }
+    }
+    for (size_t i = 0; i < m_telemetry_data.branches.size(); i++)
+    {
+        auto dt = m_executor.get_branch_duration(i);
+        Telemetry_Data::Branch& branch_telemetry = m_telemetry_data.branches[i];
+        branch_telemetry.crt_process_duration += dt;
+        branch_telemetry.crt_max_process_duration = std::max(branch_telemetry.crt_max_process_duration, dt);
     }
 
     {
@@ -956,14 +1841,64 @@ void HAL::process()
             m_telemetry_data.crt_total_duration = Clock::duration(0);
             m_telemetry_data.crt_max_total_duration = Clock::duration(0);
 
-            for (auto& pair: m_telemetry_data.nodes)
+            m_telemetry_data.wakeup_latency = m_telemetry_data.crt_wakeup_latency;
+            m_telemetry_data.crt_wakeup_latency.clear();
+
+            if (now - m_last_thread_stats_tp >= std::chrono::seconds(1))
+            {
+                m_last_thread_stats_tp = now;
+                read_thread_stats();
+            }
+
+            if (m_is_real_time_strict && !Allocation_Tracker::is_strict() && now - m_real_time_warmup_tp >= m_real_time_warmup)
+            {
+                QLOGI("Real-time warmup done, heap allocations in nodes will abort from now on");
+                Allocation_Tracker::set_strict(true);
+            }
+
+            for (Telemetry_Data::Node& node: m_telemetry_data.nodes)
             {
-                Telemetry_Data::Node& node = pair.second;
                 node.process_duration = std::chrono::duration_cast<Clock::duration>(node.crt_process_duration * mu);
-                node.max_process_duration = std::chrono::duration_cast<Clock::duration>(node.crt_max_process_duration);
+                node.process_histogram = node.crt_process_histogram;
+
+                node.allocation_count = static_cast<uint32_t>(node.crt_allocation_count * mu + 0.5f);
+                node.input_age_histogram = node.crt_input_age_histogram;
 
                 node.crt_process_duration = Clock::duration(0);
-                node.crt_max_process_duration = Clock::duration(0);
+                node.crt_process_histogram.clear();
+                node.crt_allocation_count = 0;
+                node.crt_input_age_histogram.clear();
+            }
+            auto const& buses = m_buses.get_all();
+            m_telemetry_data.buses.resize(buses.size());
+            for (size_t i = 0; i < buses.size(); i++)
+            {
+                Telemetry_Data::Bus& bus = m_telemetry_data.buses[i];
+                bus.name = buses[i].name;
+
+                buses[i].ptr->get_stats().latch(m_bus_stats_clients);
+                bus.clients.resize(m_bus_stats_clients.size());
+                for (size_t c = 0; c < m_bus_stats_clients.size(); c++)
+                {
+                    util::hw::Bus_Stats::Client const& stats = m_bus_stats_clients[c];
+                    Telemetry_Data::Bus::Client& client = bus.clients[c];
+                    client.address = stats.address;
+                    client.transaction_count = static_cast<uint32_t>(stats.transaction_count * mu + 0.5f);
+                    client.byte_count = static_cast<uint32_t>(stats.byte_count * mu + 0.5f);
+                    client.error_count = static_cast<uint32_t>(stats.error_count * mu + 0.5f);
+                    client.busy_count = static_cast<uint32_t>(stats.busy_count * mu + 0.5f);
+                    client.usage = std::chrono::duration<float>(stats.total_duration).count() * mu;
+                    client.duration_histogram = stats.duration_histogram;
+                }
+            }
+
+            for (Telemetry_Data::Branch& branch: m_telemetry_data.branches)
+            {
+                branch.process_duration = std::chrono::duration_cast<Clock::duration>(branch.crt_process_duration * mu);
+                branch.max_process_duration = std::chrono::duration_cast<Clock::duration>(branch.crt_max_process_duration);
+
+                branch.crt_process_duration = Clock::duration(0);
+                branch.crt_max_process_duration = Clock::duration(0);
             }
         }
     }
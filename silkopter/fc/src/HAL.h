@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <chrono>
 
@@ -10,8 +11,14 @@
 #include "common/node/INode.h"
 #include "common/stream/IStream.h"
 #include "utils/Clock.h"
+#include "utils/Latency_Histogram.h"
+#include "utils/Thread_Registry.h"
+#include "def_lang/Serialization.h"
 
+#include "common/Manual_Clock.h"
 #include "MPL_Helper.h"
+#include "Node_Executor.h"
+#include "Stream_Handle.h"
 
 namespace silk
 {
@@ -66,7 +73,10 @@ public:
     bool add(std::string const& name, std::string const& type, std::shared_ptr<Base> const& ptr);
     void remove(std::shared_ptr<Base> const& ptr);
 private:
+    void rebuild_name_index();
+
     std::vector<Item> m_items;
+    std::unordered_map<std::string, size_t> m_name_index; //name -> index in m_items
 };
 
 class RC_Comms;
@@ -110,7 +120,64 @@ public:
     typedef Registry<stream::IStream> Stream_Registry;
     Stream_Registry const& get_stream_registry() const;
 
-    void remove_add_nodes();
+    //A batch of graph edits applied together by apply_graph_edit.
+    //Only the nodes named in the edit (and the consumers of removed nodes) are touched, the others keep their state.
+    class Graph_Edit
+    {
+    public:
+        void add_node(std::string const& type, std::string const& name, std::shared_ptr<const hal::INode_Descriptor> descriptor);
+        void remove_node(std::string const& name);
+        void set_input_stream_path(std::string const& node_name, size_t input_idx, std::string const& stream_path);
+        void set_node_config(std::string const& node_name, std::shared_ptr<const hal::INode_Config> config);
+
+        bool is_empty() const;
+
+    private:
+        friend class HAL;
+        struct Operation
+        {
+            enum class Type
+            {
+                ADD_NODE,
+                REMOVE_NODE,
+                SET_INPUT_STREAM_PATH,
+                SET_NODE_CONFIG
+            };
+            Type type = Type::ADD_NODE;
+            std::string node_name;
+            std::string node_type;
+            std::shared_ptr<const hal::INode_Descriptor> descriptor;
+            std::shared_ptr<const hal::INode_Config> config;
+            size_t input_idx = 0;
+            std::string stream_path;
+        };
+        std::vector<Operation> m_operations;
+    };
+
+    //Applies all the edits or none of them - on error the graph is rolled back to how it was.
+    //Call it from the main thread, between frames. The settings are saved if it succeeds.
+    ts::Result<void> apply_graph_edit(Graph_Edit const& edit);
+
+    //returns when the nodes that run detached from the frames are done. Call it before touching the nodes from
+    // outside process() - apply_graph_edit does
+    void wait_for_detached_nodes();
+
+    //the rates of the streams produced by sources, generators and simulators. The main loop wakes up at these rates
+    auto get_source_rates() const -> std::vector<uint32_t> const&;
+
+    //the data-ready GPIO fds of the nodes. The main loop wakes up on their edges as well
+    auto get_data_ready_fds() const -> std::vector<int> const&;
+
+    //how late the main loop woke up compared to when a source sample was due
+    void add_wakeup_latency(Clock::duration latency);
+
+    //frames longer than this dump the frame trace. None if the frame trace is disabled
+    auto get_frame_deadline() const -> boost::optional<Clock::duration>;
+
+    //Replaces the wall clock deciding when the nodes are due, so a log replay can run the graph faster than real time.
+    //The main loop doesn't wait for the source timers while it's set. nullptr goes back to the wall clock
+    void set_virtual_clock(Manual_Clock const* clock);
+    auto get_virtual_clock() const -> Manual_Clock const*;
 
 protected:
 
@@ -125,13 +192,65 @@ protected:
         float rate = 0;
         struct Node
         {
-            Clock::duration crt_process_duration;
-            Clock::duration crt_max_process_duration;
+            std::string name;
+
+            Clock::duration crt_process_duration = Clock::duration(0);
+            util::Latency_Histogram crt_process_histogram;
+
+            Clock::duration process_duration = Clock::duration(0);
+            util::Latency_Histogram process_histogram;
+
+            uint32_t crt_allocation_count = 0;
+            uint32_t allocation_count = 0; //heap allocations per second
+
+            //age of the sensor data behind the inputs when the node was done with them - sensor to actuator for sinks
+            util::Latency_Histogram crt_input_age_histogram;
+            util::Latency_Histogram input_age_histogram;
+        };
+        std::vector<Node> nodes; //indexed by the node id - the position of the node in the schedule
+
+        //independent chains of nodes running in parallel
+        struct Branch
+        {
+            std::string name;
 
-            Clock::duration process_duration;
-            Clock::duration max_process_duration;
+            Clock::duration crt_process_duration = Clock::duration(0);
+            Clock::duration crt_max_process_duration = Clock::duration(0);
+
+            Clock::duration process_duration = Clock::duration(0);
+            Clock::duration max_process_duration = Clock::duration(0);
         };
-        std::map<std::string, Node> nodes;
+        std::vector<Branch> branches;
+
+        util::Latency_Histogram crt_wakeup_latency;
+        util::Latency_Histogram wakeup_latency;
+
+        //all the registered threads, updated once per second
+        struct Thread
+        {
+            std::string name;
+            float cpu_usage = 0; //0 - 1 of a core
+            uint32_t involuntary_context_switches = 0; //per second
+        };
+        std::vector<Thread> threads;
+
+        //bus transactions per client device - the I2C address, 0 for the SPI and UART buses
+        struct Bus
+        {
+            std::string name;
+            struct Client
+            {
+                uint32_t address = 0;
+                uint32_t transaction_count = 0; //per second
+                uint32_t byte_count = 0; //per second
+                uint32_t error_count = 0; //per second
+                uint32_t busy_count = 0; //per second, transactions refused because the bus was in use
+                float usage = 0; //0 - 1, how much of the time the client holds the bus
+                util::Latency_Histogram duration_histogram;
+            };
+            std::vector<Client> clients;
+        };
+        std::vector<Bus> buses;
     };
 
     auto get_telemetry_data() const -> Telemetry_Data const&;
@@ -142,9 +261,35 @@ private:
     ts::Result<std::shared_ptr<bus::IBus>> create_bus(std::string const& type, std::string const& name, hal::IBus_Descriptor const& descriptor);
     ts::Result<std::shared_ptr<node::INode>> create_node(std::string const& type, std::string const& name, hal::INode_Descriptor const& descriptor);
 
-    bool remove_node(std::shared_ptr<node::INode> node);
+    void remove_node(std::shared_ptr<node::INode> node);
+
+    //the state of the nodes touched by a graph edit, to roll it back
+    struct Graph_Edit_Rollback
+    {
+        std::vector<Node_Registry::Item> nodes;
+        std::vector<Stream_Registry::Item> streams;
+        struct Node_State
+        {
+            std::shared_ptr<node::INode> node;
+            std::vector<std::string> input_paths;
+            ts::sz::Value config;
+        };
+        std::vector<Node_State> node_states;
+        std::vector<std::shared_ptr<node::INode>> added_nodes;
+
+        void save_node_state(std::shared_ptr<node::INode> const& node);
+    };
+    ts::Result<void> apply_graph_operation(Graph_Edit::Operation const& op, Graph_Edit_Rollback& rollback, std::set<std::string>& edited_node_names);
+    void rollback_graph_edit(Graph_Edit_Rollback& rollback);
+
+    //reorders the node registry so that every node is processed after the nodes producing its input streams
+    void sort_nodes();
 
-    void sort_nodes(std::shared_ptr<node::INode> first_node);
+    //keeps the current order if it still satisfies the inputs of the edited nodes, otherwise sorts everything
+    void update_schedule(std::set<std::string> const& edited_node_names);
+
+    //hands the node order in the registry to the executor
+    void set_schedule();
 
     std::shared_ptr<IUAV_Properties> m_uav_properties;
     std::shared_ptr<const hal::IUAV_Descriptor> m_uav_descriptor;
@@ -156,6 +301,49 @@ private:
     Bus_Factory m_bus_factory;
     Node_Factory m_node_factory;
 
+    Node_Executor m_executor;
+    Manual_Clock const* m_virtual_clock = nullptr;
+
+    //serialized settings of each node by name, so saving after an edit only serializes the nodes it touched
+    std::map<std::string, std::shared_ptr<const ts::sz::Value>> m_node_settings_cache;
+    std::vector<uint32_t> m_source_rates;
+    std::vector<int> m_data_ready_fds;
+    boost::optional<Clock::duration> m_frame_deadline = Clock::duration(std::chrono::milliseconds(10));
+
+    //strict allocation mode is armed only after the nodes had time to grow their buffers,
+    // and disarmed again while a graph edit settles
+    void restart_real_time_warmup();
+    bool m_is_real_time_strict = false;
+    Clock::duration m_real_time_warmup = std::chrono::milliseconds(5000);
+    Clock::time_point m_real_time_warmup_tp = Clock::now();
+
+    //thread scheduling by thread name, from the settings
+    static auto make_default_thread_profiles() -> std::map<std::string, util::Thread_Registry::Profile>;
+    void apply_thread_profiles();
+    std::map<std::string, util::Thread_Registry::Profile> m_thread_profiles;
+    bool m_lock_memory = true;
+
+    //restarts the profiler when its settings change
+    void apply_profiler_settings();
+    bool m_is_profiler_enabled = false;
+    bool m_profiler_write_trace = true;
+    std::chrono::milliseconds m_profiler_summary_period = std::chrono::milliseconds(0);
+
+    //the thread stats are read from /proc on the async thread
+    struct Thread_Stats_State
+    {
+        std::mutex mutex;
+        std::vector<Telemetry_Data::Thread> threads;
+        std::vector<util::Thread_Registry::Stats> last_stats;
+        Clock::time_point last_tp = Clock::now();
+        std::atomic_bool is_reading = { false };
+    };
+    void read_thread_stats();
+    std::shared_ptr<Thread_Stats_State> m_thread_stats_state = std::make_shared<Thread_Stats_State>();
+    Clock::time_point m_last_thread_stats_tp = Clock::now();
+
+    std::vector<util::hw::Bus_Stats::Client> m_bus_stats_clients;
+
     Clock::time_point m_last_process_tp = Clock::now();
 
     Clock::time_point m_last_telemetry_data_latch_tp = Clock::now();
@@ -185,27 +373,42 @@ template<class Base>
 void Registry<Base>::set_all(std::vector<Item> const& items)
 {
     m_items = items;
+    rebuild_name_index();
+    Graph_Generation::bump();
 }
 template<class Base>
 void Registry<Base>::remove_all()
 {
     m_items.clear();
+    m_name_index.clear();
+    Graph_Generation::bump();
+}
+template<class Base>
+void Registry<Base>::rebuild_name_index()
+{
+    m_name_index.clear();
+    m_name_index.reserve(m_items.size());
+    for (size_t i = 0; i < m_items.size(); i++)
+    {
+        m_name_index.emplace(m_items[i].name, i);
+    }
 }
 template<class Base>
 template<class T>
 auto Registry<Base>::find_by_name(std::string const& name) const -> std::shared_ptr<T>
 {
-    auto it = std::find_if(m_items.begin(), m_items.end(), [&](Item const& s) { return s.name == name; });
-    return it != m_items.end() ? std::dynamic_pointer_cast<T>(it->ptr) : nullptr;
+    auto it = m_name_index.find(name);
+    return it != m_name_index.end() ? std::dynamic_pointer_cast<T>(m_items[it->second].ptr) : nullptr;
 }
 template<class Base>
 auto Registry<Base>::add(std::string const& name, std::string const& type, std::shared_ptr<Base> const& ptr) -> bool
 {
-    if (find_by_name<Base>(name))
+    if (m_name_index.find(name) != m_name_index.end())
     {
         QLOGE("Duplicated name {}", name);
         return false;
     }
+    m_name_index.emplace(name, m_items.size());
     m_items.push_back({name, type, ptr});
     return true;
 }
@@ -213,9 +416,10 @@ template<class Base>
 void Registry<Base>::remove(std::shared_ptr<Base> const& ptr)
 {
     m_items.erase(std::remove_if(m_items.begin(), m_items.end(), [ptr](Item const& item) { return item.ptr == ptr; }), m_items.end());
+    rebuild_name_index();
+    Graph_Generation::bump();
 }
 
-
 template<class Base>
 template <class T, typename... Params>
 void Factory<Base>::add(std::string const& class_name, Params&&... params)
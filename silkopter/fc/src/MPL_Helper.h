@@ -88,6 +88,18 @@ Ret call(std::function<Ret(Args...)> const& func, std::tuple<Args...>&&  tup)
     return call_helper(func, typename make_indexes<Args...>::type(), std::forward<std::tuple<Args...>>(tup));
 }
 
+//call any function object with tuple arguments. Unlike call() it doesn't need a std::function, which can allocate
+template<class Func, class Tuple, int... Indexes>
+void apply_helper(Func const& func, index_tuple<Indexes...>, Tuple const& tup)
+{
+    func(std::get<Indexes>(tup)...);
+}
+
+template<class Func, class... Args>
+void apply(Func const& func, std::tuple<Args...> const& tup)
+{
+    apply_helper(func, typename make_indexes<Args...>::type(), tup);
+}
 
 
 
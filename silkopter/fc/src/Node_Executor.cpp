@@ -0,0 +1,674 @@
+#include "FCStdAfx.h"
+#include "Node_Executor.h"
+#include "Allocation_Tracker.h"
+#include "Frame_Arena.h"
+#include "Capture_Context.h"
+#include "Frame_Clock.h"
+#include "utils/Thread_Registry.h"
+
+namespace silk
+{
+
+thread_local stream::Capture_Tp Capture_Context::s_capture_tp = 0;
+std::atomic<int64_t> Frame_Clock::s_frame_ns = { 0 };
+
+Node_Executor::Node_Executor()
+{
+    //the calling thread is always the first worker
+    m_workers.emplace_back(new Worker());
+}
+
+Node_Executor::~Node_Executor()
+{
+    stop();
+}
+
+void Node_Executor::start(size_t worker_count)
+{
+    QLOG_TOPIC("node_executor::start");
+
+    stop();
+
+    m_exit = false;
+    for (size_t i = 0; i < worker_count; i++)
+    {
+        m_workers.emplace_back(new Worker());
+    }
+    for (size_t i = 1; i < m_workers.size(); i++)
+    {
+        m_workers[i]->thread = std::thread([this, i]() { worker_thread(i); });
+    }
+
+    QLOGI("Started {} node workers", worker_count);
+}
+
+void Node_Executor::stop()
+{
+    {
+        std::lock_guard<std::mutex> lg(m_work_mutex);
+        m_exit = true;
+    }
+    m_work_cv.notify_all();
+
+    for (size_t i = 1; i < m_workers.size(); i++)
+    {
+        if (m_workers[i]->thread.joinable())
+        {
+            m_workers[i]->thread.join();
+        }
+    }
+    m_workers.resize(1);
+
+    //the detached branches no worker got to
+    std::lock_guard<std::mutex> lg(m_work_mutex);
+    for (size_t branch_idx: m_detached_queue)
+    {
+        m_detached_states[branch_idx] = Detached_State::IDLE;
+        m_running_detached_count--;
+    }
+    m_detached_queue.clear();
+}
+
+void Node_Executor::set_graph(std::vector<node::INode*> const& nodes, std::vector<std::string> const& names, std::vector<std::vector<size_t>> const& dependencies,
+                              std::vector<std::vector<size_t>> const& bus_dependencies, std::vector<uint32_t> const& rates)
+{
+    QASSERT(nodes.size() == dependencies.size() && nodes.size() == bus_dependencies.size() && nodes.size() == names.size() && nodes.size() == rates.size());
+    QASSERT(m_pending_branches == 0);
+
+    wait_for_detached_branches();
+
+    m_nodes = nodes;
+    m_node_names = names;
+    m_node_trace_names.resize(nodes.size());
+    for (size_t i = 0; i < nodes.size(); i++)
+    {
+        m_node_trace_names[i] = util::Frame_Trace::register_name(names[i]);
+    }
+    m_node_stats.assign(nodes.size(), Node_Stats());
+    m_detached_node_stats.assign(nodes.size(), Node_Stats());
+    m_node_reported.assign(nodes.size(), 0);
+    m_node_outputs.resize(nodes.size());
+    for (size_t i = 0; i < nodes.size(); i++)
+    {
+        m_node_outputs[i].clear();
+        for (node::INode::Output const& output: nodes[i]->get_outputs())
+        {
+            m_node_outputs[i].push_back(output.stream);
+        }
+    }
+    m_branches.clear();
+    m_root_branches.clear();
+    m_detached_branches.clear();
+
+    size_t const count = nodes.size();
+
+    //the stream producers pick the rate slots
+    std::vector<std::vector<size_t>> stream_producers(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        stream_producers[i] = dependencies[i];
+        std::sort(stream_producers[i].begin(), stream_producers[i].end());
+        stream_producers[i].erase(std::unique(stream_producers[i].begin(), stream_producers[i].end()), stream_producers[i].end());
+    }
+
+    assign_rate_slots(stream_producers, rates);
+
+    //unique producers & consumers for each node, counting the nodes sharing a bus as well
+    std::vector<std::vector<size_t>> producers(count);
+    std::vector<std::vector<size_t>> consumers(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        producers[i] = stream_producers[i];
+        producers[i].insert(producers[i].end(), bus_dependencies[i].begin(), bus_dependencies[i].end());
+        std::sort(producers[i].begin(), producers[i].end());
+        producers[i].erase(std::unique(producers[i].begin(), producers[i].end()), producers[i].end());
+        for (size_t p: producers[i])
+        {
+            QASSERT(p < i);
+            consumers[p].push_back(i);
+        }
+    }
+
+    //nodes slower than the minor frame that don't share a bus and are fed only by such nodes can run detached
+    std::vector<bool> shares_bus(count, false);
+    for (size_t i = 0; i < count; i++)
+    {
+        for (size_t b: bus_dependencies[i])
+        {
+            shares_bus[i] = true;
+            shares_bus[b] = true;
+        }
+    }
+    std::vector<bool> detachable(count, false);
+    for (size_t i = 0; i < count; i++)
+    {
+        detachable[i] = m_node_slots[i].period > Clock::duration(0) && !shares_bus[i] &&
+                std::all_of(producers[i].begin(), producers[i].end(), [&detachable](size_t p) { return detachable[p]; });
+    }
+
+    //a node continues the branch of its producer if it's that producer's only consumer and has no other producer.
+    //Nodes come in execution order so the producer is always the last node in its branch at this point.
+    std::vector<size_t> node_branches(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        if (producers[i].size() == 1 && consumers[producers[i][0]].size() == 1 && detachable[i] == detachable[producers[i][0]])
+        {
+            size_t branch_idx = node_branches[producers[i][0]];
+            m_branches[branch_idx].nodes.push_back(i);
+            node_branches[i] = branch_idx;
+        }
+        else
+        {
+            node_branches[i] = m_branches.size();
+            m_branches.emplace_back();
+            m_branches.back().nodes.push_back(i);
+        }
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        for (size_t p: producers[i])
+        {
+            size_t producer_branch = node_branches[p];
+            if (producer_branch != node_branches[i])
+            {
+                m_branches[producer_branch].consumers.push_back(node_branches[i]);
+            }
+        }
+    }
+    for (Branch& branch: m_branches)
+    {
+        std::sort(branch.consumers.begin(), branch.consumers.end());
+        branch.consumers.erase(std::unique(branch.consumers.begin(), branch.consumers.end()), branch.consumers.end());
+        for (size_t c: branch.consumers)
+        {
+            m_branches[c].dependency_count++;
+        }
+    }
+
+    //detached source branches are not waited for
+    std::string detached_names;
+    for (size_t i = 0; i < m_branches.size(); i++)
+    {
+        Branch& branch = m_branches[i];
+        if (producers[branch.nodes.front()].empty() && detachable[branch.nodes.front()])
+        {
+            branch.is_detached = true;
+            m_detached_branches.push_back(i);
+            detached_names += (detached_names.empty() ? "" : ", ") + names[branch.nodes.front()];
+        }
+    }
+    for (size_t i: m_detached_branches)
+    {
+        for (size_t c: m_branches[i].consumers)
+        {
+            m_branches[c].dependency_count--;
+        }
+        m_branches[i].consumers.clear();
+    }
+    for (size_t i = 0; i < m_branches.size(); i++)
+    {
+        if (m_branches[i].dependency_count == 0 && !m_branches[i].is_detached)
+        {
+            m_root_branches.push_back(i);
+        }
+    }
+    if (!m_detached_branches.empty())
+    {
+        QLOGI("Detached branches: {}", detached_names);
+    }
+
+    m_node_branches = node_branches;
+    m_pending_dependencies.reset(new std::atomic<uint32_t>[m_branches.size()]);
+    m_detached_states.reset(new std::atomic<Detached_State>[m_branches.size()]);
+    for (size_t i = 0; i < m_branches.size(); i++)
+    {
+        m_detached_states[i] = Detached_State::IDLE;
+    }
+    m_detached_branch_durations.assign(m_branches.size(), Clock::duration(0));
+}
+
+void Node_Executor::assign_rate_slots(std::vector<std::vector<size_t>> const& producers, std::vector<uint32_t> const& rates)
+{
+    size_t const count = m_nodes.size();
+    m_node_slots.assign(count, Node_Slot());
+    m_node_due.assign(count, 1);
+    m_is_started = false;
+
+    uint32_t max_rate = rates.empty() ? 0 : *std::max_element(rates.begin(), rates.end());
+    if (max_rate == 0)
+    {
+        m_minor_frame_period = Clock::duration(0);
+        return;
+    }
+    m_minor_frame_period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / max_rate));
+
+    //how many minor frames between two runs of each node
+    std::vector<size_t> frame_counts(count, 1);
+    for (size_t i = 0; i < count; i++)
+    {
+        if (rates[i] > 0)
+        {
+            frame_counts[i] = std::max<size_t>((max_rate + rates[i] / 2) / rates[i], 1);
+        }
+    }
+    size_t max_frame_count = *std::max_element(frame_counts.begin(), frame_counts.end());
+
+    //In execution order, put each node in the slot where the busiest of the minor frames it runs in has the fewest nodes.
+    //All nodes count the same so the schedule doesn't depend on timing and stays the same between runs.
+    std::vector<size_t> slots(count, 0);
+    std::vector<uint32_t> loads(max_frame_count, 0);
+    std::map<uint32_t, size_t> group_sizes;
+    for (size_t i = 0; i < count; i++)
+    {
+        size_t const frame_count = frame_counts[i];
+
+        //stay in phase with the slowest producer whose rate is a multiple of ours
+        size_t lock_count = 1;
+        size_t lock_slot = 0;
+        for (size_t p: producers[i])
+        {
+            if (frame_counts[p] > lock_count && frame_count % frame_counts[p] == 0)
+            {
+                lock_count = frame_counts[p];
+                lock_slot = slots[p];
+            }
+        }
+
+        size_t best_slot = lock_slot;
+        uint32_t best_load = std::numeric_limits<uint32_t>::max();
+        for (size_t slot = lock_slot; slot < frame_count; slot += lock_count)
+        {
+            uint32_t load = 0;
+            for (size_t f = slot; f < max_frame_count; f += frame_count)
+            {
+                load = std::max(load, loads[f]);
+            }
+            if (load < best_load)
+            {
+                best_load = load;
+                best_slot = slot;
+            }
+        }
+
+        slots[i] = best_slot;
+        for (size_t f = best_slot; f < max_frame_count; f += frame_count)
+        {
+            loads[f]++;
+        }
+        if (frame_count > 1)
+        {
+            m_node_slots[i].period = m_minor_frame_period * frame_count;
+            m_node_slots[i].phase = m_minor_frame_period * best_slot;
+        }
+        group_sizes[static_cast<uint32_t>(max_rate / frame_count)]++;
+    }
+
+    std::string groups;
+    for (auto it = group_sizes.rbegin(); it != group_sizes.rend(); ++it)
+    {
+        groups += q::util::format<std::string>("{}{}Hz: {}", groups.empty() ? "" : ", ", it->first, it->second);
+    }
+    QLOGI("Rate groups: {}. The busiest minor frame runs {} of {} nodes", groups, *std::max_element(loads.begin(), loads.end()), count);
+}
+
+void Node_Executor::update_due_nodes(Clock::time_point now)
+{
+    if (!m_is_started)
+    {
+        m_is_started = true;
+        m_start_tp = now;
+        for (Node_Slot& slot: m_node_slots)
+        {
+            slot.next_tp = m_start_tp + slot.phase;
+        }
+    }
+
+    //frames don't start exactly on the minor frame boundaries - they can wake up late or for other timers
+    Clock::duration slack = m_minor_frame_period / 2;
+    for (size_t i = 0; i < m_node_slots.size(); i++)
+    {
+        size_t branch_idx = m_node_branches[i];
+        if (m_branches[branch_idx].is_detached && m_detached_states[branch_idx].load(std::memory_order_relaxed) != Detached_State::IDLE)
+        {
+            continue; //the branch is still running and reads these
+        }
+
+        Node_Slot& slot = m_node_slots[i];
+        if (slot.period == Clock::duration(0))
+        {
+            m_node_due[i] = 1;
+            continue;
+        }
+        bool is_due = now + slack >= slot.next_tp;
+        m_node_due[i] = is_due ? 1 : 0;
+        if (is_due)
+        {
+            //the next slot of the node, skipping the ones missed during a stall
+            Clock::duration elapsed = now + slack - (m_start_tp + slot.phase);
+            slot.next_tp = m_start_tp + slot.phase + slot.period * (elapsed / slot.period + 1);
+        }
+    }
+}
+
+void Node_Executor::restart_rate_groups()
+{
+    m_is_started = false;
+}
+
+void Node_Executor::process(Clock::time_point now)
+{
+    Frame_Clock::set(now);
+
+    if (m_branches.empty())
+    {
+        return;
+    }
+
+    collect_detached_branches();
+    update_due_nodes(now);
+
+    for (size_t i = 0; i < m_branches.size(); i++)
+    {
+        m_pending_dependencies[i].store(m_branches[i].dependency_count, std::memory_order_relaxed);
+    }
+    m_pending_branches.store(m_branches.size() - m_detached_branches.size(), std::memory_order_release);
+
+    for (size_t i = 0; i < m_root_branches.size(); i++)
+    {
+        push(i % m_workers.size(), m_root_branches[i]);
+    }
+
+    //without workers the detached branches run after the others
+    bool const has_workers = m_workers.size() > 1;
+    if (has_workers)
+    {
+        start_detached_branches();
+    }
+
+    run_until_done(0);
+
+    if (!has_workers)
+    {
+        start_detached_branches();
+    }
+}
+
+void Node_Executor::collect_detached_branches()
+{
+    for (size_t branch_idx: m_detached_branches)
+    {
+        Branch const& branch = m_branches[branch_idx];
+        bool is_finished = m_detached_states[branch_idx].load(std::memory_order_acquire) == Detached_State::FINISHED;
+        m_detached_branch_durations[branch_idx] = is_finished ? branch.duration : Clock::duration(0);
+        for (size_t node_idx: branch.nodes)
+        {
+            m_node_reported[node_idx] = (is_finished && m_node_due[node_idx]) ? 1 : 0;
+            if (is_finished)
+            {
+                m_detached_node_stats[node_idx] = m_node_stats[node_idx];
+            }
+        }
+        if (is_finished)
+        {
+            m_detached_states[branch_idx].store(Detached_State::IDLE, std::memory_order_relaxed);
+        }
+    }
+}
+
+void Node_Executor::start_detached_branches()
+{
+    bool const has_workers = m_workers.size() > 1;
+    bool is_queued = false;
+    for (size_t branch_idx: m_detached_branches)
+    {
+        if (m_detached_states[branch_idx].load(std::memory_order_acquire) != Detached_State::IDLE)
+        {
+            continue; //still running, it misses this slot
+        }
+
+        Branch const& branch = m_branches[branch_idx];
+        if (std::none_of(branch.nodes.begin(), branch.nodes.end(), [this](size_t node_idx) { return m_node_due[node_idx] != 0; }))
+        {
+            for (size_t node_idx: branch.nodes)
+            {
+                skip_node(node_idx);
+            }
+            continue;
+        }
+
+        m_detached_states[branch_idx].store(Detached_State::RUNNING, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lg(m_work_mutex);
+            m_running_detached_count++;
+            if (has_workers)
+            {
+                m_detached_queue.push_back(branch_idx);
+                is_queued = true;
+            }
+        }
+        if (!has_workers)
+        {
+            execute_branch(0, branch_idx);
+        }
+    }
+
+    if (is_queued)
+    {
+        m_work_cv.notify_all();
+    }
+}
+
+void Node_Executor::wait_for_detached_branches()
+{
+    std::unique_lock<std::mutex> lock(m_work_mutex);
+    m_work_cv.wait(lock, [this]() { return m_running_detached_count == 0; });
+}
+
+void Node_Executor::worker_thread(size_t worker_idx)
+{
+    //the priority and core come from the thread profile with this name
+    util::Thread_Registry::register_current_thread("node worker " + std::to_string(worker_idx));
+
+    while (true)
+    {
+        size_t branch_idx = 0;
+        if (!pop_or_steal(worker_idx, branch_idx))
+        {
+            std::unique_lock<std::mutex> lock(m_work_mutex);
+            m_work_cv.wait(lock, [this]() { return m_exit || m_queued_branches.load(std::memory_order_relaxed) > 0 || !m_detached_queue.empty(); });
+            if (m_exit)
+            {
+                return;
+            }
+            if (m_queued_branches.load(std::memory_order_relaxed) > 0)
+            {
+                continue; //the branches of the frame go first
+            }
+            branch_idx = m_detached_queue.front();
+            m_detached_queue.pop_front();
+        }
+        execute_branch(worker_idx, branch_idx);
+    }
+}
+
+void Node_Executor::run_until_done(size_t worker_idx)
+{
+    while (m_pending_branches.load(std::memory_order_acquire) > 0)
+    {
+        size_t branch_idx = 0;
+        if (pop_or_steal(worker_idx, branch_idx))
+        {
+            execute_branch(worker_idx, branch_idx);
+            continue;
+        }
+
+        //the remaining branches wait for others that are still running
+        std::unique_lock<std::mutex> lock(m_work_mutex);
+        m_work_cv.wait(lock, [this]()
+        {
+            return m_queued_branches.load(std::memory_order_relaxed) > 0 || m_pending_branches.load(std::memory_order_acquire) == 0;
+        });
+    }
+}
+
+void Node_Executor::push(size_t worker_idx, size_t branch_idx)
+{
+    //counted first so the sleeping threads never miss a queued branch
+    {
+        std::lock_guard<std::mutex> lg(m_work_mutex);
+        m_queued_branches.fetch_add(1, std::memory_order_relaxed);
+    }
+    {
+        Worker& worker = *m_workers[worker_idx];
+        std::lock_guard<std::mutex> lg(worker.mutex);
+        worker.queue.push_back(branch_idx);
+    }
+    m_work_cv.notify_all();
+}
+
+auto Node_Executor::pop_or_steal(size_t worker_idx, size_t& branch_idx) -> bool
+{
+    {
+        //newest first from our own queue as it's probably the consumer of what we just executed
+        Worker& worker = *m_workers[worker_idx];
+        std::lock_guard<std::mutex> lg(worker.mutex);
+        if (!worker.queue.empty())
+        {
+            branch_idx = worker.queue.back();
+            worker.queue.pop_back();
+            m_queued_branches.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    //oldest first from the others
+    for (size_t i = 1; i < m_workers.size(); i++)
+    {
+        Worker& victim = *m_workers[(worker_idx + i) % m_workers.size()];
+        std::lock_guard<std::mutex> lg(victim.mutex);
+        if (!victim.queue.empty())
+        {
+            branch_idx = victim.queue.front();
+            victim.queue.pop_front();
+            m_queued_branches.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+void Node_Executor::skip_node(size_t node_idx)
+{
+    m_node_stats[node_idx] = Node_Stats();
+
+    //the consumers that run this frame would read the samples of the last run again
+    for (std::shared_ptr<stream::IStream> const& stream: m_node_outputs[node_idx])
+    {
+        stream->clear();
+    }
+}
+
+void Node_Executor::execute_branch(size_t worker_idx, size_t branch_idx)
+{
+    Branch& branch = m_branches[branch_idx];
+    Frame_Arena& arena = Frame_Arena::get();
+
+    auto branch_start = Clock::now();
+    auto node_start = branch_start;
+    for (size_t node_idx: branch.nodes)
+    {
+        if (!m_node_due[node_idx])
+        {
+            skip_node(node_idx);
+            continue;
+        }
+
+        //a node with no inputs shouldn't inherit the capture time of the previous node in the branch
+        Capture_Context::clear();
+        arena.reset();
+
+        Node_Stats& stats = m_node_stats[node_idx];
+        util::Frame_Trace::begin(m_node_trace_names[node_idx], node_start);
+        uint64_t allocation_count = Allocation_Tracker::get_thread_allocation_count();
+        {
+            Allocation_Tracker::Real_Time_Section section(m_node_names[node_idx].c_str());
+            m_nodes[node_idx]->process();
+        }
+        stats.allocation_count = static_cast<uint32_t>(Allocation_Tracker::get_thread_allocation_count() - allocation_count);
+
+        auto now = Clock::now();
+        util::Frame_Trace::end(m_node_trace_names[node_idx], now);
+        stats.duration = now - node_start;
+        node_start = now;
+
+        stream::Capture_Tp capture_tp = Capture_Context::get();
+        stats.input_age = capture_tp != 0 ? std::max(stream::get_capture_age(capture_tp, now), Clock::duration(0)) : Clock::duration(-1);
+    }
+    branch.duration = node_start - branch_start;
+
+    if (branch.is_detached)
+    {
+        m_detached_states[branch_idx].store(Detached_State::FINISHED, std::memory_order_release);
+        std::lock_guard<std::mutex> lg(m_work_mutex);
+        m_running_detached_count--;
+        m_work_cv.notify_all();
+        return;
+    }
+
+    for (size_t c: branch.consumers)
+    {
+        if (m_pending_dependencies[c].fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            push(worker_idx, c);
+        }
+    }
+
+    if (m_pending_branches.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        //the thread calling process() might be waiting for the last branch
+        std::lock_guard<std::mutex> lg(m_work_mutex);
+        m_work_cv.notify_all();
+    }
+}
+
+auto Node_Executor::get_node_stats(size_t node_idx) const -> Node_Stats const&
+{
+    QASSERT(node_idx < m_node_stats.size());
+    return m_branches[m_node_branches[node_idx]].is_detached ? m_detached_node_stats[node_idx] : m_node_stats[node_idx];
+}
+
+size_t Node_Executor::get_branch_count() const
+{
+    return m_branches.size();
+}
+std::vector<size_t> const& Node_Executor::get_branch_nodes(size_t branch_idx) const
+{
+    QASSERT(branch_idx < m_branches.size());
+    return m_branches[branch_idx].nodes;
+}
+Clock::duration Node_Executor::get_branch_duration(size_t branch_idx) const
+{
+    QASSERT(branch_idx < m_branches.size());
+    return m_branches[branch_idx].is_detached ? m_detached_branch_durations[branch_idx] : m_branches[branch_idx].duration;
+}
+Clock::duration Node_Executor::get_node_duration(size_t node_idx) const
+{
+    return get_node_stats(node_idx).duration;
+}
+uint32_t Node_Executor::get_node_allocation_count(size_t node_idx) const
+{
+    return get_node_stats(node_idx).allocation_count;
+}
+bool Node_Executor::get_node_input_age(size_t node_idx, Clock::duration& age) const
+{
+    age = get_node_stats(node_idx).input_age;
+    return age >= Clock::duration(0);
+}
+bool Node_Executor::was_node_processed(size_t node_idx) const
+{
+    QASSERT(node_idx < m_node_due.size());
+    return m_branches[m_node_branches[node_idx]].is_detached ? m_node_reported[node_idx] != 0 : m_node_due[node_idx] != 0;
+}
+
+}
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <thread>
+#include <condition_variable>
+
+#include "common/node/INode.h"
+#include "utils/Clock.h"
+#include "utils/Frame_Trace.h"
+
+namespace silk
+{
+
+//Runs the HAL nodes on a small pool of worker threads.
+//The node graph is split in branches - chains of nodes where each node feeds only the next one.
+//A branch becomes ready when all the branches it depends on are done. Each worker has its own queue of ready branches and
+// steals from the other workers when it runs out of work. Workers with nothing to do sleep until a branch is queued.
+//Nodes also run only at their own rate. The fastest node rate sets the minor frame and slower nodes run every Nth minor
+// frame, in a slot picked to spread them evenly over the minor frames. Nodes fed by a node with the same rate share its
+// slot so they don't see its samples one slot late. The outputs of a skipped node are cleared so its consumers only
+// see new samples.
+//Source branches slower than the minor frame that share no bus with other nodes (GPS, camera) are detached: process()
+// doesn't wait for them so a slow read doesn't stretch the frame. They run on the workers only, which pick the
+// frame's branches first, and can finish in a later frame. Their consumers don't wait for them either and read the
+// samples pushed so far from the sample rings, through a Sample_Accumulator. A detached branch still running when
+// it's due again misses that slot.
+//The thread's Frame_Arena is reset before every node for the node's temporaries and every node runs inside an
+// Allocation_Tracker::Real_Time_Section, so the heap allocations it still makes are counted per node.
+class Node_Executor
+{
+public:
+    Node_Executor();
+    ~Node_Executor();
+
+    //creates worker_count threads in addition to the thread calling process(), which also executes branches.
+    //Without workers the detached branches run at the end of process()
+    void start(size_t worker_count);
+    void stop();
+
+    //nodes have to be in execution order and dependencies[i] holds the indices of the nodes whose streams node i reads.
+    //bus_dependencies[i] holds the nodes sharing a bus with node i that run before it. Node i waits for them as well
+    // but they don't pick its rate slot as they don't feed it.
+    //rates[i] is how often node i has to run, 0 to run it every frame.
+    //The names are used in the frame trace. Cannot be called while process() is running.
+    void set_graph(std::vector<node::INode*> const& nodes, std::vector<std::string> const& names, std::vector<std::vector<size_t>> const& dependencies,
+                   std::vector<std::vector<size_t>> const& bus_dependencies, std::vector<uint32_t> const& rates);
+
+    //processes the nodes due at now and returns when the ones of the frame are done. Detached branches might still run.
+    //now becomes the Frame_Clock time
+    void process(Clock::time_point now);
+
+    //returns when no detached branch is running. The nodes can be changed after this, until the next process()
+    void wait_for_detached_branches();
+
+    //the rate groups start over at the next process(). For when the time source changes
+    void restart_rate_groups();
+
+    //whether the node ran in the last process() call. Detached nodes count in the frame their branch is seen done
+    bool was_node_processed(size_t node_idx) const;
+
+    size_t get_branch_count() const;
+    std::vector<size_t> const& get_branch_nodes(size_t branch_idx) const;
+    Clock::duration get_branch_duration(size_t branch_idx) const;
+    Clock::duration get_node_duration(size_t node_idx) const;
+
+    //heap allocations made by the node in the last process() call
+    uint32_t get_node_allocation_count(size_t node_idx) const;
+
+    //how old the sensor data behind the last input sample set of the node was when the node finished processing it
+    // in the last process() call. For sinks this is the sensor to actuator latency.
+    //False if the node didn't run or doesn't read its inputs through a Sample_Accumulator
+    bool get_node_input_age(size_t node_idx, Clock::duration& age) const;
+
+private:
+    struct Branch
+    {
+        std::vector<size_t> nodes;
+        std::vector<size_t> consumers; //the branches waiting for this one
+        uint32_t dependency_count = 0;
+        Clock::duration duration = Clock::duration(0);
+        bool is_detached = false;
+    };
+
+    struct Worker
+    {
+        std::thread thread;
+        std::mutex mutex;
+        std::deque<size_t> queue;
+    };
+
+    struct Node_Stats
+    {
+        Clock::duration duration = Clock::duration(0);
+        uint32_t allocation_count = 0;
+        Clock::duration input_age = Clock::duration(-1); //negative when unknown
+    };
+
+    //a detached branch is running from the time it's queued until process() sees it finished
+    enum class Detached_State : uint8_t
+    {
+        IDLE,
+        RUNNING,
+        FINISHED
+    };
+
+    void worker_thread(size_t worker_idx);
+    void run_until_done(size_t worker_idx);
+    void push(size_t worker_idx, size_t branch_idx);
+    auto pop_or_steal(size_t worker_idx, size_t& branch_idx) -> bool;
+    void execute_branch(size_t worker_idx, size_t branch_idx);
+    void skip_node(size_t node_idx);
+    auto get_node_stats(size_t node_idx) const -> Node_Stats const&;
+    void collect_detached_branches();
+    void start_detached_branches();
+    void assign_rate_slots(std::vector<std::vector<size_t>> const& producers, std::vector<uint32_t> const& rates);
+    void update_due_nodes(Clock::time_point now);
+
+    std::vector<node::INode*> m_nodes;
+    std::vector<std::string> m_node_names;
+    std::vector<util::Frame_Trace::Name_Id> m_node_trace_names;
+    std::vector<Node_Stats> m_node_stats; //written by the thread running the node
+    std::vector<Node_Stats> m_detached_node_stats; //copied from m_node_stats when process() sees a detached branch finished
+    std::vector<std::vector<std::shared_ptr<stream::IStream>>> m_node_outputs; //cleared when the node is skipped
+    std::vector<size_t> m_node_branches;
+
+    //rate groups. Nodes with a zero period run every frame
+    struct Node_Slot
+    {
+        Clock::duration period = Clock::duration(0);
+        Clock::duration phase = Clock::duration(0); //slot * minor frame period
+        Clock::time_point next_tp;
+    };
+    std::vector<Node_Slot> m_node_slots;
+    std::vector<uint8_t> m_node_due;
+    std::vector<uint8_t> m_node_reported; //for detached nodes, whether process() saw them finished
+    Clock::duration m_minor_frame_period = Clock::duration(0);
+    Clock::time_point m_start_tp;
+    bool m_is_started = false;
+    std::vector<Branch> m_branches;
+    std::vector<size_t> m_root_branches;
+    std::vector<size_t> m_detached_branches;
+    std::vector<Clock::duration> m_detached_branch_durations; //copied with the node stats
+    std::unique_ptr<std::atomic<uint32_t>[]> m_pending_dependencies;
+    std::unique_ptr<std::atomic<Detached_State>[]> m_detached_states;
+    std::atomic<size_t> m_pending_branches = { 0 };
+    std::atomic<size_t> m_queued_branches = { 0 }; //in the worker queues
+
+    std::vector<std::unique_ptr<Worker>> m_workers; //worker 0 is the thread calling process()
+
+    //idle workers and the thread waiting for the frame to finish sleep on m_work_cv
+    std::mutex m_work_mutex;
+    std::condition_variable m_work_cv;
+    std::deque<size_t> m_detached_queue;
+    size_t m_running_detached_count = 0;
+    bool m_exit = false;
+};
+
+}
@@ -1,6 +1,7 @@
 #include "FCStdAfx.h"
 #include "RC_Comms.h"
 #include "utils/Timed_Scope.h"
+#include "utils/Thread_Registry.h"
 #include "utils/hw/SPI_PIGPIO.h"
 #include "utils/hw/SPI_Dev.h"
 
@@ -153,8 +154,15 @@ auto RC_Comms::start() -> bool
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+void RC_Comms::set_data_received_callback(std::function<void()> callback)
+{
+    m_data_received_callback = callback;
+}
+
 void RC_Comms::phy_thread_proc()
 {
+    util::Thread_Registry::register_current_thread("rc phy");
+
     Phy_Data::Packet_ptr rx_packet = m_phy_data.packet_pool.acquire();
 
     static size_t bps = 0;
@@ -194,6 +202,10 @@ void RC_Comms::phy_thread_proc()
         {
             rx_packet->payload.resize(rx_size);
             m_phy_data.rx_queue.push_back_timeout(rx_packet, std::chrono::milliseconds(1));
+            if (m_data_received_callback)
+            {
+                m_data_received_callback();
+            }
 
             if (rx_rssi != std::numeric_limits<int16_t>::lowest())
             {
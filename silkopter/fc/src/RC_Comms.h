@@ -35,6 +35,9 @@ public:
 
     bool start();
 
+    //called from the phy thread every time a packet is received
+    void set_data_received_callback(std::function<void()> callback);
+
     bool is_connected() const;
 
     void process();
@@ -55,6 +58,7 @@ private:
     rc_comms::Packet_Header prepare_packet_header(rc_comms::Packet_Type packet_type, uint32_t packet_index) const;
 
     HAL& m_hal;
+    std::function<void()> m_data_received_callback;
     Clock::time_point m_uav_sent_tp = Clock::now();
 
     boost::optional<stream::ICamera_Commands::Value> m_camera_commands;
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "MPL_Helper.h"
+#include "Sample_Ring.h"
+#include "Stream_Handle.h"
+#include "Capture_Context.h"
 
 namespace silk
 {
@@ -55,6 +58,10 @@ public:
     {
         return std::make_tuple();
     }
+    auto get_capture_tp(size_t) -> stream::Capture_Tp
+    {
+        return 0;
+    }
 };
 
 template<class Stream, class... Streams>
@@ -68,7 +75,7 @@ public:
     void clear_streams()
     {
         QASSERT(!m_locked_stream);
-        m_stream.reset();
+        bind(nullptr);
         Parent_t::clear_streams();
     }
 
@@ -82,7 +89,7 @@ public:
     typename std::enable_if<N == 0>::type set_stream(std::shared_ptr<T> stream)
     {
         QASSERT(!m_locked_stream);
-        m_stream = stream;
+        bind(stream);
     }
 
     template<size_t N, class T>
@@ -103,7 +110,7 @@ public:
         if (idx == N)
         {
             m_stream_path.clear();
-            m_stream.reset();
+            bind(nullptr);
 
             if (!path.empty())
             {
@@ -115,7 +122,7 @@ public:
                         return make_error("Bad input stream '{}'. Expected rate {}Hz, got {}Hz", path, desired_rate, stream->get_rate());
                     }
                     m_stream_path = path;
-                    m_stream = stream;
+                    bind(stream);
                 }
                 else
                 {
@@ -134,7 +141,7 @@ public:
     {
         if (idx == N)
         {
-            return m_stream.lock() ? m_stream_path : std::string();
+            return m_stream.get() ? m_stream_path : std::string();
         }
         else
         {
@@ -144,55 +151,109 @@ public:
 
     auto lock() -> bool
     {
-        m_locked_stream = m_stream.lock();
+        m_locked_stream = m_stream.get();
         return m_locked_stream && Parent_t::lock();
     }
     void unlock()
     {
-        m_locked_stream.reset();
+        m_locked_stream = nullptr;
         Parent_t::unlock();
     }
     auto collect() -> size_t
     {
         QASSERT(m_locked_stream);
-        auto const& samples = m_locked_stream->get_samples();
-        m_samples.reserve(m_samples.size() + samples.size());
-        std::copy(samples.begin(), samples.end(), std::back_inserter(m_samples));
+        if (m_ring_source)
+        {
+            //nothing to copy, just see how far the producer got
+            Sample_Ring<Sample_t> const& ring = m_ring_source->get_sample_ring();
+            uint64_t begin = ring.get_begin_index();
+            if (m_read_index < begin)
+            {
+                QLOGW("Stream overrun: {} samples lost", begin - m_read_index);
+                m_read_index = begin;
+            }
+            m_end_index = ring.get_end_index();
+        }
+        else
+        {
+            auto const& samples = m_locked_stream->get_samples();
+            m_samples.reserve(m_samples.size() + samples.size());
+            std::copy(samples.begin(), samples.end(), std::back_inserter(m_samples));
+        }
         Parent_t::collect();
-        return m_samples.size();
+        return get_pending_count();
     }
     auto consume(size_t count) -> size_t
     {
-        QASSERT(count <= m_samples.size());
-        m_samples.erase(m_samples.begin(), m_samples.begin() + count);
+        QASSERT(count <= get_pending_count());
+        if (m_ring_source)
+        {
+            m_read_index += count;
+        }
+        else
+        {
+            m_samples.erase(m_samples.begin(), m_samples.begin() + count);
+        }
 
         auto parent_count = Parent_t::consume(count);
-        if (m_samples.size() > 30)
+        size_t pending = get_pending_count();
+        if (pending > 30)
         {
             //crop to parent count
-            size_t crop = math::min(parent_count, m_samples.size());
-            auto begin = m_samples.begin();
-            auto end = m_samples.end() - crop;
-            QLOGW("Stream is out of sync: {} samples pending. Cropping {} samples", m_samples.size(), std::distance(begin, end));
-            m_samples.erase(begin, end);
+            size_t crop = math::min(parent_count, pending);
+            QLOGW("Stream is out of sync: {} samples pending. Cropping {} samples", pending, pending - crop);
+            if (m_ring_source)
+            {
+                m_read_index = m_end_index - crop;
+            }
+            else
+            {
+                m_samples.erase(m_samples.begin(), m_samples.end() - crop);
+            }
         }
 
-        return m_samples.size();
+        return get_pending_count();
     }
     auto get_sample_count() -> size_t
     {
-        return math::min(m_samples.size(), Parent_t::get_sample_count());
+        return math::min(get_pending_count(), Parent_t::get_sample_count());
     }
 
     auto get_params(size_t idx) -> Params_t
     {
-        return std::tuple_cat(std::tuple<Sample_t const&>(m_samples[idx]), Parent_t::get_params(idx));
+        Sample_t const& sample = m_ring_source ? m_ring_source->get_sample_ring().get(m_read_index + idx) : m_samples[idx];
+        return std::tuple_cat(std::tuple<Sample_t const&>(sample), Parent_t::get_params(idx));
+    }
+    //the oldest capture time of the sample set
+    auto get_capture_tp(size_t idx) -> stream::Capture_Tp
+    {
+        Sample_t const& sample = m_ring_source ? m_ring_source->get_sample_ring().get(m_read_index + idx) : m_samples[idx];
+        return stream::get_oldest_capture_tp(sample.capture_tp, Parent_t::get_capture_tp(idx));
+    }
+
+private:
+    //streams with a sample ring are read in place from where this consumer left off. The others are copied
+    void bind(std::shared_ptr<Stream> const& stream)
+    {
+        m_stream.reset(stream);
+        m_samples.clear();
+        m_ring_source = dynamic_cast<ISample_Ring_Source<Sample_t> const*>(stream.get());
+        m_read_index = m_ring_source ? m_ring_source->get_sample_ring().get_end_index() : 0;
+        m_end_index = m_read_index;
+    }
+
+    auto get_pending_count() const -> size_t
+    {
+        return m_ring_source ? static_cast<size_t>(m_end_index - m_read_index) : m_samples.size();
     }
 
 private:
-    std::shared_ptr<Stream> m_locked_stream;
-    std::weak_ptr<Stream> m_stream;
+    Stream* m_locked_stream = nullptr;
+    Stream_Handle<Stream> m_stream; //resolved once in set_stream_path
     std::string m_stream_path;
+    ISample_Ring_Source<Sample_t> const* m_ring_source = nullptr;
+    uint64_t m_read_index = 0;
+    uint64_t m_end_index = 0;
     std::vector<Sample_t> m_samples;
 
 };
@@ -225,13 +286,13 @@ public:
     template<size_t N, class T>
     void set_stream(std::shared_ptr<T> stream)
     {
-        m_storage.set_stream<N>(stream);
+        m_storage.template set_stream<N>(stream);
     }
 
     template<size_t N, class T>
     auto get_stream() -> std::shared_ptr<T>
     {
-        return m_storage.get_stream<N>();
+        return m_storage.template get_stream<N, T>();
     }
 
     auto lock() -> bool
@@ -242,7 +303,11 @@ public:
     {
         m_storage.unlock();
     }
-    auto process(std::function<void(typename Streams::Sample const&...)> const& func) -> bool
+    //func is called as func(typename Streams::Sample const&...) for every complete set of samples.
+    //The samples func pushes inherit the oldest capture time of the set, and so do the ones pushed after process
+    // returns, from the last set
+    template<class Func>
+    auto process(Func const& func) -> bool
     {
         if (!m_storage.lock())
         {
@@ -255,7 +320,8 @@ public:
         for (size_t i = 0; i < count; i++)
         {
             auto params = m_storage.get_params(i);
-            detail::call(func, params);
+            Capture_Context::set(m_storage.get_capture_tp(i));
+            detail::apply(func, params);
         }
 
         m_storage.consume(count);
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <atomic>
+#include "common/stream/IStream.h"
+
+namespace silk
+{
+
+//Fixed capacity history of the samples pushed in a stream.
+//Samples are addressed by their absolute index - the number of samples pushed before them - so each consumer keeps its
+// own read cursor and reads the samples in place. Pushing never allocates after set_capacity.
+//A consumer can read while the producer pushes from another thread (see the detached branches of the Node_Executor):
+// a sample is published only once it's filled. It can be overwritten while read only if the producer laps the consumer.
+template<class Sample>
+class Sample_Ring
+{
+public:
+    void set_capacity(size_t capacity)
+    {
+        size_t pow2 = 1;
+        while (pow2 < capacity)
+        {
+            pow2 <<= 1;
+        }
+        m_samples.clear();
+        m_samples.resize(pow2);
+        m_mask = pow2 - 1;
+        m_first_valid_index = get_end_index(); //the old samples are gone
+    }
+    size_t get_capacity() const
+    {
+        return m_samples.size();
+    }
+
+    void push_back(Sample const& sample)
+    {
+        begin_push() = sample;
+        end_push();
+    }
+
+    //for filling the next sample in place. Assigning to the slot reuses the memory the values in it own
+    auto begin_push() -> Sample&
+    {
+        QASSERT(!m_samples.empty());
+        return m_samples[m_end_index.load(std::memory_order_relaxed) & m_mask];
+    }
+    void end_push()
+    {
+        m_end_index.store(m_end_index.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    //one past the index of the newest sample
+    uint64_t get_end_index() const
+    {
+        return m_end_index.load(std::memory_order_acquire);
+    }
+    //the index of the oldest sample still available
+    uint64_t get_begin_index() const
+    {
+        return get_begin_index(get_end_index());
+    }
+
+    Sample const& get(uint64_t index) const
+    {
+        QASSERT(index >= get_begin_index() && index < get_end_index());
+        return m_samples[index & m_mask];
+    }
+
+    //the samples from begin to the newest one. The ones already overwritten are left out
+    auto get_view(uint64_t begin) const -> stream::Sample_View<Sample>
+    {
+        return get_view(begin, get_end_index());
+    }
+    auto get_view(uint64_t begin, uint64_t end) const -> stream::Sample_View<Sample>
+    {
+        QASSERT(begin <= end && end <= get_end_index());
+        return stream::Sample_View<Sample>(m_samples.data(), m_mask, std::min(std::max(begin, get_begin_index(end)), end), end);
+    }
+
+private:
+    uint64_t get_begin_index(uint64_t end) const
+    {
+        uint64_t capacity = m_samples.size();
+        return std::max(m_first_valid_index, end > capacity ? end - capacity : uint64_t(0));
+    }
+
+    std::vector<Sample> m_samples;
+    uint64_t m_mask = 0;
+    std::atomic<uint64_t> m_end_index = { 0 };
+    uint64_t m_first_valid_index = 0;
+};
+
+//Implemented by the streams that keep their samples in a Sample_Ring so the Sample_Accumulator can read them without copying
+template<class Sample>
+class ISample_Ring_Source
+{
+public:
+    virtual ~ISample_Ring_Source() = default;
+    virtual auto get_sample_ring() const -> Sample_Ring<Sample> const& = 0;
+};
+
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+namespace silk
+{
+
+//Counts the edits that can destroy streams (removing nodes or streams from the HAL).
+//Graph edits happen on the main thread between frames so nodes see a stable value while processing.
+class Graph_Generation
+{
+public:
+    static uint32_t get() { return s_generation.load(std::memory_order_relaxed); }
+    static void bump() { s_generation.fetch_add(1, std::memory_order_relaxed); }
+
+private:
+    static std::atomic<uint32_t> s_generation;
+};
+
+//A stream binding resolved once, when the input path is set.
+//get() is a plain pointer read while the graph is unchanged. Only after a graph edit it goes through the weak_ptr
+// once to check that the stream is still alive, so processing doesn't touch the shared_ptr refcounts every frame.
+template<class T>
+class Stream_Handle
+{
+public:
+    Stream_Handle() = default;
+    Stream_Handle(std::shared_ptr<T> const& ptr)
+    {
+        reset(ptr);
+    }
+
+    void reset(std::shared_ptr<T> const& ptr = std::shared_ptr<T>())
+    {
+        m_weak_ptr = ptr;
+        m_ptr = ptr.get();
+        m_generation = Graph_Generation::get();
+    }
+
+    T* get() const
+    {
+        uint32_t generation = Graph_Generation::get();
+        if (m_generation != generation)
+        {
+            m_ptr = m_weak_ptr.lock().get();
+            m_generation = generation;
+        }
+        return m_ptr;
+    }
+
+    //for when ownership is needed outside of processing
+    std::shared_ptr<T> lock() const
+    {
+        return m_weak_ptr.lock();
+    }
+
+    T* operator->() const { return get(); }
+    explicit operator bool() const { return get() != nullptr; }
+
+private:
+    std::weak_ptr<T> m_weak_ptr;
+    mutable T* m_ptr = nullptr;
+    mutable uint32_t m_generation = 0;
+};
+
+}
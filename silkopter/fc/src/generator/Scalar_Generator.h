@@ -43,7 +43,7 @@ private:
     std::shared_ptr<hal::Scalar_Generator_Descriptor> m_descriptor;
     std::shared_ptr<hal::Scalar_Generator_Config> m_config;
 
-    std::weak_ptr<stream::IFloat> m_modulation_stream;
+    Stream_Handle<stream::IFloat> m_modulation_stream;
     std::string m_modulation_stream_path;
 
     typedef Basic_Output_Stream<Stream_t> Output_Stream;
@@ -165,7 +165,7 @@ void Scalar_Generator<Stream_t>::process()
 
     m_output_stream->clear();
 
-    auto modulation_stream = m_modulation_stream.lock();
+    auto modulation_stream = m_modulation_stream.get();
     if (modulation_stream)
     {
         auto const& samples = modulation_stream->get_samples();
@@ -173,7 +173,7 @@ void Scalar_Generator<Stream_t>::process()
         {
             if (s.is_healthy)
             {
-                m_output_stream->push_sample(m_config->get_value() + s.value, true);
+                m_output_stream->push_sample(m_config->get_value() + s.value, true, s.capture_tp);
             }
             else
             {
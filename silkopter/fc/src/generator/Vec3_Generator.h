@@ -44,7 +44,7 @@ private:
     std::shared_ptr<hal::Vec3_Generator_Config> m_config;
 
     std::array<std::string, 3> m_modulation_stream_paths;
-    std::array<std::weak_ptr<stream::IFloat>, 3> m_modulation_streams;
+    std::array<Stream_Handle<stream::IFloat>, 3> m_modulation_streams;
     std::array<std::vector<stream::IFloat::Sample>, 3> m_modulation_samples;
 
     typedef Basic_Output_Stream<Stream_t> Output_Stream;
@@ -182,7 +182,7 @@ void Vec3_Generator<Stream_t>::process()
 
     for (size_t s = 0; s < 3; s++)
     {
-        auto stream = m_modulation_streams[s].lock();
+        auto stream = m_modulation_streams[s].get();
         if (stream)
         {
             auto const& samples = stream->get_samples();
@@ -200,21 +200,25 @@ void Vec3_Generator<Stream_t>::process()
     for (size_t i = 0; i < count; i++)
     {
         typename Stream_t::Value value = typename Stream_t::Value(m_config->get_value());
+        stream::Capture_Tp capture_tp = 0;
 
         if (m_modulation_samples[0].size() > i)
         {
             value.x += m_modulation_samples[0][i].value;
+            capture_tp = stream::get_oldest_capture_tp(capture_tp, m_modulation_samples[0][i].capture_tp);
         }
         if (m_modulation_samples[1].size() > i)
         {
             value.y += m_modulation_samples[1][i].value;
+            capture_tp = stream::get_oldest_capture_tp(capture_tp, m_modulation_samples[1][i].capture_tp);
         }
         if (m_modulation_samples[2].size() > i)
         {
             value.z += m_modulation_samples[2][i].value;
+            capture_tp = stream::get_oldest_capture_tp(capture_tp, m_modulation_samples[2][i].capture_tp);
         }
 
-        m_output_stream->push_sample(value, true);
+        m_output_stream->push_sample(value, true, capture_tp);
     }
 
     //consume samples
@@ -2,7 +2,11 @@
 #include "HAL.h"
 #include "RC_Comms.h"
 #include "GS_Comms.h"
+#include "Event_Loop.h"
 #include "utils/Clock.h"
+#include "utils/Frame_Trace.h"
+#include "utils/Thread_Registry.h"
+#include "Profiler.h"
 
 #include <asio.hpp>
 #include <thread>
@@ -19,12 +23,6 @@ size_t s_test = 0;
 bool s_exit = false;
 asio::io_service s_async_io_service;
 
-struct Memory
-{
-    size_t allocation_count = 0;
-    size_t free_count = 0;
-} s_memory;
-
 //namespace boost
 //{
 //	void throw_exception(std::exception const & e)
@@ -53,27 +51,6 @@ void __assert_fail(const char *__assertion, const char *__file, unsigned int __l
     QASSERT_MSG(false, "assert: {}:{}: {}: {}", __file, __line, __function, __assertion);
 }
 
-//static void* malloc_hook(size_t size, const void* caller)
-//{
-//    s_memory.allocation_count++;
-//    __malloc_hook = nullptr;
-//    printf("\n%d, %d", int(s_memory.allocation_count), int(s_memory.free_count));
-//    fflush(stdout);
-//    void* ptr = malloc(size);
-//    __malloc_hook = &malloc_hook;
-//    return ptr;
-//}
-//void free_hook(void* ptr, const void* caller)
-//{
-//    s_memory.free_count++;
-//    __free_hook = nullptr;
-//    printf("\n%d, %d", int(s_memory.allocation_count), int(s_memory.free_count));
-//    fflush(stdout);
-//    free(ptr);
-//    __free_hook = &free_hook;
-//}
-
-
 // Define the function to be called when ctrl-c (SIGINT) signal is sent to process
 void signal_handler(int signum)
 {
@@ -101,9 +78,6 @@ int main(int argc, char const* argv[])
 //    signal(SIGABRT, signal_handler);
     signal(SIGTERM, signal_handler);
 
-    //__malloc_hook = &malloc_hook;
-    //__free_hook = &free_hook;
-
     //set the new_handler
     std::set_new_handler(out_of_memory_handler);
 
@@ -121,6 +95,9 @@ int main(int argc, char const* argv[])
     q::logging::add_logger(q::logging::Logger_uptr(new q::logging::Console_Logger()));
     q::logging::set_decorations(q::logging::Decorations(q::logging::Decoration::TIMESTAMP, q::logging::Decoration::LEVEL, q::logging::Decoration::TOPIC));
 
+    //the rate loop only queues the logs, a background thread formats and prints them
+    q::logging::start_async(1024, []() { util::Thread_Registry::register_current_thread("log"); });
+
     QLOG_TOPIC("silk");
 
 //    namespace po = boost::program_options;
@@ -147,13 +124,29 @@ int main(int argc, char const* argv[])
     QLOGI("Creating io_service thread");
 
     std::unique_ptr<asio::io_service::work> async_work(new asio::io_service::work(s_async_io_service));
-    auto async_thread = std::thread([]() { s_async_io_service.run(); });
+    auto async_thread = std::thread([]()
+    {
+        util::Thread_Registry::register_current_thread("async");
+        s_async_io_service.run();
+    });
 
     try
     {
         silk::HAL hal;
         silk::RC_Comms rc_comms(hal);
         silk::GS_Comms gs_comms(hal, rc_comms);
+        silk::Event_Loop event_loop;
+        std::vector<uint32_t> timer_rates;
+        std::vector<int> gpio_fds;
+
+        auto result = event_loop.init();
+        if (result != ts::success)
+        {
+            QLOGE("Cannot create the event loop: {}", result.error().what());
+            goto exit;
+        }
+        rc_comms.set_data_received_callback([&event_loop]() { event_loop.signal(); });
+        gs_comms.set_data_received_callback([&event_loop]() { event_loop.signal(); });
 
         if (!hal.init(rc_comms, gs_comms))
         {
@@ -183,42 +176,56 @@ int main(int argc, char const* argv[])
 //            }
 //        }
 
-#if defined RASPBERRY_PI
-    {
-        int policy = SCHED_FIFO;
-        struct sched_param param;
-        param.sched_priority = sched_get_priority_max(policy);
-        if (pthread_setschedparam(pthread_self(), policy, &param) != 0)
-        {
-            perror("Failed to set priority for main thread");
-            //exit(EXIT_FAILURE);
-        }
-        policy = SCHED_IDLE;
-        param.sched_priority = sched_get_priority_min(policy);
-        if (pthread_setschedparam(async_thread.native_handle(), policy, &param) != 0)
-        {
-            perror("Failed to set priority for async thread");
-            //exit(EXIT_FAILURE);
-        }
-
-//        cpu_set_t cpuset;
-//        CPU_ZERO(&cpuset);
-//        CPU_SET(3, &cpuset);
-//        int s = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
-//        if (s != 0)
-//        {
-//            QLOGW("pthread_setaffinity_np failed: {}", s);
-//        }
-    }
-#endif
-
         QLOGI("All systems up. Ready to fly...");
 
+        //only now, so none of the init logs are skipped.
+        //A warning in a 1KHz process is printed at most 10 times per second
+        q::logging::set_rate_limit(10);
+
         {
-            size_t count = 0;
+            //the HAL settings have the scheduling profile of the main thread
+            util::Thread_Registry::register_current_thread("main");
+            util::Frame_Trace::Name_Id const frame_trace_name = util::Frame_Trace::register_name("frame");
+            util::Frame_Trace::Name_Id const gs_comms_trace_name = util::Frame_Trace::register_name("gs_comms");
+            util::Frame_Trace::Name_Id const rc_comms_trace_name = util::Frame_Trace::register_name("rc_comms");
+            util::Frame_Trace::Name_Id const hal_trace_name = util::Frame_Trace::register_name("hal");
+
             auto last = Clock::now();
             while (!s_exit)
             {
+                //the data-ready lines and the source rates change when nodes are added or removed.
+                //The lines go first, before new timers can reuse the fd numbers of the closed lines
+                if (gpio_fds != hal.get_data_ready_fds())
+                {
+                    gpio_fds = hal.get_data_ready_fds();
+                    auto result = event_loop.set_gpio_fds(gpio_fds);
+                    if (result != ts::success)
+                    {
+                        QLOGE("Cannot set the event loop data-ready lines: {}", result.error().what());
+                    }
+                }
+                if (timer_rates != hal.get_source_rates())
+                {
+                    timer_rates = hal.get_source_rates();
+                    auto result = event_loop.set_timer_rates(timer_rates);
+                    if (result != ts::success)
+                    {
+                        QLOGE("Cannot set the event loop timers: {}", result.error().what());
+                    }
+                }
+
+                //sleep until a source sample is due or the comms have data.
+                //The timeout keeps the comms and the HAL ticking when there are no sources.
+                //With a virtual clock (a log replay running as fast as possible) the next frame starts right away
+                if (!hal.get_virtual_clock())
+                {
+                    boost::optional<Clock::duration> latency = event_loop.wait(std::chrono::milliseconds(5));
+                    if (latency)
+                    {
+                        hal.add_wakeup_latency(*latency);
+                    }
+                }
+
                 auto start = Clock::now();
                 auto dt = start - last;
                 last = start;
@@ -230,20 +237,41 @@ int main(int argc, char const* argv[])
                 {
                     QLOGW("Process Latency of {}!!!!!", dt);
                 }
-                gs_comms.process();
-                rc_comms.process();
-                hal.process();
-
-                //No sleeping here!!! process as fast as possible as the nodes are not always in the ideal order
-                // and out of order nodes will be processes next 'frame'. So the quicker the frames, the smaller the lag between nodes
-//#ifndef RASPBERRY_PI
-                if (count++ > 5)
+                util::Frame_Trace::begin(frame_trace_name, start);
+                PROFILE_FRAME("frame");
                 {
-                    count = 0;
-                    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                    util::Frame_Trace::Scope trace_scope(gs_comms_trace_name);
+                    gs_comms.process();
                 }
-                //std::this_thread::yield();
-//#endif
+                {
+                    util::Frame_Trace::Scope trace_scope(rc_comms_trace_name);
+                    rc_comms.process();
+                }
+                {
+                    util::Frame_Trace::Scope trace_scope(hal_trace_name);
+                    hal.process();
+                }
+                auto end = Clock::now();
+                util::Frame_Trace::end(frame_trace_name, end);
+
+                //on a deadline miss freeze the trace and write it out on the async thread. Misses during the dump are not traced
+                boost::optional<Clock::duration> deadline = hal.get_frame_deadline();
+                if (deadline && end - start > *deadline && util::Frame_Trace::freeze())
+                {
+                    std::string path = silk::s_program_path + "/frame_trace.json";
+                    QLOGW("Frame took {}, over the {} deadline. Writing the frame trace to {}", end - start, *deadline, path);
+                    silk::async(std::function<void()>([path]()
+                    {
+                        auto result = util::Frame_Trace::dump(path);
+                        if (result != ts::success)
+                        {
+                            QLOGE("Cannot write the frame trace: {}", result.error().what());
+                        }
+                    }));
+                }
+
+                //The HAL processes the nodes in dependency order so a sample goes from the sensors to the sinks in one frame.
+                //Only feedback cycles (like the simulator) see their inputs one frame late.
 
 //                {
 //                    static Clock::time_point last_timestamp = Clock::now();
@@ -292,5 +320,6 @@ exit:
     }
 
     QLOGI("Closing");
+    q::logging::stop_async();
 }
 
@@ -9,6 +9,9 @@ namespace silk
 namespace node
 {
 
+//the initial rotation is computed from the average of this many accelerometer and magnetometer samples
+static constexpr size_t INIT_SAMPLE_COUNT = 50;
+
 Comp_AHRS::Comp_AHRS(HAL& hal)
     : m_hal(hal)
     , m_descriptor(new hal::Comp_AHRS_Descriptor())
@@ -61,6 +64,36 @@ auto Comp_AHRS::get_outputs() const -> std::vector<Output>
     return outputs;
 }
 
+auto Comp_AHRS::compute_noisy_rotation(math::vec3f const& acceleration, math::vec3f const& magnetic_field) -> math::quatf
+{
+    m_noisy_up_w = math::normalized<float, math::safe>(acceleration); //acceleration points opposite of gravity - so up
+    math::vec3f front = magnetic_field;
+    //sanity checks - zero magnetic field, colinear mf and acc vectors
+    if (math::is_zero(math::length_sq(front), math::epsilon<float>()))
+    {
+        QLOGW("zero front vector - invalid magnetic field!!!!!");
+        front = math::vec3f(0, 1, 0);
+    }
+    front = math::normalized<float, math::safe>(front);
+    if (math::abs(math::dot(m_noisy_up_w, front)) < 0.99f)
+    {
+        m_noisy_front_w = front;
+    }
+    else
+    {
+        QLOGW("colinear front and up vectors - using the previous front vector!!!!!");
+    }
+
+    m_noisy_right_w = math::normalized<float, math::safe>(math::cross(m_noisy_front_w, m_noisy_up_w));
+    m_noisy_front_w = math::cross(m_noisy_up_w, m_noisy_right_w);
+
+    math::mat3f mat(m_noisy_right_w /* X */, m_noisy_front_w /* Y */, m_noisy_up_w /* Z */);
+    math::quatf noisy_quat;
+    noisy_quat.set_from_mat3(mat);
+    noisy_quat.invert();
+    return noisy_quat;
+}
+
 void Comp_AHRS::process()
 {
     QLOG_TOPIC("comp_ahrs::process");
@@ -73,6 +106,37 @@ void Comp_AHRS::process()
                                       stream::IAcceleration::Sample const& a_sample,
                                       stream::IMagnetic_Field::Sample const& mf_sample)
     {
+        if (m_init_sample_count < INIT_SAMPLE_COUNT)
+        {
+            if (a_sample.is_healthy && mf_sample.is_healthy)
+            {
+                m_init_acceleration_sum += a_sample.value;
+                m_init_magnetic_field_sum += mf_sample.value;
+                m_init_sample_count++;
+                if (m_init_sample_count == INIT_SAMPLE_COUNT)
+                {
+                    math::quatf rotation = compute_noisy_rotation(m_init_acceleration_sum, m_init_magnetic_field_sum);
+                    m_mahony.reset(rotation);
+                    m_output_stream->push_sample(rotation, av_sample.is_healthy);
+                    return;
+                }
+            }
+            m_output_stream->push_last_sample(false);
+            return;
+        }
+
+        bool is_healthy = av_sample.is_healthy & a_sample.is_healthy & mf_sample.is_healthy;
+
+        if (m_config->get_mode() == hal::Comp_AHRS_Config::mode_t::MAHONY)
+        {
+            //without a gyro the rotation is held, only the corrections move it
+            m_mahony.process(av_sample.is_healthy ? math::vec3f(av_sample.value) : m_mahony.get_gyro_bias(),
+                             a_sample.is_healthy ? math::vec3f(a_sample.value) : math::vec3f::zero,
+                             mf_sample.is_healthy ? math::vec3f(mf_sample.value) : math::vec3f::zero);
+            m_output_stream->push_sample(m_mahony.get_rotation(), is_healthy);
+            return;
+        }
+
         float av_length = 0;
 
         math::quatf rotation(m_output_stream->get_last_sample().value);
@@ -104,52 +168,19 @@ void Comp_AHRS::process()
 
         if (a_sample.is_healthy && mf_sample.is_healthy)
         {
-            m_noisy_up_w = math::normalized<float, math::safe>(a_sample.value); //acceleration points opposite of gravity - so up
-            math::vec3f front = mf_sample.value;
-            //sanity checks - zero magnetic field, colinear mf and acc vectors
-            if (math::is_zero(math::length_sq(front), math::epsilon<float>()))
-            {
-                QLOGW("zero front vector - invalid magnetic field!!!!!");
-                front = math::vec3f(0, 1, 0);
-            }
-            front = math::normalized<float, math::safe>(front);
-            if (math::abs(math::dot(m_noisy_up_w, front)) < 0.99f)
-            {
-                m_noisy_front_w = front;
-            }
-            else
-            {
-                QLOGW("colinear front and up vectors - using the previous front vector!!!!!");
-            }
-
-            m_noisy_right_w = math::normalized<float, math::safe>(math::cross(m_noisy_front_w, m_noisy_up_w));
-            m_noisy_front_w = math::cross(m_noisy_up_w, m_noisy_right_w);
-
-            math::mat3f mat(m_noisy_right_w /* X */, m_noisy_front_w /* Y */, m_noisy_up_w /* Z */);
-            math::quatf noisy_quat;
-            noisy_quat.set_from_mat3(mat);
-            noisy_quat.invert();
+            math::quatf noisy_quat = compute_noisy_rotation(a_sample.value, mf_sample.value);
 
             math::quatf& rot = rotation;
 
             //cancel drift
-            static int xxx = 50;
-            if (xxx > 0)
-            {
-                xxx--;
-                rot = noisy_quat;
-            }
-            else
-            {
-                //take the rate of rotation into account here - the quicker the rotation the bigger the mu
-                //like this we compensate for gyro saturation errors
-                float mu = (dts + av_length) * m_config->get_drift_correction_factor();
-                rot = math::nlerp<float, math::safe>(rot, noisy_quat, mu);
-            }
+            //take the rate of rotation into account here - the quicker the rotation the bigger the mu
+            //like this we compensate for gyro saturation errors
+            float mu = (dts + av_length) * m_config->get_drift_correction_factor();
+            rot = math::nlerp<float, math::safe>(rot, noisy_quat, mu);
             rot = math::normalized<float, math::safe>(rot);
         }
 
-        m_output_stream->push_sample(rotation, av_sample.is_healthy & a_sample.is_healthy & mf_sample.is_healthy);
+        m_output_stream->push_sample(rotation, is_healthy);
     });
 }
 
@@ -167,10 +198,26 @@ ts::Result<void> Comp_AHRS::set_config(hal::INode_Config const& config)
     {
         return make_error("Wrong config type");
     }
+    bool is_switching_to_mahony = specialized->get_mode() == hal::Comp_AHRS_Config::mode_t::MAHONY &&
+                                  m_config->get_mode() != hal::Comp_AHRS_Config::mode_t::MAHONY;
     *m_config = *specialized;
 
     //m_config->drift_correction_factor = math::clamp(m_config->drift_correction_factor, 0.f, 1.f);
 
+    uint32_t rate = m_output_stream->get_rate();
+    Mahony_AHRS_Filter::Params params;
+    params.proportional_gain = m_config->get_mahony_kp();
+    params.integral_gain = m_config->get_mahony_ki();
+    params.max_gyro_bias = m_config->get_max_gyro_bias();
+    params.magnetic_field_decimation = rate / math::max(m_config->get_magnetic_field_correction_rate(), 1u);
+    m_mahony.setup(std::chrono::duration<float>(m_output_stream->get_dt()).count(), params);
+
+    //the mahony filter continues from the last rotation, the gains can be changed in flight without a reset
+    if (is_switching_to_mahony)
+    {
+        m_mahony.reset(m_output_stream->get_last_sample().value);
+    }
+
     return ts::success;
 }
 auto Comp_AHRS::get_config() const -> std::shared_ptr<const hal::INode_Config>
@@ -9,6 +9,7 @@
 
 #include "Sample_Accumulator.h"
 #include "Basic_Output_Stream.h"
+#include "Mahony_AHRS_Filter.h"
 
 
 namespace silk
@@ -27,6 +28,10 @@ namespace silk
 namespace node
 {
 
+//Estimates the local to world rotation from the gyro, accelerometer and magnetometer.
+//The COMPLEMENTARY mode integrates the gyro and nlerps towards the rotation measured by the accelerometer and
+// magnetometer every sample. The MAHONY mode corrects the gyro instead - see Mahony_AHRS_Filter.
+//Both start from the average of the first accelerometer and magnetometer samples.
 class Comp_AHRS : public IProcessor
 {
 public:
@@ -51,6 +56,8 @@ public:
 private:
     ts::Result<void> init();
 
+    auto compute_noisy_rotation(math::vec3f const& acceleration, math::vec3f const& magnetic_field) -> math::quatf;
+
     HAL& m_hal;
 
     std::shared_ptr<hal::Comp_AHRS_Descriptor> m_descriptor;
@@ -62,6 +69,12 @@ private:
     math::vec3f m_noisy_right_w;
     math::vec3f m_noisy_up_w;
 
+    size_t m_init_sample_count = 0;
+    math::vec3f m_init_acceleration_sum;
+    math::vec3f m_init_magnetic_field_sum;
+
+    Mahony_AHRS_Filter m_mahony;
+
     typedef Basic_Output_Stream<stream::IFrame> Output_Stream;
     mutable std::shared_ptr<Output_Stream> m_output_stream;
 };
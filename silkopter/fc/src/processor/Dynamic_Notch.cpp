@@ -0,0 +1,320 @@
+#include "FCStdAfx.h"
+#include "Dynamic_Notch.h"
+
+#include "hal.def.h"
+
+namespace silk
+{
+namespace node
+{
+
+//a peak needs at least 4 times the mean power (6dB) of the searched band, so a quiet spectrum doesn't move the notches
+static constexpr float PEAK_TO_MEAN_RATIO = 4.f;
+//how much of the distance to a new peak a notch moves every analysis
+static constexpr float FREQUENCY_SMOOTHING = 0.5f;
+//a peak further than this from all the tracked ones takes a free notch, in bins
+static constexpr float NEW_PEAK_DISTANCE = 4.f;
+
+Dynamic_Notch::Dynamic_Notch(HAL& hal)
+    : m_hal(hal)
+    , m_descriptor(new hal::Dynamic_Notch_Descriptor())
+    , m_config(new hal::Dynamic_Notch_Config())
+{
+    m_output_stream = std::make_shared<Output_Stream>();
+}
+
+ts::Result<void> Dynamic_Notch::init(hal::INode_Descriptor const& descriptor)
+{
+    QLOG_TOPIC("dynamic_notch::init");
+
+    auto specialized = dynamic_cast<hal::Dynamic_Notch_Descriptor const*>(&descriptor);
+    if (!specialized)
+    {
+        return make_error("Wrong descriptor type");
+    }
+    *m_descriptor = *specialized;
+
+    return init();
+}
+ts::Result<void> Dynamic_Notch::init()
+{
+    m_output_stream->set_rate(m_descriptor->get_rate());
+
+    if (!m_notch_bank.setup(m_descriptor->get_notch_count()))
+    {
+        return make_error("Too many notches: {}", m_descriptor->get_notch_count());
+    }
+    m_frequencies.fill(0.f);
+
+    m_peak_streams.resize(m_descriptor->get_notch_count());
+    for (auto& ps: m_peak_streams)
+    {
+        ps = std::make_shared<Peak_Stream>();
+        ps->set_rate(m_descriptor->get_rate());
+    }
+
+    //hann window
+    for (size_t i = 0; i < FFT_SIZE; i++)
+    {
+        m_window[i] = 0.5f - 0.5f * math::cos(2.f * math::anglef::pi * i / (FFT_SIZE - 1));
+    }
+
+    //only the BIN_COUNT bins up to nyquist are written, the input is real.
+    //the fft allocates its twiddles on the first transform of a size, so do it here and not in process
+    m_fft.SetFlag(Eigen::FFT<float>::HalfSpectrum);
+    m_fft_input.fill(0.f);
+    m_fft.fwd(m_fft_output.data(), m_fft_input.data(), FFT_SIZE);
+
+    float rate = static_cast<float>(m_descriptor->get_rate());
+    m_config->set_max_frequency(math::min(m_config->get_max_frequency(), rate / 2.f - rate / 100.f));
+
+    return ts::success;
+}
+
+ts::Result<void> Dynamic_Notch::start(Clock::time_point tp)
+{
+    m_output_stream->set_tp(tp);
+    for (auto& ps: m_peak_streams)
+    {
+        ps->set_tp(tp);
+    }
+    return ts::success;
+}
+
+auto Dynamic_Notch::get_inputs() const -> std::vector<Input>
+{
+    std::vector<Input> inputs =
+    {{
+        { stream::IAngular_Velocity::TYPE, m_descriptor->get_rate(), "input", m_accumulator.get_stream_path(0) }
+    }};
+    return inputs;
+}
+auto Dynamic_Notch::get_outputs() const -> std::vector<Output>
+{
+    std::vector<Output> outputs(1 + m_peak_streams.size());
+    outputs[0].name = "output";
+    outputs[0].stream = m_output_stream;
+    for (size_t i = 0; i < m_peak_streams.size(); i++)
+    {
+        outputs[i + 1].name = q::util::format<std::string>("peak_{}", i);
+        outputs[i + 1].stream = m_peak_streams[i];
+    }
+    return outputs;
+}
+
+void Dynamic_Notch::process()
+{
+    QLOG_TOPIC("dynamic_notch::process");
+
+    m_output_stream->clear();
+    for (auto& ps: m_peak_streams)
+    {
+        ps->clear();
+    }
+
+    m_accumulator.process([this](stream::IAngular_Velocity::Sample const& i_sample)
+    {
+        if (i_sample.is_healthy)
+        {
+            m_history[m_history_pos] = i_sample.value;
+            m_history_pos = (m_history_pos + 1) % FFT_SIZE;
+            m_history_size = std::min(m_history_size + 1, FFT_SIZE);
+            m_samples_since_analysis++;
+
+            Notch_Bank::Lanes x = Traits::to_lanes(i_sample.value);
+            m_notch_bank.process(x);
+            m_output_stream->push_sample(Traits::from_lanes(x), true);
+        }
+        else
+        {
+            m_output_stream->push_last_sample(false);
+        }
+
+        for (size_t i = 0; i < m_peak_streams.size(); i++)
+        {
+            m_peak_streams[i]->push_sample(m_frequencies[i], true);
+        }
+    });
+
+    if (m_analysis_axis == AXIS_COUNT &&
+            m_history_size == FFT_SIZE &&
+            m_samples_since_analysis >= HOP_SIZE)
+    {
+        m_samples_since_analysis = 0;
+        m_analysis_axis = 0;
+        m_power.fill(0.f);
+    }
+
+    //one axis per process call
+    if (m_analysis_axis < AXIS_COUNT)
+    {
+        analyze_axis();
+        m_analysis_axis++;
+        if (m_analysis_axis == AXIS_COUNT)
+        {
+            find_peaks();
+        }
+    }
+}
+
+void Dynamic_Notch::analyze_axis()
+{
+    //oldest sample first
+    for (size_t i = 0; i < FFT_SIZE; i++)
+    {
+        math::vec3f const& value = m_history[(m_history_pos + i) % FFT_SIZE];
+        m_fft_input[i] = value[static_cast<uint8_t>(m_analysis_axis)] * m_window[i];
+    }
+
+    m_fft.fwd(m_fft_output.data(), m_fft_input.data(), FFT_SIZE);
+
+    for (size_t i = 0; i < BIN_COUNT; i++)
+    {
+        m_power[i] += std::norm(m_fft_output[i]);
+    }
+}
+
+void Dynamic_Notch::find_peaks()
+{
+    float rate = static_cast<float>(m_output_stream->get_rate());
+    float bin_width = rate / FFT_SIZE;
+
+    //the peaks need a neighbour bin on both sides
+    size_t min_bin = std::max<size_t>(static_cast<size_t>(math::ceil(m_config->get_min_frequency() / bin_width)), 1);
+    size_t max_bin = std::min<size_t>(static_cast<size_t>(m_config->get_max_frequency() / bin_width), BIN_COUNT - 2);
+    if (min_bin > max_bin)
+    {
+        return;
+    }
+
+    float mean_power = 0.f;
+    for (size_t i = min_bin; i <= max_bin; i++)
+    {
+        mean_power += m_power[i];
+    }
+    mean_power /= static_cast<float>(max_bin - min_bin + 1);
+
+    struct Peak
+    {
+        float power = 0.f;
+        float bin = 0.f;
+    };
+
+    //the strongest peaks, strongest first
+    size_t notch_count = m_notch_bank.get_notch_count();
+    std::array<Peak, Notch_Bank::MAX_NOTCHES> peaks;
+    size_t peak_count = 0;
+
+    for (size_t i = min_bin; i <= max_bin; i++)
+    {
+        float p = m_power[i];
+        if (p <= m_power[i - 1] || p < m_power[i + 1] || p < mean_power * PEAK_TO_MEAN_RATIO)
+        {
+            continue;
+        }
+
+        Peak peak;
+        peak.power = p;
+        peak.bin = static_cast<float>(i);
+
+        //parabolic interpolation between the neighbour bins
+        float denominator = m_power[i - 1] - 2.f * p + m_power[i + 1];
+        if (denominator < 0.f)
+        {
+            peak.bin += 0.5f * (m_power[i - 1] - m_power[i + 1]) / denominator;
+        }
+
+        size_t pos = peak_count;
+        while (pos > 0 && peaks[pos - 1].power < peak.power)
+        {
+            if (pos < notch_count)
+            {
+                peaks[pos] = peaks[pos - 1];
+            }
+            pos--;
+        }
+        if (pos < notch_count)
+        {
+            peaks[pos] = peak;
+            peak_count = std::min(peak_count + 1, notch_count);
+        }
+    }
+
+    //every peak moves the nearest tracked notch towards it, or takes a free notch if it's far from all of them
+    std::array<bool, Notch_Bank::MAX_NOTCHES> is_assigned;
+    is_assigned.fill(false);
+    for (size_t pi = 0; pi < peak_count; pi++)
+    {
+        float frequency = peaks[pi].bin * bin_width;
+
+        size_t best = notch_count;
+        float best_distance = std::numeric_limits<float>::max();
+        for (size_t ni = 0; ni < notch_count; ni++)
+        {
+            if (is_assigned[ni])
+            {
+                continue;
+            }
+            float distance = m_frequencies[ni] > 0.f ? math::abs(m_frequencies[ni] - frequency) : NEW_PEAK_DISTANCE * bin_width;
+            if (distance < best_distance)
+            {
+                best_distance = distance;
+                best = ni;
+            }
+        }
+        if (best == notch_count)
+        {
+            break;
+        }
+        is_assigned[best] = true;
+
+        float& f = m_frequencies[best];
+        f = f > 0.f ? f + (frequency - f) * FREQUENCY_SMOOTHING : frequency;
+        if (!m_notch_bank.set_notch(best, rate, f, m_config->get_q()))
+        {
+            m_notch_bank.disable_notch(best);
+            f = 0.f;
+        }
+    }
+}
+
+ts::Result<void> Dynamic_Notch::set_input_stream_path(size_t idx, std::string const& path)
+{
+    return m_accumulator.set_stream_path(idx, path, m_output_stream->get_rate(), m_hal);
+}
+
+ts::Result<void> Dynamic_Notch::set_config(hal::INode_Config const& config)
+{
+    QLOG_TOPIC("dynamic_notch::set_config");
+
+    auto specialized = dynamic_cast<hal::Dynamic_Notch_Config const*>(&config);
+    if (!specialized)
+    {
+        return make_error("Wrong config type");
+    }
+    *m_config = *specialized;
+
+    float rate = static_cast<float>(m_output_stream->get_rate());
+    float max_frequency = rate / 2.f - rate / 100.f;
+    m_config->set_max_frequency(math::clamp(m_config->get_max_frequency(), 1.f, max_frequency));
+    m_config->set_min_frequency(math::clamp(m_config->get_min_frequency(), 1.f, m_config->get_max_frequency()));
+
+    return ts::success;
+}
+auto Dynamic_Notch::get_config() const -> std::shared_ptr<const hal::INode_Config>
+{
+    return m_config;
+}
+
+auto Dynamic_Notch::get_descriptor() const -> std::shared_ptr<const hal::INode_Descriptor>
+{
+    return m_descriptor;
+}
+
+ts::Result<std::shared_ptr<messages::INode_Message>> Dynamic_Notch::send_message(messages::INode_Message const& message)
+{
+    return make_error("Unknown message");
+}
+
+}
+}
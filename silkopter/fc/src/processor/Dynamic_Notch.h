@@ -0,0 +1,103 @@
+#pragma once
+
+#include "common/node/IProcessor.h"
+#include "common/stream/IAngular_Velocity.h"
+#include "common/stream/IFloat.h"
+#include "utils/Notch_Bank.h"
+#include "HAL.h"
+#include "Sample_Accumulator.h"
+#include "Basic_Output_Stream.h"
+
+#include "unsupported/Eigen/FFT"
+
+namespace silk
+{
+namespace hal
+{
+struct Dynamic_Notch_Descriptor;
+struct Dynamic_Notch_Config;
+}
+}
+
+
+namespace silk
+{
+namespace node
+{
+
+//Removes the motor and prop resonances from an angular velocity stream with notch filters that follow them.
+//The last FFT_SIZE samples are windowed and transformed every HOP_SIZE samples. The power spectra of the 3 axes are
+// summed and the strongest peaks between the min and max frequency retune the notches, which filter all the axes.
+//The 3 axes are transformed in different process calls to spread the cost over the frames.
+//The notch frequencies are exported as the peak_<n> streams, 0 when a notch hasn't found its peak yet.
+class Dynamic_Notch : public IProcessor
+{
+public:
+    Dynamic_Notch(HAL& hal);
+
+    ts::Result<void> init(hal::INode_Descriptor const& descriptor) override;
+    std::shared_ptr<const hal::INode_Descriptor> get_descriptor() const override;
+
+    ts::Result<void> set_config(hal::INode_Config const& config) override;
+    std::shared_ptr<const hal::INode_Config> get_config() const override;
+
+    ts::Result<std::shared_ptr<messages::INode_Message>> send_message(messages::INode_Message const& message) override;
+
+    ts::Result<void> start(Clock::time_point tp) override;
+
+    ts::Result<void> set_input_stream_path(size_t idx, std::string const& path);
+    auto get_inputs() const -> std::vector<Input>;
+    auto get_outputs() const -> std::vector<Output>;
+
+    void process();
+
+private:
+    ts::Result<void> init();
+
+    void analyze_axis();
+    void find_peaks();
+
+    static constexpr size_t FFT_SIZE = 128;
+    static constexpr size_t HOP_SIZE = FFT_SIZE / 4;
+    static constexpr size_t BIN_COUNT = FFT_SIZE / 2 + 1;
+    static constexpr size_t AXIS_COUNT = 3;
+
+    HAL& m_hal;
+
+    std::shared_ptr<hal::Dynamic_Notch_Descriptor> m_descriptor;
+    std::shared_ptr<hal::Dynamic_Notch_Config> m_config;
+
+    Sample_Accumulator<stream::IAngular_Velocity> m_accumulator;
+
+    typedef util::dsp::Notch_Bank<float> Notch_Bank;
+    typedef util::dsp::Biquad_Traits<math::vec3f> Traits;
+    Notch_Bank m_notch_bank;
+
+    //the input history, a ring of the last FFT_SIZE samples
+    std::array<math::vec3f, FFT_SIZE> m_history;
+    size_t m_history_pos = 0;
+    size_t m_history_size = 0;
+    size_t m_samples_since_analysis = 0;
+
+    //next axis to transform, AXIS_COUNT when no analysis is in progress
+    size_t m_analysis_axis = AXIS_COUNT;
+
+    Eigen::FFT<float> m_fft;
+    std::array<float, FFT_SIZE> m_window;
+    std::array<float, FFT_SIZE> m_fft_input;
+    std::array<std::complex<float>, BIN_COUNT> m_fft_output;
+    std::array<float, BIN_COUNT> m_power;
+
+    std::array<float, Notch_Bank::MAX_NOTCHES> m_frequencies;
+
+    typedef Basic_Output_Stream<stream::IAngular_Velocity> Output_Stream;
+    mutable std::shared_ptr<Output_Stream> m_output_stream;
+
+    typedef Basic_Output_Stream<stream::IFloat> Peak_Stream;
+    mutable std::vector<std::shared_ptr<Peak_Stream>> m_peak_streams;
+};
+
+
+
+}
+}
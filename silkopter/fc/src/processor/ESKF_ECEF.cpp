@@ -0,0 +1,199 @@
+#include "FCStdAfx.h"
+#include "ESKF_ECEF.h"
+
+#include "hal.def.h"
+
+namespace silk
+{
+namespace node
+{
+
+//a GPS fix further than this from the estimate restarts the filter
+static constexpr double GPS_RESET_DISTANCE = 20.0;
+
+//true if the sample is a new measurement and not the previous one repeated by a resampler
+template<class Sample>
+static bool is_new_measurement(Sample const& sample, Sample& last_sample)
+{
+    bool is_new = sample.capture_tp != 0 ? sample.capture_tp != last_sample.capture_tp : !(sample.value == last_sample.value);
+    last_sample = sample;
+    return is_new;
+}
+
+static double pressure_to_altitude(double pressure)
+{
+    return (1.0 - std::pow((pressure / 101.325), 0.190284)) * 44307.69396;
+}
+
+ESKF_ECEF::ESKF_ECEF(HAL& hal)
+    : m_hal(hal)
+    , m_descriptor(new hal::ESKF_ECEF_Descriptor())
+    , m_config(new hal::ESKF_ECEF_Config())
+{
+    m_position_output_stream = std::make_shared<Position_Output_Stream>();
+    m_velocity_output_stream = std::make_shared<Velocity_Output_Stream>();
+    m_linear_acceleration_output_stream = std::make_shared<Linear_Acceleration_Output_Stream>();
+}
+
+ts::Result<void> ESKF_ECEF::init(hal::INode_Descriptor const& descriptor)
+{
+    QLOG_TOPIC("ESKF_ECEF::init");
+
+    auto specialized = dynamic_cast<hal::ESKF_ECEF_Descriptor const*>(&descriptor);
+    if (!specialized)
+    {
+        return make_error("Wrong descriptor type");
+    }
+    *m_descriptor = *specialized;
+
+    return init();
+}
+ts::Result<void> ESKF_ECEF::init()
+{
+    m_position_output_stream->set_rate(m_descriptor->get_rate());
+    m_velocity_output_stream->set_rate(m_descriptor->get_rate());
+    m_linear_acceleration_output_stream->set_rate(m_descriptor->get_rate());
+
+    return ts::success;
+}
+
+ts::Result<void> ESKF_ECEF::start(Clock::time_point tp)
+{
+    m_position_output_stream->set_tp(tp);
+    m_velocity_output_stream->set_tp(tp);
+    m_linear_acceleration_output_stream->set_tp(tp);
+    return ts::success;
+}
+
+auto ESKF_ECEF::get_inputs() const -> std::vector<Input>
+{
+    std::vector<Input> inputs =
+    {{
+        { stream::IECEF_Position::TYPE, m_descriptor->get_rate(), "GPS Position (ecef)", m_accumulator.get_stream_path(0) },
+        { stream::IECEF_Velocity::TYPE, m_descriptor->get_rate(), "GPS Velocity (ecef)", m_accumulator.get_stream_path(1) },
+        { stream::IENU_Linear_Acceleration::TYPE, m_descriptor->get_rate(), "Linear Acceleration (enu)", m_accumulator.get_stream_path(2) },
+        { stream::IPressure::TYPE, m_descriptor->get_rate(), "Pressure", m_accumulator.get_stream_path(3) },
+    }};
+    return inputs;
+}
+auto ESKF_ECEF::get_outputs() const -> std::vector<Output>
+{
+    std::vector<Output> outputs =
+    {{
+        { "position", m_position_output_stream },
+        { "velocity", m_velocity_output_stream },
+        { "linear_acceleration", m_linear_acceleration_output_stream },
+    }};
+    return outputs;
+}
+
+void ESKF_ECEF::process()
+{
+    QLOG_TOPIC("ESKF_ECEF::process");
+
+    m_position_output_stream->clear();
+    m_velocity_output_stream->clear();
+    m_linear_acceleration_output_stream->clear();
+
+    m_accumulator.process([this](stream::IECEF_Position::Sample const& gps_pos_sample,
+                                  stream::IECEF_Velocity::Sample const& gps_vel_sample,
+                                  stream::IENU_Linear_Acceleration::Sample const& la_sample,
+                                  stream::IPressure::Sample const& pressure_sample)
+    {
+        bool is_gps_healthy = gps_pos_sample.is_healthy & gps_vel_sample.is_healthy;
+        bool is_new_gps = is_new_measurement(gps_pos_sample, m_last_gps_position_sample) & is_gps_healthy;
+        bool is_new_pressure = is_new_measurement(pressure_sample, m_last_pressure_sample) & pressure_sample.is_healthy;
+
+        if (is_new_gps &&
+                (!m_filter.is_initialized() ||
+                 math::distance_sq(gps_pos_sample.value, m_filter.get_position()) > math::square(GPS_RESET_DISTANCE)))
+        {
+            if (!pressure_sample.is_healthy)
+            {
+                is_new_gps = false; //wait for the baro to start
+            }
+            else
+            {
+                m_filter.reset(gps_pos_sample.value, math::vec3d(gps_vel_sample.value), pressure_to_altitude(pressure_sample.value));
+                is_new_gps = false;
+                is_new_pressure = false;
+            }
+        }
+
+        if (!m_filter.is_initialized())
+        {
+            m_position_output_stream->push_last_sample(false);
+            m_velocity_output_stream->push_last_sample(false);
+            m_linear_acceleration_output_stream->push_last_sample(false);
+            return;
+        }
+
+        //without acceleration the prediction continues with the last one
+        if (la_sample.is_healthy)
+        {
+            m_last_linear_acceleration = math::vec3d(la_sample.value);
+        }
+        m_filter.predict(m_last_linear_acceleration);
+
+        if (is_new_gps)
+        {
+            m_filter.fuse_gps(gps_pos_sample.value, math::vec3d(gps_vel_sample.value));
+        }
+        if (is_new_pressure)
+        {
+            m_filter.fuse_baro(pressure_to_altitude(pressure_sample.value));
+        }
+
+        bool is_healthy = la_sample.is_healthy;
+        m_position_output_stream->push_sample(m_filter.get_position(), is_healthy);
+        m_velocity_output_stream->push_sample(math::vec3f(m_filter.get_velocity()), is_healthy);
+        m_linear_acceleration_output_stream->push_sample(math::vec3f(m_filter.get_linear_acceleration()), is_healthy);
+    });
+}
+
+ts::Result<void> ESKF_ECEF::set_input_stream_path(size_t idx, std::string const& path)
+{
+    return m_accumulator.set_stream_path(idx, path, m_descriptor->get_rate(), m_hal);
+}
+
+ts::Result<void> ESKF_ECEF::set_config(hal::INode_Config const& config)
+{
+    QLOG_TOPIC("ESKF_ECEF::set_config");
+
+    auto specialized = dynamic_cast<hal::ESKF_ECEF_Config const*>(&config);
+    if (!specialized)
+    {
+        return make_error("Wrong config type");
+    }
+    *m_config = *specialized;
+
+    ESKF_ECEF_Filter::Params params;
+    params.acceleration_noise = m_config->get_acceleration_accuracy();
+    params.gps_position_accuracy = math::max(m_config->get_gps_position_accuracy(), 0.01f);
+    params.gps_velocity_accuracy = math::max(m_config->get_gps_velocity_accuracy(), 0.01f);
+    params.baro_accuracy = math::max(m_config->get_baro_accuracy(), 0.01f);
+    params.gps_lag = m_config->get_gps_lag();
+    params.baro_lag = m_config->get_baro_lag();
+
+    //restarts from the next GPS fix
+    m_filter.setup(std::chrono::duration<double>(m_position_output_stream->get_dt()).count(), params);
+
+    return ts::success;
+}
+auto ESKF_ECEF::get_config() const -> std::shared_ptr<const hal::INode_Config>
+{
+    return m_config;
+}
+
+auto ESKF_ECEF::get_descriptor() const -> std::shared_ptr<const hal::INode_Descriptor>
+{
+    return m_descriptor;
+}
+
+ts::Result<std::shared_ptr<messages::INode_Message>> ESKF_ECEF::send_message(messages::INode_Message const& message)
+{
+    return make_error("Unknown message");
+}
+
+}
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "common/node/IProcessor.h"
+#include "common/stream/ILinear_Acceleration.h"
+#include "common/stream/IPosition.h"
+#include "common/stream/IVelocity.h"
+#include "common/stream/IPressure.h"
+
+#include "HAL.h"
+
+#include "Sample_Accumulator.h"
+#include "Basic_Output_Stream.h"
+#include "ESKF_ECEF_Filter.h"
+
+
+namespace silk
+{
+namespace hal
+{
+struct ESKF_ECEF_Descriptor;
+struct ESKF_ECEF_Config;
+}
+}
+
+
+namespace silk
+{
+namespace node
+{
+
+//Fuses the GPS position and velocity, the baro and the linear acceleration in one error state kalman filter.
+//The acceleration drives the prediction every sample, the GPS and baro are fused only when they bring a new
+// measurement - a new capture time, as their streams are resampled to the node rate.
+class ESKF_ECEF : public IProcessor
+{
+public:
+    ESKF_ECEF(HAL& hal);
+
+    ts::Result<void> init(hal::INode_Descriptor const& descriptor) override;
+    std::shared_ptr<const hal::INode_Descriptor> get_descriptor() const override;
+
+    ts::Result<void> set_config(hal::INode_Config const& config) override;
+    std::shared_ptr<const hal::INode_Config> get_config() const override;
+
+    ts::Result<std::shared_ptr<messages::INode_Message>> send_message(messages::INode_Message const& message) override;
+
+    ts::Result<void> start(Clock::time_point tp) override;
+
+    ts::Result<void> set_input_stream_path(size_t idx, std::string const& path);
+    auto get_inputs() const -> std::vector<Input>;
+    auto get_outputs() const -> std::vector<Output>;
+
+    void process();
+
+private:
+    ts::Result<void> init();
+
+    HAL& m_hal;
+
+    std::shared_ptr<hal::ESKF_ECEF_Descriptor> m_descriptor;
+    std::shared_ptr<hal::ESKF_ECEF_Config> m_config;
+
+    Sample_Accumulator<stream::IECEF_Position,
+                       stream::IECEF_Velocity,
+                       stream::IENU_Linear_Acceleration,
+                       stream::IPressure> m_accumulator;
+
+    ESKF_ECEF_Filter m_filter;
+
+    stream::IECEF_Position::Sample m_last_gps_position_sample;
+    stream::IPressure::Sample m_last_pressure_sample;
+    math::vec3d m_last_linear_acceleration;
+
+    typedef Basic_Output_Stream<stream::IECEF_Position> Position_Output_Stream;
+    mutable std::shared_ptr<Position_Output_Stream> m_position_output_stream;
+
+    typedef Basic_Output_Stream<stream::IECEF_Velocity> Velocity_Output_Stream;
+    mutable std::shared_ptr<Velocity_Output_Stream> m_velocity_output_stream;
+
+    typedef Basic_Output_Stream<stream::IECEF_Linear_Acceleration> Linear_Acceleration_Output_Stream;
+    mutable std::shared_ptr<Linear_Acceleration_Output_Stream> m_linear_acceleration_output_stream;
+};
+
+
+
+}
+}
@@ -0,0 +1,260 @@
+#pragma once
+
+#include <vector>
+
+#include "qmath.h"
+#include "utils/Coordinates.h"
+
+#include "Eigen/Core"
+
+namespace silk
+{
+namespace node
+{
+
+//Error state kalman filter of the ECEF position and velocity, driven by the ENU linear acceleration and corrected by
+// the GPS position and velocity and the baro altitude.
+//The nominal state (position, velocity, acceleration bias, baro bias) is integrated directly, the filter only tracks
+// the covariance of its error. Measurements are fused one component at a time so there is no matrix to invert, and
+// the corrections are injected in the nominal state right away.
+//The GPS and baro measure the past: the innovations are computed against the nominal state of lag seconds ago, kept
+// in a ring, and the correction is applied to the current state and to the ring.
+//All the matrices have a fixed size, setup is the only call that allocates.
+class ESKF_ECEF_Filter
+{
+public:
+    //error state layout
+    static constexpr size_t POSITION = 0;
+    static constexpr size_t VELOCITY = 3;
+    static constexpr size_t ACCELERATION_BIAS = 6; //ENU
+    static constexpr size_t BARO_BIAS = 9;
+    static constexpr size_t STATE_SIZE = 10;
+
+    //not aligned, the filter lives in nodes allocated with the default operator new
+    typedef Eigen::Matrix<double, STATE_SIZE, STATE_SIZE, Eigen::DontAlign> Covariance;
+    typedef Eigen::Matrix<double, STATE_SIZE, 1> Error_State;
+
+    struct Params
+    {
+        double acceleration_noise = 2.0; //m/s^2
+        double acceleration_bias_noise = 0.01; //m/s^2 per sqrt(s)
+        double baro_bias_noise = 0.05; //m per sqrt(s)
+        double gps_position_accuracy = 2.0; //m
+        double gps_velocity_accuracy = 0.2; //m/s
+        double baro_accuracy = 0.5; //m
+        double gps_lag = 0.0; //s
+        double baro_lag = 0.0; //s
+    };
+
+    void setup(double dt, Params const& params)
+    {
+        m_dt = dt;
+        m_params = params;
+        m_gps_lag_steps = static_cast<size_t>(math::round(params.gps_lag / dt));
+        m_baro_lag_steps = static_cast<size_t>(math::round(params.baro_lag / dt));
+        m_history.resize(math::max(m_gps_lag_steps, m_baro_lag_steps) + 1);
+        m_is_initialized = false;
+    }
+
+    bool is_initialized() const
+    {
+        return m_is_initialized;
+    }
+
+    //starts from a GPS fix
+    void reset(util::coordinates::ECEF const& position, math::vec3d const& velocity, double baro_altitude)
+    {
+        QASSERT(!m_history.empty()); //setup first
+        m_position = position;
+        m_velocity = velocity;
+        m_acceleration_bias = math::vec3d::zero;
+        set_reference(position);
+        m_baro_bias = baro_altitude - m_reference_altitude;
+
+        m_P.setZero();
+        m_P.diagonal().segment<3>(POSITION).setConstant(math::square(m_params.gps_position_accuracy));
+        m_P.diagonal().segment<3>(VELOCITY).setConstant(math::square(m_params.gps_velocity_accuracy));
+        m_P.diagonal().segment<3>(ACCELERATION_BIAS).setConstant(math::square(0.5));
+        m_P(BARO_BIAS, BARO_BIAS) = math::square(m_params.baro_accuracy);
+
+        for (History_Entry& entry: m_history)
+        {
+            entry.position = m_position;
+            entry.velocity = m_velocity;
+        }
+        m_history_pos = 0;
+        m_is_initialized = true;
+    }
+
+    void predict(math::vec3d const& enu_linear_acceleration)
+    {
+        QASSERT(m_is_initialized);
+        double dt = m_dt;
+
+        m_linear_acceleration = math::transform(m_enu_to_ecef, enu_linear_acceleration - m_acceleration_bias);
+        m_position += m_velocity * dt + m_linear_acceleration * (0.5 * dt * dt);
+        m_velocity += m_linear_acceleration * dt;
+
+        //P = F * P * F^t + Q with F = I except dp/dv = I*dt and dv/dba = -R*dt, done as row and column operations
+        Eigen::Matrix3d Rdt;
+        for (uint8_t r = 0; r < 3; r++)
+        {
+            for (uint8_t c = 0; c < 3; c++)
+            {
+                Rdt(r, c) = m_enu_to_ecef(c, r) * dt;
+            }
+        }
+        m_P.block<3, STATE_SIZE>(POSITION, 0) += dt * m_P.block<3, STATE_SIZE>(VELOCITY, 0);
+        m_P.block<3, STATE_SIZE>(VELOCITY, 0).noalias() -= Rdt * m_P.block<3, STATE_SIZE>(ACCELERATION_BIAS, 0);
+        m_P.block<STATE_SIZE, 3>(0, POSITION) += dt * m_P.block<STATE_SIZE, 3>(0, VELOCITY);
+        m_P.block<STATE_SIZE, 3>(0, VELOCITY).noalias() -= m_P.block<STATE_SIZE, 3>(0, ACCELERATION_BIAS) * Rdt.transpose();
+
+        double acceleration_variance = math::square(m_params.acceleration_noise);
+        double position_noise = 0.25 * acceleration_variance * dt * dt * dt * dt;
+        double velocity_noise = acceleration_variance * dt * dt;
+        for (size_t i = 0; i < 3; i++)
+        {
+            m_P(POSITION + i, POSITION + i) += position_noise;
+            m_P(VELOCITY + i, VELOCITY + i) += velocity_noise;
+            m_P(ACCELERATION_BIAS + i, ACCELERATION_BIAS + i) += math::square(m_params.acceleration_bias_noise) * dt;
+        }
+        m_P(BARO_BIAS, BARO_BIAS) += math::square(m_params.baro_bias_noise) * dt;
+
+        m_history_pos = (m_history_pos + 1) % m_history.size();
+        m_history[m_history_pos].position = m_position;
+        m_history[m_history_pos].velocity = m_velocity;
+    }
+
+    //a GPS fix taken gps_lag seconds ago
+    void fuse_gps(util::coordinates::ECEF const& position, math::vec3d const& velocity)
+    {
+        QASSERT(m_is_initialized);
+        History_Entry const& past = get_history(m_gps_lag_steps);
+
+        Error_State dx = Error_State::Zero();
+        double position_variance = math::square(m_params.gps_position_accuracy);
+        double velocity_variance = math::square(m_params.gps_velocity_accuracy);
+        for (uint8_t i = 0; i < 3; i++)
+        {
+            fuse_component(POSITION + i, position[i] - past.position[i], position_variance, dx);
+        }
+        for (uint8_t i = 0; i < 3; i++)
+        {
+            fuse_component(VELOCITY + i, velocity[i] - past.velocity[i], velocity_variance, dx);
+        }
+        inject(dx);
+
+        //the local vertical follows the position
+        set_reference(m_position);
+    }
+
+    //a baro altitude measured baro_lag seconds ago, relative to any reference - the baro bias absorbs it
+    void fuse_baro(double altitude)
+    {
+        QASSERT(m_is_initialized);
+        History_Entry const& past = get_history(m_baro_lag_steps);
+
+        //altitude = reference altitude + up . (position - reference position) + bias
+        Error_State h = Error_State::Zero();
+        h.segment<3>(POSITION) << m_up.x, m_up.y, m_up.z;
+        h(BARO_BIAS) = 1.0;
+
+        double predicted = m_reference_altitude + math::dot(m_up, past.position - m_reference_position) + m_baro_bias;
+
+        Error_State dx = Error_State::Zero();
+        fuse(h, altitude - predicted, math::square(m_params.baro_accuracy), dx);
+        inject(dx);
+    }
+
+    auto get_position() const -> util::coordinates::ECEF const& { return m_position; }
+    auto get_velocity() const -> math::vec3d const& { return m_velocity; }
+    auto get_linear_acceleration() const -> math::vec3d const& { return m_linear_acceleration; } //ECEF, without the bias
+    auto get_covariance() const -> Covariance const& { return m_P; }
+
+private:
+    struct History_Entry
+    {
+        util::coordinates::ECEF position;
+        math::vec3d velocity;
+    };
+
+    auto get_history(size_t lag_steps) const -> History_Entry const&
+    {
+        return m_history[(m_history_pos + m_history.size() - lag_steps) % m_history.size()];
+    }
+
+    void set_reference(util::coordinates::ECEF const& position)
+    {
+        util::coordinates::LLA lla = util::coordinates::ecef_to_lla(position);
+        m_enu_to_ecef = util::coordinates::enu_to_ecef_rotation(lla);
+        m_up = math::transform(m_enu_to_ecef, math::vec3d(0, 0, 1));
+        m_reference_position = position;
+        m_reference_altitude = lla.altitude;
+    }
+
+    //sequential update of one measurement: innovation is the measurement minus the prediction without dx,
+    // dx accumulates the corrections of the measurements fused before
+    void fuse(Error_State const& h, double innovation, double variance, Error_State& dx)
+    {
+        Error_State PHt = m_P * h;
+        double S = h.dot(PHt) + variance;
+        Error_State K = PHt / S;
+        dx += K * (innovation - h.dot(dx));
+        m_P.noalias() -= K * PHt.transpose();
+    }
+    //same, for a measurement of a single state element
+    void fuse_component(size_t idx, double innovation, double variance, Error_State& dx)
+    {
+        Error_State PHt = m_P.col(idx);
+        double S = PHt(idx) + variance;
+        Error_State K = PHt / S;
+        dx += K * (innovation - dx(idx));
+        m_P.noalias() -= K * PHt.transpose();
+    }
+
+    void inject(Error_State const& dx)
+    {
+        math::vec3d dp(dx(POSITION), dx(POSITION + 1), dx(POSITION + 2));
+        math::vec3d dv(dx(VELOCITY), dx(VELOCITY + 1), dx(VELOCITY + 2));
+        m_position += dp;
+        m_velocity += dv;
+        m_acceleration_bias += math::vec3d(dx(ACCELERATION_BIAS), dx(ACCELERATION_BIAS + 1), dx(ACCELERATION_BIAS + 2));
+        m_baro_bias += dx(BARO_BIAS);
+
+        //the past states are corrected as well so the next delayed measurement doesn't apply the correction again
+        for (History_Entry& entry: m_history)
+        {
+            entry.position += dp;
+            entry.velocity += dv;
+        }
+
+        //keep it symmetric against the rounding of the sequential updates
+        m_P = 0.5 * (m_P + m_P.transpose()).eval();
+    }
+
+    double m_dt = 0;
+    Params m_params;
+    bool m_is_initialized = false;
+
+    util::coordinates::ECEF m_position;
+    math::vec3d m_velocity;
+    math::vec3d m_acceleration_bias;
+    double m_baro_bias = 0;
+    math::vec3d m_linear_acceleration;
+
+    Covariance m_P = Covariance::Identity();
+
+    //the ENU frame at the last GPS fix
+    math::mat3d m_enu_to_ecef;
+    math::vec3d m_up;
+    util::coordinates::ECEF m_reference_position;
+    double m_reference_altitude = 0;
+
+    std::vector<History_Entry> m_history;
+    size_t m_history_pos = 0;
+    size_t m_gps_lag_steps = 0;
+    size_t m_baro_lag_steps = 0;
+};
+
+}
+}
@@ -0,0 +1,242 @@
+#pragma once
+
+#include <deque>
+
+#include "qmath.h"
+#include "utils/Coordinates.h"
+
+#include "Eigen/Core"
+#include "Eigen/LU"
+
+namespace silk
+{
+namespace node
+{
+
+//The filter of the KF_ECEF node: an independent kalman filter per ECEF axis with the position, velocity and
+// acceleration as state, measured by the GPS position and velocity and the linear acceleration.
+//Each measurement is delayed by its own lag so they all describe the same moment. The delayers are deques so
+// changing the lags allocates.
+class KF_ECEF_Filter
+{
+public:
+    template<size_t St, size_t Me>
+    class KF
+    {
+    public:
+        KF()
+        {
+            A.setIdentity();
+            x.setZero();
+
+            B.setIdentity();
+            u.setZero();
+
+            H.setIdentity();
+            z.setZero();
+
+            //error
+            P.setIdentity();
+            Q.setIdentity();
+
+            K.setIdentity();
+            R.setIdentity();
+
+            I.setIdentity();
+        }
+
+        //state
+        Eigen::Matrix<double, St, St> A; //State transition matrix.
+        typedef Eigen::Matrix<double, St, 1> State_Vector;
+        State_Vector x; //State estimate
+
+        //input
+        Eigen::Matrix<double, St, St> B; //Control matrix. This is used to define linear equations for any control factors.
+        typedef Eigen::Matrix<double, St, 1> Input_Vector;
+        Input_Vector u;
+
+        Eigen::Matrix<double, Me, St> H; //Observation matrix. Multiply a state vector by H to translate it to a measurement vector.
+
+        typedef Eigen::Matrix<double, Me, 1> Measurement_Vector;
+        Measurement_Vector z; //measurement data
+
+        //error
+        Eigen::Matrix<double, St, St> P; //state error
+        Eigen::Matrix<double, St, St> Q; //estimated process error covariance
+
+        Eigen::Matrix<double, St, Me> K; //kalman gain
+        Eigen::Matrix<double, Me, Me> R; //measurement error covariance
+
+        Eigen::Matrix<double, St, St> I; //identity
+
+        __attribute__((optimize("O3"))) void predict()
+        {
+            x = A * x + B * u; //state prediction
+            P = A * P * A.transpose() + Q; //covariance prediction
+        }
+
+        __attribute__((optimize("O3"))) void update()
+        {
+            auto HT = H.transpose();
+
+            Measurement_Vector y = z - H * x; //innovation
+
+            auto S = H * P * HT + R; //innovation covariance
+
+            K = P * HT * S.inverse(); //gain
+            x = x + K * y; // state
+            P = (I - K * H) * P; //covariance
+        }
+
+        void process()
+        {
+            predict();
+            update();
+        }
+    };
+
+    template<class Value>
+    struct Delayer
+    {
+        void init(float dt, float lag)
+        {
+            QASSERT(dt > 0.f && lag >= 0.f);
+            min_value_count = math::max(static_cast<size_t>(math::round(lag / dt)), size_t(1));
+            values.clear();
+        }
+        void push_back(Value const& value)
+        {
+            values.push_back(value);
+            while (values.size() > min_value_count)
+            {
+                values.pop_front();
+            }
+        }
+        auto get_value() -> Value const&
+        {
+            QASSERT(!values.empty());
+            return values.front();
+        }
+
+        std::deque<Value> values;
+        size_t min_value_count = 0;
+    };
+
+    struct Params
+    {
+        double gps_position_accuracy = 1.0; //m
+        double gps_velocity_accuracy = 1.0; //m/s
+        double acceleration_accuracy = 1.0; //m/s^2
+        float gps_position_lag = 0.f; //s
+        float gps_velocity_lag = 0.f; //s
+        float acceleration_lag = 0.f; //s
+    };
+
+    //keeps the state, so the params can change in flight
+    void setup(float dt, Params const& params)
+    {
+        double dtd = dt;
+
+        m_kf_x.A << 1,      dtd,    0.5*dtd*dtd,
+                    0,      1,      dtd,
+                    0,      0,      1;
+
+        m_kf_x.H << 1,      0,      0,
+                    0,      1,      0,
+                    0,      0,      1;
+
+        double pn = 0.01;
+        double dt4 = dtd*dtd*dtd*dtd;
+        double dt3 = dtd*dtd*dtd;
+        double dt2 = dtd*dtd;
+        m_kf_x.Q << pn*0.25*dt4,    pn*0.5*dt3, pn*0.5*dt2,
+                    pn*0.5*dt3,     pn*dt2,     pn*dtd,
+                    pn*0.5*dt2,     pn*dtd,     pn*1.0;
+
+        m_kf_x.R << math::square(params.gps_position_accuracy),  0,                                          0,
+                    0,                                          math::square(params.gps_velocity_accuracy),  0,
+                    0,                                          0,                                          math::square(params.acceleration_accuracy);
+
+        for (KF<3, 3>* kf: { &m_kf_y, &m_kf_z })
+        {
+            kf->A = m_kf_x.A;
+            kf->H = m_kf_x.H;
+            kf->Q = m_kf_x.Q;
+            kf->R = m_kf_x.R;
+        }
+
+        m_gps_position_delayer.init(dt, params.gps_position_lag);
+        m_gps_velocity_delayer.init(dt, params.gps_velocity_lag);
+        m_linear_acceleration_delayer.init(dt, params.acceleration_lag);
+    }
+
+    void process(util::coordinates::ECEF const& gps_position, math::vec3f const& gps_velocity, math::vec3f const& enu_linear_acceleration)
+    {
+        util::coordinates::LLA lla_position = util::coordinates::ecef_to_lla(gps_position);
+        math::mat3d enu_to_ecef_rotation = util::coordinates::enu_to_ecef_rotation(lla_position);
+        math::vec3f ecef_la = math::vec3f(math::transform(enu_to_ecef_rotation, math::vec3d(enu_linear_acceleration)));
+
+        //too far from the estimate, start over from the gps
+        if (math::distance_sq(gps_position, m_position) > math::square(20))
+        {
+            m_kf_x.x.setZero();
+            m_kf_y.x.setZero();
+            m_kf_z.x.setZero();
+            m_kf_x.x(0) = gps_position.x;
+            m_kf_y.x(0) = gps_position.y;
+            m_kf_z.x(0) = gps_position.z;
+        }
+
+        {
+            m_gps_position_delayer.push_back(gps_position);
+            util::coordinates::ECEF const& pos = m_gps_position_delayer.get_value();
+            m_kf_x.z(0) = pos.x;
+            m_kf_y.z(0) = pos.y;
+            m_kf_z.z(0) = pos.z;
+        }
+
+        {
+            m_gps_velocity_delayer.push_back(gps_velocity);
+            math::vec3f const& vel = m_gps_velocity_delayer.get_value();
+            m_kf_x.z(1) = vel.x;
+            m_kf_y.z(1) = vel.y;
+            m_kf_z.z(1) = vel.z;
+        }
+
+        {
+            m_linear_acceleration_delayer.push_back(ecef_la);
+            math::vec3f const& acc = m_linear_acceleration_delayer.get_value();
+            m_kf_x.z(2) = acc.x;
+            m_kf_y.z(2) = acc.y;
+            m_kf_z.z(2) = acc.z;
+        }
+
+        m_kf_x.process();
+        m_kf_y.process();
+        m_kf_z.process();
+
+        m_position = util::coordinates::ECEF(m_kf_x.x(0), m_kf_y.x(0), m_kf_z.x(0));
+        m_velocity = math::vec3f(m_kf_x.x(1), m_kf_y.x(1), m_kf_z.x(1));
+        m_linear_acceleration = math::vec3f(m_kf_x.x(2), m_kf_y.x(2), m_kf_z.x(2));
+    }
+
+    auto get_position() const -> util::coordinates::ECEF const& { return m_position; }
+    auto get_velocity() const -> math::vec3f const& { return m_velocity; } //ECEF
+    auto get_linear_acceleration() const -> math::vec3f const& { return m_linear_acceleration; } //ECEF
+
+private:
+    KF<3, 3> m_kf_x;
+    KF<3, 3> m_kf_y;
+    KF<3, 3> m_kf_z;
+
+    Delayer<util::coordinates::ECEF> m_gps_position_delayer;
+    Delayer<math::vec3f> m_gps_velocity_delayer;
+    Delayer<math::vec3f> m_linear_acceleration_delayer;
+
+    util::coordinates::ECEF m_position;
+    math::vec3f m_velocity;
+    math::vec3f m_linear_acceleration;
+};
+
+}
+}
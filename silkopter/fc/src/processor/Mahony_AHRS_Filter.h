@@ -0,0 +1,120 @@
+#pragma once
+
+#include "qmath.h"
+
+namespace silk
+{
+namespace node
+{
+
+//Mahony attitude filter: the gyro is integrated in quaternion form and corrected towards the accelerometer and
+// magnetometer with a proportional-integral feedback on the angular velocity. The integral term is the gyro bias.
+//The accelerometer correction costs a cross product per sample - the gravity direction comes straight from the
+// quaternion. The magnetometer only corrects the heading (the error is projected on the up axis so a disturbed
+// field doesn't tilt the frame) and is fused once every magnetic_field_decimation samples.
+//The rotation is from the local frame to the world (ENU) frame, like the Comp_AHRS output.
+class Mahony_AHRS_Filter
+{
+public:
+    struct Params
+    {
+        float proportional_gain = 1.f;
+        float integral_gain = 0.05f;
+        float max_gyro_bias = 0.2f; //rad/s
+        size_t magnetic_field_decimation = 20;
+    };
+
+    void setup(float dt, Params const& params)
+    {
+        m_dt = dt;
+        m_params = params;
+        m_params.magnetic_field_decimation = math::max(params.magnetic_field_decimation, size_t(1));
+    }
+
+    //starts from a known rotation, with no bias
+    void reset(math::quatf const& rotation)
+    {
+        m_rotation = math::normalized<float, math::safe>(rotation);
+        m_gyro_bias = math::vec3f::zero;
+        m_magnetic_field_counter = 0;
+    }
+
+    //a non healthy sensor is passed as a zero vector
+    void process(math::vec3f const& angular_velocity, math::vec3f const& acceleration, math::vec3f const& magnetic_field)
+    {
+        math::quatf& q = m_rotation;
+
+        //the world up axis in the local frame - the last row of the rotation matrix
+        math::vec3f up(2.f * (q.x * q.z - q.w * q.y),
+                       2.f * (q.y * q.z + q.w * q.x),
+                       1.f - 2.f * (q.x * q.x + q.y * q.y));
+
+        math::vec3f error;
+        float acceleration_length_sq = math::length_sq(acceleration);
+        if (acceleration_length_sq > math::epsilon<float>())
+        {
+            //acceleration points opposite of gravity - so up
+            error = math::cross(acceleration, up) * (1.f / std::sqrt(acceleration_length_sq));
+        }
+
+        //the magnetometer error covers all the samples since the last fusion
+        if (++m_magnetic_field_counter >= m_params.magnetic_field_decimation)
+        {
+            m_magnetic_field_counter = 0;
+            float magnetic_field_length_sq = math::length_sq(magnetic_field);
+            if (magnetic_field_length_sq > math::epsilon<float>())
+            {
+                //the measured field in the world frame, rotated in the north-up plane and back in the local frame
+                math::vec3f mf = magnetic_field * (1.f / std::sqrt(magnetic_field_length_sq));
+                math::vec3f h = math::rotate(q, mf);
+                math::vec3f expected = math::rotate(math::quatf(-q.x, -q.y, -q.z, q.w), math::vec3f(0, std::sqrt(h.x * h.x + h.y * h.y), h.z));
+                math::vec3f mf_error = math::cross(mf, expected);
+                error += up * (math::dot(mf_error, up) * m_params.magnetic_field_decimation);
+            }
+        }
+
+        if (m_params.integral_gain > 0)
+        {
+            m_gyro_bias -= error * (m_params.integral_gain * m_dt);
+            float bias_length_sq = math::length_sq(m_gyro_bias);
+            if (bias_length_sq > math::square(m_params.max_gyro_bias))
+            {
+                m_gyro_bias *= m_params.max_gyro_bias / std::sqrt(bias_length_sq);
+            }
+        }
+
+        //q += q * (0, omega) * dt/2
+        math::vec3f av = (angular_velocity - m_gyro_bias + error * m_params.proportional_gain) * (0.5f * m_dt);
+        float w = - (av.x * q.x) - (av.y * q.y) - (av.z * q.z);
+        float x = (av.x * q.w) + (av.z * q.y) - (av.y * q.z);
+        float y = (av.y * q.w) + (av.x * q.z) - (av.z * q.x);
+        float z = (av.z * q.w) + (av.y * q.x) - (av.x * q.y);
+        q.x += x;
+        q.y += y;
+        q.z += z;
+        q.w += w;
+
+        //the length drifts from 1 by dt^2 per sample so one newton step of 1/sqrt around 1 is enough and keeps
+        // the sqrt and the division out of the dependency chain between samples
+        float length_sq = q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w;
+        float inv_length = 1.5f - 0.5f * length_sq;
+        q.x *= inv_length;
+        q.y *= inv_length;
+        q.z *= inv_length;
+        q.w *= inv_length;
+    }
+
+    auto get_rotation() const -> math::quatf const& { return m_rotation; }
+    auto get_gyro_bias() const -> math::vec3f const& { return m_gyro_bias; }
+
+private:
+    float m_dt = 0;
+    Params m_params;
+
+    math::quatf m_rotation;
+    math::vec3f m_gyro_bias;
+    size_t m_magnetic_field_counter = 0;
+};
+
+}
+}
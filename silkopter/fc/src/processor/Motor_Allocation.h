@@ -0,0 +1,150 @@
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include "qmath.h"
+#include "uav_properties/IMultirotor_Properties.h"
+
+#include "Eigen/Core"
+#include "Eigen/SVD"
+
+namespace silk
+{
+namespace node
+{
+
+//Closed form motor mixer: the allocation matrix (motor thrusts -> roll, pitch, yaw torque and collective thrust) is
+// inverted once in setup, with a pseudo inverse so any motor count and layout works.
+//solve does a fixed number of passes over the motors, in priority order:
+// 1. roll and pitch - scaled down if they need more than the whole thrust range
+// 2. yaw - scaled down to what's left of the range
+// 3. the collective thrust - moved so no motor leaves the range
+//so a saturated mixer keeps the attitude and gives up the yaw and then the altitude. The worst case costs
+// motor_count^2 multiply-adds.
+//Nothing is allocated, not even in setup - the matrices have a fixed max size so the mixer can redo the setup in
+// process() when the properties change.
+class Motor_Allocation
+{
+public:
+    static constexpr size_t MAX_MOTORS = 16;
+
+    typedef Eigen::Matrix<float, 4, Eigen::Dynamic, 0, 4, MAX_MOTORS> Allocation_Matrix;
+
+    //the collective thrust is the sum of the motor thrusts
+    bool setup(std::vector<IMultirotor_Properties::Motor> const& motors, float motor_thrust, float motor_z_torque)
+    {
+        size_t motor_count = motors.size();
+        if (motor_count == 0 || motor_count > MAX_MOTORS || motor_thrust < math::epsilon<float>())
+        {
+            return false;
+        }
+
+        //torque and thrust per newton of motor thrust
+        Allocation_Matrix allocation(4, motor_count);
+        for (size_t i = 0; i < motor_count; i++)
+        {
+            IMultirotor_Properties::Motor const& mc = motors[i];
+            math::vec3f torque = math::cross(mc.position, mc.thrust_vector);
+            torque += mc.thrust_vector * (motor_z_torque / motor_thrust * (mc.clockwise ? 1 : -1));
+            allocation.col(i) << torque.x, torque.y, torque.z, 1.f;
+        }
+
+        Eigen::JacobiSVD<Allocation_Matrix> svd(allocation, Eigen::ComputeThinU | Eigen::ComputeThinV);
+        Eigen::JacobiSVD<Allocation_Matrix>::SingularValuesType const& singular_values = svd.singularValues();
+        float threshold = singular_values(0) * 1e-4f;
+        Eigen::JacobiSVD<Allocation_Matrix>::SingularValuesType inv_singular_values(singular_values.size());
+        for (int i = 0; i < singular_values.size(); i++)
+        {
+            inv_singular_values(i) = singular_values(i) > threshold ? 1.f / singular_values(i) : 0.f;
+        }
+        Eigen::Matrix<float, Eigen::Dynamic, 4, 0, MAX_MOTORS, 4> pseudo_inverse = svd.matrixV() * inv_singular_values.asDiagonal() * svd.matrixU().transpose();
+
+        //the torque columns don't change the collective thrust, the thrust is handled as a uniform offset in solve
+        m_motor_count = motor_count;
+        for (size_t i = 0; i < motor_count; i++)
+        {
+            m_roll[i] = pseudo_inverse(i, 0);
+            m_pitch[i] = pseudo_inverse(i, 1);
+            m_yaw[i] = pseudo_inverse(i, 2);
+        }
+        return true;
+    }
+
+    size_t get_motor_count() const
+    {
+        return m_motor_count;
+    }
+
+    //computes the thrust of every motor, all within [min_thrust, max_thrust]
+    void solve(math::vec3f const& torque, float collective_thrust, float min_thrust, float max_thrust, float* thrusts) const
+    {
+        size_t motor_count = m_motor_count;
+        float range = math::max(max_thrust - min_thrust, 0.f);
+
+        float roll_pitch[MAX_MOTORS];
+        float yaw[MAX_MOTORS];
+        float min_roll_pitch = std::numeric_limits<float>::max();
+        float max_roll_pitch = std::numeric_limits<float>::lowest();
+        for (size_t i = 0; i < motor_count; i++)
+        {
+            roll_pitch[i] = m_roll[i] * torque.x + m_pitch[i] * torque.y;
+            yaw[i] = m_yaw[i] * torque.z;
+            min_roll_pitch = math::min(min_roll_pitch, roll_pitch[i]);
+            max_roll_pitch = math::max(max_roll_pitch, roll_pitch[i]);
+        }
+
+        //roll and pitch keep their direction when scaled
+        float roll_pitch_spread = max_roll_pitch - min_roll_pitch;
+        if (roll_pitch_spread > range)
+        {
+            float scale = range / roll_pitch_spread;
+            for (size_t i = 0; i < motor_count; i++)
+            {
+                roll_pitch[i] *= scale;
+            }
+        }
+
+        //the biggest yaw scale that keeps the spread between any two motors within the range
+        float yaw_scale = 1.f;
+        for (size_t i = 0; i < motor_count; i++)
+        {
+            for (size_t j = 0; j < motor_count; j++)
+            {
+                float yaw_spread = yaw[i] - yaw[j];
+                if (yaw_spread > math::epsilon<float>())
+                {
+                    yaw_scale = math::min(yaw_scale, (range - (roll_pitch[i] - roll_pitch[j])) / yaw_spread);
+                }
+            }
+        }
+        yaw_scale = math::max(yaw_scale, 0.f);
+
+        float min_torque_thrust = std::numeric_limits<float>::max();
+        float max_torque_thrust = std::numeric_limits<float>::lowest();
+        for (size_t i = 0; i < motor_count; i++)
+        {
+            thrusts[i] = roll_pitch[i] + yaw[i] * yaw_scale;
+            min_torque_thrust = math::min(min_torque_thrust, thrusts[i]);
+            max_torque_thrust = math::max(max_torque_thrust, thrusts[i]);
+        }
+
+        //the thrust is what's left - the offset that keeps every motor in the range
+        float min_offset = min_thrust - min_torque_thrust;
+        float max_offset = math::max(max_thrust - max_torque_thrust, min_offset);
+        float offset = math::clamp(collective_thrust / static_cast<float>(motor_count), min_offset, max_offset);
+        for (size_t i = 0; i < motor_count; i++)
+        {
+            thrusts[i] = math::clamp(thrusts[i] + offset, min_thrust, max_thrust);
+        }
+    }
+
+private:
+    size_t m_motor_count = 0;
+    float m_roll[MAX_MOTORS] = {};
+    float m_pitch[MAX_MOTORS] = {};
+    float m_yaw[MAX_MOTORS] = {};
+};
+
+}
+}
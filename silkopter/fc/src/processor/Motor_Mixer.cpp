@@ -61,11 +61,18 @@ ts::Result<void> Motor_Mixer::init()
         return make_error("Motors don't produce symmetrical thrust");
     }
 
+    if (!m_allocation.setup(multirotor_properties->get_motors(), multirotor_properties->get_motor_thrust(), multirotor_properties->get_motor_z_torque()))
+    {
+        return make_error("Cannot compute the motor allocation for {} motors", multirotor_properties->get_motors().size());
+    }
+    m_allocation_properties = multirotor_properties;
+
     m_outputs.resize(multirotor_properties->get_motors().size());
     for (auto& os: m_outputs)
     {
         os = std::make_shared<Stream>();
         os->rate = m_descriptor->get_rate();
+        os->ring.set_capacity(std::max<size_t>(64, os->rate / 4));
     }
 
     //m_config->output_streams.throttles.resize(multirotor_descriptor->motors.size());
@@ -105,7 +112,7 @@ void Motor_Mixer::process()
 
     for (auto& os: m_outputs)
     {
-        os->samples.clear();
+        os->clear();
     }
 
     std::shared_ptr<const IMultirotor_Properties> multirotor_properties = m_hal.get_specialized_uav_properties<IMultirotor_Properties>();
@@ -118,6 +125,14 @@ void Motor_Mixer::process()
         QLOGE("Motor count changed since initialization!!!! Case not handled");
         return;
     }
+    if (multirotor_properties != m_allocation_properties)
+    {
+        if (!m_allocation.setup(multirotor_properties->get_motors(), multirotor_properties->get_motor_thrust(), multirotor_properties->get_motor_z_torque()))
+        {
+            QLOGE("Cannot compute the motor allocation, using the previous one");
+        }
+        m_allocation_properties = multirotor_properties;
+    }
 
     m_accumulator.process([this, &multirotor_properties](stream::ITorque::Sample const& t_sample,
                                                 stream::IFloat::Sample const& f_sample)
@@ -125,16 +140,25 @@ void Motor_Mixer::process()
         bool is_healthy = false;
         if (t_sample.is_healthy & f_sample.is_healthy)
         {
-            compute_throttles(*multirotor_properties, f_sample.value, t_sample.value);
+            if (m_config->get_mode() == hal::Motor_Mixer_Config::mode_t::PSEUDO_INVERSE)
+            {
+                compute_throttles_pseudo_inverse(*multirotor_properties, f_sample.value, t_sample.value);
+            }
+            else
+            {
+                compute_throttles(*multirotor_properties, f_sample.value, t_sample.value);
+            }
             is_healthy = true;
         }
+        stream::Capture_Tp capture_tp = stream::get_oldest_capture_tp(t_sample.capture_tp, f_sample.capture_tp);
 
         for (size_t mi = 0; mi < m_outputs.size(); mi++)
         {
             auto& sample = m_outputs[mi]->last_sample;
             sample.value = m_outputs[mi]->throttle;
             sample.is_healthy = is_healthy;
-            m_outputs[mi]->samples.push_back(sample);
+            sample.capture_tp = capture_tp;
+            m_outputs[mi]->ring.push_back(sample);
         }
     });
 }
@@ -270,6 +294,33 @@ void Motor_Mixer::compute_throttles(IMultirotor_Properties const& multirotor_pro
     }
 
 }
+void Motor_Mixer::compute_throttles_pseudo_inverse(IMultirotor_Properties const& multirotor_properties, stream::IFloat::Value const& collective_thrust, stream::ITorque::Value const& target)
+{
+    QASSERT(m_allocation.get_motor_count() == m_outputs.size());
+
+    float motor_thrust = multirotor_properties.get_motor_thrust();
+
+    //like the iterative mixer, no collective thrust stops the motors
+    if (collective_thrust < 0.01f)
+    {
+        for (auto& out: m_outputs)
+        {
+            out->thrust = MIN_THRUST;
+            out->throttle = compute_throttle_from_thrust(motor_thrust, out->thrust);
+        }
+        return;
+    }
+
+    float thrusts[Motor_Allocation::MAX_MOTORS];
+    m_allocation.solve(target, collective_thrust, math::min(m_config->get_armed_thrust(), motor_thrust), motor_thrust, thrusts);
+
+    for (size_t i = 0; i < m_outputs.size(); i++)
+    {
+        m_outputs[i]->thrust = thrusts[i];
+        m_outputs[i]->throttle = compute_throttle_from_thrust(motor_thrust, thrusts[i]);
+    }
+}
+
 //void Motor_Mixer::compute_throttles(config::Multirotor const& multirotor_properties, stream::IFloat::Value const& collective_thrust, stream::ITorque::Value const& _target)
 //{
 ////    auto max_throttle = m_config->max_throttle;
@@ -67,6 +67,7 @@ ts::Result<void> Quad_Multirotor_Motor_Mixer::init()
     {
         os = std::make_shared<Stream>();
         os->rate = m_descriptor->get_rate();
+        os->ring.set_capacity(std::max<size_t>(64, os->rate / 4));
     }
 
     return ts::success;
@@ -109,7 +110,7 @@ void Quad_Multirotor_Motor_Mixer::process()
 
     for (std::shared_ptr<Stream>& os: m_outputs)
     {
-        os->samples.clear();
+        os->clear();
     }
 
     std::shared_ptr<const Quad_Multirotor_Properties> multirotor_properties = m_hal.get_specialized_uav_properties<Quad_Multirotor_Properties>();
@@ -131,13 +132,15 @@ void Quad_Multirotor_Motor_Mixer::process()
             compute_throttles(*multirotor_properties, f_sample.value, t_sample.value);
             is_healthy = true;
         }
+        stream::Capture_Tp capture_tp = stream::get_oldest_capture_tp(t_sample.capture_tp, f_sample.capture_tp);
 
         for (std::shared_ptr<Stream> output: m_outputs)
         {
             Stream::Sample& sample = output->last_sample;
             sample.value = output->throttle;
             sample.is_healthy = is_healthy;
-            output->samples.push_back(sample);
+            sample.capture_tp = capture_tp;
+            output->ring.push_back(sample);
         }
     });
 }
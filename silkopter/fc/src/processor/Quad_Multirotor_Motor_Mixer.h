@@ -64,14 +64,17 @@ private:
 
     Sample_Accumulator<stream::ITorque, stream::IFloat> m_accumulator;
 
-    struct Stream : public stream::IThrottle
+    struct Stream : public stream::IThrottle, public ISample_Ring_Source<stream::IThrottle::Sample>
     {
-        auto get_samples() const -> std::vector<Sample> const& { return samples; }
+        auto get_samples() const -> stream::Sample_View<Sample> { return ring.get_view(frame_begin_index); }
+        auto get_sample_ring() const -> Sample_Ring<Sample> const& override { return ring; }
         auto get_rate() const -> uint32_t { return rate; }
+        void clear() override { frame_begin_index = ring.get_end_index(); }
 
         uint32_t rate = 0;
         Sample last_sample;
-        std::vector<Sample> samples;
+        Sample_Ring<Sample> ring;
+        uint64_t frame_begin_index = 0; //the samples of the current frame
 
 //        struct Config
 //        {
@@ -3,7 +3,7 @@
 #include "HAL.h"
 #include "common/node/IResampler.h"
 #include "utils/Butterworth.h"
-#include <deque>
+#include "utils/Polyphase_FIR.h"
 
 #include "Sample_Accumulator.h"
 #include "Basic_Output_Stream.h"
@@ -42,6 +42,7 @@ public:
 private:
     ts::Result<void> init();
     void resample();
+    void resample_fir();
 
     HAL& m_hal;
 
@@ -55,7 +56,10 @@ private:
 
     typename Stream_t::Sample m_last_input_sample;
 
-    std::deque<typename Stream_t::Sample> m_input_samples;
+    //the input samples not consumed yet, from m_input_sample_pos on. Reserved in init so it doesn't allocate when
+    // the consumed ones are erased
+    std::vector<typename Stream_t::Sample> m_input_samples;
+    size_t m_input_sample_pos = 0;
 
     template<class T, bool>
     struct Butterworth
@@ -94,6 +98,53 @@ private:
 
     Butterworth<Stream_t, Stream_t::can_be_filtered_t::value> m_lpf;
 
+    template<class T, bool>
+    struct FIR
+    {
+        auto setup(uint32_t, uint32_t, float, size_t) -> bool
+        {
+            return false;
+        }
+        void reset(typename T::Value const&) {}
+        void push(typename T::Value const&) {}
+        auto get(typename T::Value&) -> bool
+        {
+            return false;
+        }
+        void skip_ready(size_t) {}
+    };
+
+    template<class T>
+    struct FIR<T, true>
+    {
+        util::dsp::Polyphase_FIR<typename T::Value> fir;
+
+        auto setup(uint32_t input_rate, uint32_t output_rate, float cutoff_frequency, size_t zero_crossings) -> bool
+        {
+            return fir.setup(input_rate, output_rate, cutoff_frequency, zero_crossings);
+        }
+        void reset(typename T::Value const& t)
+        {
+            fir.reset(t);
+        }
+        void push(typename T::Value const& t)
+        {
+            fir.push(t);
+        }
+        auto get(typename T::Value& t) -> bool
+        {
+            return fir.get(t);
+        }
+        void skip_ready(size_t max_ready)
+        {
+            fir.skip_ready(max_ready);
+        }
+    };
+
+    FIR<Stream_t, Stream_t::can_be_filtered_t::value> m_fir;
+    bool m_fir_needs_reset = true;
+    bool m_is_fir_input_healthy = false;
+
     typedef Basic_Output_Stream<Stream_t> Output_Stream;
 //    struct Stream : public Stream_t
 //    {
@@ -144,6 +195,9 @@ ts::Result<void> Resampler<Stream_t>::init()
     hal::LPF_Config& lpf_config = m_config->get_lpf();
     lpf_config.set_cutoff_frequency(max_cutoff);
 
+    //a second of input
+    m_input_samples.reserve(input_rate);
+
     return ts::success;
 }
 
@@ -184,11 +238,28 @@ ts::Result<void> Resampler<Stream_t>::set_config(hal::INode_Config const& config
         lpf_config.set_cutoff_frequency(max_cutoff);
     }
     lpf_config.set_cutoff_frequency(math::clamp(lpf_config.get_cutoff_frequency(), 0.1f, max_cutoff));
-    if (!m_lpf.setup(lpf_config.get_poles(), max_rate, lpf_config.get_cutoff_frequency()))
+    if (m_config->get_mode() == hal::Resampler_Config::mode_t::POLYPHASE_FIR)
+    {
+        if (!Stream_t::can_be_filtered_t::value)
+        {
+            return make_error("This stream cannot be filtered, use the hold mode.");
+        }
+        if (!m_fir.setup(input_rate, output_rate, lpf_config.get_cutoff_frequency(), m_config->get_fir_zero_crossings()))
+        {
+            return make_error("Cannot setup the polyphase filter for {}Hz to {}Hz, the rates need too many taps.", input_rate, output_rate);
+        }
+        m_fir_needs_reset = true;
+        m_input_samples.clear();
+        m_input_sample_pos = 0;
+    }
+    else
     {
-        return make_error("Cannot setup lpf filter.");
+        if (!m_lpf.setup(lpf_config.get_poles(), max_rate, lpf_config.get_cutoff_frequency()))
+        {
+            return make_error("Cannot setup lpf filter.");
+        }
+        m_lpf.reset();
     }
-    m_lpf.reset();
 
     return ts::success;
 }
@@ -241,13 +312,35 @@ void Resampler<Stream_t>::process()
         return;
     }
 
-    m_accumulator.process([this](typename Stream_t::Sample const& i_sample)
+    if (m_config->get_mode() == hal::Resampler_Config::mode_t::POLYPHASE_FIR)
     {
-        m_input_samples.push_back(i_sample);
-    });
+        m_accumulator.process([this](typename Stream_t::Sample const& i_sample)
+        {
+            //an unhealthy sample holds the last healthy one so the input keeps its rate
+            if (i_sample.is_healthy)
+            {
+                if (m_fir_needs_reset)
+                {
+                    m_fir_needs_reset = false;
+                    m_fir.reset(i_sample.value);
+                }
+                m_last_input_sample = i_sample;
+            }
+            m_fir.push(m_last_input_sample.value);
+            m_is_fir_input_healthy = i_sample.is_healthy;
+        });
 
+        resample_fir();
+    }
+    else
+    {
+        m_accumulator.process([this](typename Stream_t::Sample const& i_sample)
+        {
+            m_input_samples.push_back(i_sample);
+        });
 
-    resample();
+        resample();
+    }
 }
 
 template<class Stream_t>
@@ -285,17 +378,16 @@ void Resampler<Stream_t>::resample()
     {
         //consume input samples
         m_processed_dt += dt;
-        while (!m_input_samples.empty() && m_processed_dt >= m_input_stream_dt)
+        while (m_input_sample_pos < m_input_samples.size() && m_processed_dt >= m_input_stream_dt)
         {
             m_processed_dt -= m_input_stream_dt;
-            m_last_input_sample = m_input_samples.front();
+            m_last_input_sample = m_input_samples[m_input_sample_pos++];
 
             if (is_downsampling && m_last_input_sample.is_healthy)
             {
-                //upsampling, filter at the input stream sample rate
-                m_lpf.process(m_input_samples.back().value);
+                //downsampling, filter every input sample at the input stream sample rate
+                m_lpf.process(m_last_input_sample.value);
             }
-            m_input_samples.pop_front();
         }
 
         if (m_last_input_sample.is_healthy)
@@ -315,6 +407,30 @@ void Resampler<Stream_t>::resample()
         }
     }
 
+    m_input_samples.erase(m_input_samples.begin(), m_input_samples.begin() + m_input_sample_pos);
+    m_input_sample_pos = 0;
+}
+
+template<class Stream_t>
+void Resampler<Stream_t>::resample_fir()
+{
+    size_t samples_needed = m_output_stream->compute_samples_needed();
+    for (size_t i = 0; i < samples_needed; i++)
+    {
+        typename Stream_t::Value value;
+        if (m_fir.get(value))
+        {
+            m_output_stream->push_sample(value, m_is_fir_input_healthy);
+        }
+        else
+        {
+            //the input is late, hold the last output
+            m_output_stream->push_last_sample(m_is_fir_input_healthy);
+        }
+    }
+
+    //the input is early, drop the outputs that would only add delay. One is kept for the jitter between the streams
+    m_fir.skip_ready(1);
 }
 
 
@@ -154,10 +154,10 @@ void Multirotor_Simulator::process()
 
     for (size_t i = 0; i < m_input_throttle_streams.size(); i++)
     {
-        std::shared_ptr<stream::IThrottle> stream = m_input_throttle_streams[i].lock();
+        stream::IThrottle* stream = m_input_throttle_streams[i].get();
         if (stream)
         {
-            std::vector<stream::IThrottle::Sample> const& samples = stream->get_samples();
+            auto samples = stream->get_samples();
             if (!samples.empty())
             {
                 m_simulation.set_motor_throttle(i, samples.back().value);
@@ -166,10 +166,10 @@ void Multirotor_Simulator::process()
     }
 
     {
-        std::shared_ptr<stream::IMultirotor_State> stream = m_input_state_stream.lock();
+        stream::IMultirotor_State* stream = m_input_state_stream.get();
         if (stream)
         {
-            std::vector<stream::IMultirotor_State::Sample> const& samples = stream->get_samples();
+            auto samples = stream->get_samples();
             if (!samples.empty())
             {
                 m_multirotor_state = samples.back().value;
@@ -189,7 +189,10 @@ void Multirotor_Simulator::process()
     math::trans3dd enu_to_ecef_trans = util::coordinates::enu_to_ecef_transform(origin_lla);
     math::mat3d enu_to_ecef_rotation = util::coordinates::enu_to_ecef_rotation(origin_lla);
 
-    m_simulation.process(dt, [this, &enu_to_ecef_trans, &enu_to_ecef_rotation](Multirotor_Simulation& simulation, Clock::duration simulation_dt)
+    //the simulated sensors are read now, however far the simulation steps
+    stream::Capture_Tp capture_tp = stream::to_capture_tp(now);
+
+    m_simulation.process(dt, [this, &enu_to_ecef_trans, &enu_to_ecef_rotation, capture_tp](Multirotor_Simulation& simulation, Clock::duration simulation_dt)
     {
         Multirotor_Simulation::State const& uav_state = simulation.get_state();
         {
@@ -201,6 +204,7 @@ void Multirotor_Simulator::process()
                 stream.accumulated_dt -= stream.dt;
                 stream.last_sample.value = uav_state.angular_velocity + noise;
                 stream.last_sample.is_healthy = true;
+                stream.last_sample.capture_tp = capture_tp;
                 stream.samples.push_back(stream.last_sample);
             }
         }
@@ -213,6 +217,7 @@ void Multirotor_Simulator::process()
                 stream.accumulated_dt -= stream.dt;
                 stream.last_sample.value = uav_state.acceleration + noise;
                 stream.last_sample.is_healthy = true;
+                stream.last_sample.capture_tp = capture_tp;
                 stream.samples.push_back(stream.last_sample);
             }
         }
@@ -227,6 +232,7 @@ void Multirotor_Simulator::process()
                 QASSERT(!math::is_zero(uav_state.magnetic_field, math::epsilon<float>()));
                 stream.last_sample.value = uav_state.magnetic_field + noise;
                 stream.last_sample.is_healthy = true;
+                stream.last_sample.capture_tp = capture_tp;
                 stream.samples.push_back(stream.last_sample);
             }
         }
@@ -239,6 +245,7 @@ void Multirotor_Simulator::process()
                 stream.accumulated_dt -= stream.dt;
                 stream.last_sample.value = uav_state.pressure + noise;
                 stream.last_sample.is_healthy = true;
+                stream.last_sample.capture_tp = capture_tp;
                 stream.samples.push_back(stream.last_sample);
             }
         }
@@ -251,6 +258,7 @@ void Multirotor_Simulator::process()
                 stream.accumulated_dt -= stream.dt;
                 stream.last_sample.value = uav_state.temperature + noise;
                 stream.last_sample.is_healthy = true;
+                stream.last_sample.capture_tp = capture_tp;
                 stream.samples.push_back(stream.last_sample);
             }
         }
@@ -263,6 +271,7 @@ void Multirotor_Simulator::process()
                 stream.accumulated_dt -= stream.dt;
                 stream.last_sample.value = uav_state.proximity_distance + noise;
                 stream.last_sample.is_healthy = !math::is_zero(uav_state.proximity_distance, std::numeric_limits<float>::epsilon());
+                stream.last_sample.capture_tp = capture_tp;
                 stream.samples.push_back(stream.last_sample);
             }
         }
@@ -279,6 +288,7 @@ void Multirotor_Simulator::process()
                 stream.last_sample.value.pacc = m_noise.gps_pacc(m_noise.generator);
                 stream.last_sample.value.vacc = m_noise.gps_vacc(m_noise.generator);
                 stream.last_sample.is_healthy = true;
+                stream.last_sample.capture_tp = capture_tp;
                 stream.samples.push_back(stream.last_sample);
             }
         }
@@ -291,6 +301,7 @@ void Multirotor_Simulator::process()
                 stream.accumulated_dt -= stream.dt;
                 stream.last_sample.value = math::transform(enu_to_ecef_trans, math::vec3d(uav_state.enu_position)) + noise;
                 stream.last_sample.is_healthy = true;
+                stream.last_sample.capture_tp = capture_tp;
                 stream.samples.push_back(stream.last_sample);
             }
         }
@@ -303,6 +314,7 @@ void Multirotor_Simulator::process()
                 stream.accumulated_dt -= stream.dt;
                 stream.last_sample.value = math::vec3f(math::transform(enu_to_ecef_rotation, math::vec3d(uav_state.enu_velocity))) + noise;
                 stream.last_sample.is_healthy = true;
+                stream.last_sample.capture_tp = capture_tp;
                 stream.samples.push_back(stream.last_sample);
             }
         }
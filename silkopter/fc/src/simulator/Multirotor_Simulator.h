@@ -82,8 +82,9 @@ private:
 
     struct Angular_Velocity : public stream::IAngular_Velocity
     {
-        std::vector<Sample> const& get_samples() const { return samples; }
+        auto get_samples() const -> stream::Sample_View<Sample> { return stream::Sample_View<Sample>(samples); }
         uint32_t get_rate() const { return rate; }
+        void clear() override { samples.clear(); }
         uint32_t rate = 0;
         Clock::duration accumulated_dt = Clock::duration{0};
         Clock::duration dt = Clock::duration{0};
@@ -92,8 +93,9 @@ private:
     };
     struct Acceleration : public stream::IAcceleration
     {
-        std::vector<Sample> const& get_samples() const { return samples; }
+        auto get_samples() const -> stream::Sample_View<Sample> { return stream::Sample_View<Sample>(samples); }
         uint32_t get_rate() const { return rate; }
+        void clear() override { samples.clear(); }
         uint32_t rate = 0;
         Clock::duration accumulated_dt = Clock::duration{0};
         Clock::duration dt = Clock::duration{0};
@@ -102,8 +104,9 @@ private:
     };
     struct Magnetic_Field : public stream::IMagnetic_Field
     {
-        std::vector<Sample> const& get_samples() const { return samples; }
+        auto get_samples() const -> stream::Sample_View<Sample> { return stream::Sample_View<Sample>(samples); }
         uint32_t get_rate() const { return rate; }
+        void clear() override { samples.clear(); }
         uint32_t rate = 0;
         Clock::duration accumulated_dt = Clock::duration{0};
         Clock::duration dt = Clock::duration{0};
@@ -112,8 +115,9 @@ private:
     };
     struct Pressure : public stream::IPressure
     {
-        std::vector<Sample> const& get_samples() const { return samples; }
+        auto get_samples() const -> stream::Sample_View<Sample> { return stream::Sample_View<Sample>(samples); }
         uint32_t get_rate() const { return rate; }
+        void clear() override { samples.clear(); }
         uint32_t rate = 0;
         Clock::duration accumulated_dt = Clock::duration{0};
         Clock::duration dt = Clock::duration{0};
@@ -122,8 +126,9 @@ private:
     };
     struct Temperature : public stream::ITemperature
     {
-        std::vector<Sample> const& get_samples() const { return samples; }
+        auto get_samples() const -> stream::Sample_View<Sample> { return stream::Sample_View<Sample>(samples); }
         uint32_t get_rate() const { return rate; }
+        void clear() override { samples.clear(); }
         uint32_t rate = 0;
         Clock::duration accumulated_dt = Clock::duration{0};
         Clock::duration dt = Clock::duration{0};
@@ -132,8 +137,9 @@ private:
     };
     struct Distance : public stream::IDistance
     {
-        std::vector<Sample> const& get_samples() const { return samples; }
+        auto get_samples() const -> stream::Sample_View<Sample> { return stream::Sample_View<Sample>(samples); }
         uint32_t get_rate() const { return rate; }
+        void clear() override { samples.clear(); }
         uint32_t rate = 0;
         Clock::duration accumulated_dt = Clock::duration{0};
         Clock::duration dt = Clock::duration{0};
@@ -142,8 +148,9 @@ private:
     };
     struct GPS_Info : public stream::IGPS_Info
     {
-        std::vector<Sample> const& get_samples() const { return samples; }
+        auto get_samples() const -> stream::Sample_View<Sample> { return stream::Sample_View<Sample>(samples); }
         uint32_t get_rate() const { return rate; }
+        void clear() override { samples.clear(); }
         uint32_t rate = 0;
         Clock::duration accumulated_dt = Clock::duration{0};
         Clock::duration dt = Clock::duration{0};
@@ -152,8 +159,9 @@ private:
     };
     struct ECEF_Position : public stream::IECEF_Position
     {
-        std::vector<Sample> const& get_samples() const { return samples; }
+        auto get_samples() const -> stream::Sample_View<Sample> { return stream::Sample_View<Sample>(samples); }
         uint32_t get_rate() const { return rate; }
+        void clear() override { samples.clear(); }
         uint32_t rate = 0;
         Clock::duration accumulated_dt = Clock::duration{0};
         Clock::duration dt = Clock::duration{0};
@@ -162,8 +170,9 @@ private:
     };
     struct ECEF_Velocity : public stream::IECEF_Velocity
     {
-        std::vector<Sample> const& get_samples() const { return samples; }
+        auto get_samples() const -> stream::Sample_View<Sample> { return stream::Sample_View<Sample>(samples); }
         uint32_t get_rate() const { return rate; }
+        void clear() override { samples.clear(); }
         uint32_t rate = 0;
         Clock::duration accumulated_dt = Clock::duration{0};
         Clock::duration dt = Clock::duration{0};
@@ -183,10 +192,10 @@ private:
     mutable std::shared_ptr<ECEF_Position> m_ecef_position_stream;
     mutable std::shared_ptr<ECEF_Velocity> m_ecef_velocity_stream;
 
-    std::vector<std::weak_ptr<stream::IThrottle>> m_input_throttle_streams;
+    std::vector<Stream_Handle<stream::IThrottle>> m_input_throttle_streams;
     std::vector<std::string> m_input_throttle_stream_paths;
 
-    std::weak_ptr<stream::IMultirotor_State> m_input_state_stream;
+    Stream_Handle<stream::IMultirotor_State> m_input_state_stream;
     std::string m_input_state_stream_path;
     stream::IMultirotor_State::Value m_multirotor_state;
 
@@ -1,5 +1,6 @@
 #include "FCStdAfx.h"
 #include "PCA9685.h"
+#include "Capture_Context.h"
 
 #include "hal.def.h"
 //#include "sz_PCA9685.hpp"
@@ -293,12 +294,15 @@ void PCA9685::process()
     for (size_t i = 0; i < m_pwm_channels.size(); i++)
     {
         auto& ch = m_pwm_channels[i];
-        auto stream = ch.stream.lock();
+        auto stream = ch.stream.get();
         if (stream)
         {
             auto const& samples = stream->get_samples();
             if (!samples.empty())
             {
+                //the input age of the node is the latency from the oldest sensor capture to the motors
+                Capture_Context::set(stream::get_oldest_capture_tp(Capture_Context::get(), samples.back().capture_tp));
+
                 set_pwm_value(i2c, i, samples.back().value);
             }
         }
@@ -444,6 +448,10 @@ auto PCA9685::get_descriptor() const -> std::shared_ptr<const hal::INode_Descrip
 {
     return m_descriptor;
 }
+auto PCA9685::get_bus_name() const -> std::string
+{
+    return m_descriptor->get_bus();
+}
 ts::Result<std::shared_ptr<messages::INode_Message>> PCA9685::send_message(messages::INode_Message const& message)
 {
     return make_error("Unknown message");
@@ -31,6 +31,7 @@ public:
 
     ts::Result<void> init(hal::INode_Descriptor const& descriptor) override;
     std::shared_ptr<const hal::INode_Descriptor> get_descriptor() const override;
+    std::string get_bus_name() const override;
 
     ts::Result<void> set_config(hal::INode_Config const& config) override;
     std::shared_ptr<const hal::INode_Config> get_config() const override;
@@ -65,7 +66,7 @@ private:
     struct PWM_Channel
     {
         //sz::PCA9685::PWM_Channel* config = nullptr;
-        std::weak_ptr<stream::IPWM> stream;
+        Stream_Handle<stream::IPWM> stream;
         struct Last_Data
         {
             int pulse = -1;
@@ -1,5 +1,6 @@
 #include "FCStdAfx.h"
 #include "PIGPIO.h"
+#include "Capture_Context.h"
 
 #include "hal.def.h"
 
@@ -33,7 +34,7 @@ struct PIGPIO::Channel
     uint32_t rate = 0;
     uint32_t gpio = 0;
     std::string stream_path;
-    std::weak_ptr<stream::IPWM> stream;
+    Stream_Handle<stream::IPWM> stream;
 };
 
 
@@ -253,10 +254,10 @@ void PIGPIO::process()
     for (size_t i = 0; i < m_channels.size(); i++)
     {
         std::unique_ptr<Channel> const& ch = m_channels[i];
-        std::shared_ptr<stream::IPWM> stream = ch->stream.lock();
+        stream::IPWM* stream = ch->stream.get();
         if (stream)
         {
-            std::vector<stream::IPWM::Sample> const& samples = stream->get_samples();
+            auto samples = stream->get_samples();
             if (!samples.empty())
             {
 //                if (samples.size() > 20)
@@ -265,6 +266,10 @@ void PIGPIO::process()
 //                }
 
                 stream::IPWM::Sample const& sample = samples.back();
+
+                //the input age of the node is the latency from the oldest sensor capture to the motors
+                Capture_Context::set(stream::get_oldest_capture_tp(Capture_Context::get(), sample.capture_tp));
+
                 if (sample.is_healthy)
                 {
                     set_pwm_value(i, sample.value);
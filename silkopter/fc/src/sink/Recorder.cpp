@@ -0,0 +1,473 @@
+#include "FCStdAfx.h"
+#include "Recorder.h"
+
+#include "Sample_Ring.h"
+#include "common/stream/IAcceleration.h"
+#include "common/stream/IAngular_Velocity.h"
+#include "common/stream/IADC.h"
+#include "common/stream/IFloat.h"
+#include "common/stream/IBool.h"
+#include "common/stream/IBattery_State.h"
+#include "common/stream/ICurrent.h"
+#include "common/stream/IDistance.h"
+#include "common/stream/IPosition.h"
+#include "common/stream/ILinear_Acceleration.h"
+#include "common/stream/IMagnetic_Field.h"
+#include "common/stream/IPressure.h"
+#include "common/stream/IPWM.h"
+#include "common/stream/IFrame.h"
+#include "common/stream/IGPS_Info.h"
+#include "common/stream/ITemperature.h"
+#include "common/stream/IForce.h"
+#include "common/stream/IVelocity.h"
+#include "common/stream/IThrottle.h"
+#include "common/stream/ITorque.h"
+#include "common/stream/IVoltage.h"
+#include "common/stream/IProximity.h"
+#include "common/stream/IMultirotor_Simulator_State.h"
+#include "common/stream/IMultirotor_State.h"
+#include "common/stream/IMultirotor_Commands.h"
+
+#include "hal.def.h"
+
+//records start only this far from the end of a chunk buffer so the last sample doesn't grow the buffer
+constexpr size_t CHUNK_SLACK = 4096;
+
+//a chunk not full after this long is written anyway so a crash doesn't lose the slow streams
+constexpr std::chrono::seconds CHUNK_FLUSH_PERIOD(1);
+
+namespace silk
+{
+namespace node
+{
+
+struct Recorder::IStream_Input
+{
+    virtual ~IStream_Input() = default;
+
+    virtual auto get_type() const -> stream::Type = 0;
+    virtual auto get_rate() const -> uint32_t = 0;
+
+    //records the samples pushed since the last call
+    virtual void record(Recorder& recorder, uint16_t id, Clock::time_point tp) = 0;
+    //moves past the samples pushed since the last call without recording them
+    virtual void skip() = 0;
+};
+
+template<class Stream>
+struct Recorder::Stream_Input : public Recorder::IStream_Input
+{
+    typedef typename Stream::Sample Sample;
+
+    Stream_Input(std::shared_ptr<Stream> const& _stream, ISample_Ring_Source<Sample> const& _ring_source)
+        : stream(_stream)
+        , ring_source(_ring_source)
+        , rate(_stream->get_rate())
+    {
+        period = rate > 0 ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / rate)) : Clock::duration(0);
+        read_index = ring_source.get_sample_ring().get_end_index();
+    }
+
+    auto get_type() const -> stream::Type override
+    {
+        return Stream::TYPE;
+    }
+    auto get_rate() const -> uint32_t override
+    {
+        return rate;
+    }
+
+    void record(Recorder& recorder, uint16_t id, Clock::time_point tp) override
+    {
+        if (!stream.get())
+        {
+            return;
+        }
+
+        Sample_Ring<Sample> const& ring = ring_source.get_sample_ring();
+        uint64_t const begin = ring.get_begin_index();
+        uint64_t const end = ring.get_end_index();
+        if (read_index < begin)
+        {
+            recorder.m_dropped_sample_count += begin - read_index;
+            read_index = begin;
+        }
+
+        //samples only carry their capture time. The newest was pushed this frame and the others at the stream rate before it
+        while (read_index < end)
+        {
+            if (!recorder.prepare_record(tp))
+            {
+                recorder.m_dropped_sample_count += end - read_index;
+                read_index = end;
+                return;
+            }
+
+            util::serialization::Buffer_t& buffer = *recorder.m_buffer;
+            size_t& off = recorder.m_buffer_off;
+
+            util::serialization::serialize(buffer, flight_log::Record::SAMPLES, off);
+            util::serialization::serialize(buffer, id, off);
+            size_t header_off = off;
+            util::serialization::serialize(buffer, int64_t(0), off);
+            util::serialization::serialize(buffer, uint32_t(0), off);
+            util::serialization::serialize(buffer, uint32_t(0), off);
+            size_t samples_off = off;
+
+            Clock::time_point first_tp = tp - period * (end - 1 - read_index);
+            uint32_t count = 0;
+            do
+            {
+                Sample const& sample = ring.get(read_index);
+                util::serialization::serialize(buffer, sample, off);
+                util::serialization::serialize(buffer, sample.capture_tp, off);
+                read_index++;
+                count++;
+            } while (read_index < end && off < recorder.m_buffer_limit);
+
+            Clock::time_point last_tp = tp - period * (end - read_index);
+            util::serialization::serialize(buffer, flight_log::to_ns(last_tp), header_off);
+            util::serialization::serialize(buffer, count, header_off);
+            util::serialization::serialize(buffer, static_cast<uint32_t>(off - samples_off), header_off);
+
+            recorder.m_chunk_first_tp = std::min(recorder.m_chunk_first_tp, first_tp);
+            recorder.m_chunk_last_tp = std::max(recorder.m_chunk_last_tp, last_tp);
+        }
+    }
+
+    void skip() override
+    {
+        if (stream.get())
+        {
+            read_index = ring_source.get_sample_ring().get_end_index();
+        }
+    }
+
+    Stream_Handle<Stream> stream;
+    ISample_Ring_Source<Sample> const& ring_source; //the same object as the stream, valid as long as it is
+    uint32_t rate = 0;
+    Clock::duration period;
+    uint64_t read_index = 0;
+};
+
+template<class Stream>
+auto Recorder::create_stream_input(std::shared_ptr<stream::IStream> const& _stream, std::unique_ptr<IStream_Input>& input) -> bool
+{
+    if (_stream->get_type() == Stream::TYPE)
+    {
+        auto stream = std::static_pointer_cast<Stream>(_stream);
+        auto ring_source = dynamic_cast<ISample_Ring_Source<typename Stream::Sample> const*>(stream.get());
+        if (ring_source)
+        {
+            input.reset(new Stream_Input<Stream>(stream, *ring_source));
+        }
+        return true;
+    }
+    return false;
+}
+
+Recorder::Recorder(HAL& hal)
+    : m_hal(hal)
+    , m_descriptor(new hal::Recorder_Descriptor())
+    , m_config(new hal::Recorder_Config())
+{
+}
+
+Recorder::~Recorder()
+{
+    if (m_buffer)
+    {
+        submit_chunk();
+    }
+    if (m_writer.is_open())
+    {
+        m_writer.close();
+        QLOGI("Recorded {} chunks. Dropped {} chunks and {} samples", m_writer.get_written_chunk_count(), m_writer.get_dropped_chunk_count(), m_dropped_sample_count);
+    }
+}
+
+ts::Result<void> Recorder::init(hal::INode_Descriptor const& descriptor)
+{
+    QLOG_TOPIC("recorder::init");
+
+    auto specialized = dynamic_cast<hal::Recorder_Descriptor const*>(&descriptor);
+    if (!specialized)
+    {
+        return make_error("Wrong descriptor type");
+    }
+    *m_descriptor = *specialized;
+
+    return init();
+}
+
+ts::Result<void> Recorder::init()
+{
+    if (m_descriptor->get_input_count() > std::numeric_limits<uint16_t>::max())
+    {
+        return make_error("Too many inputs: {}", m_descriptor->get_input_count());
+    }
+
+    m_inputs.resize(m_descriptor->get_input_count());
+    m_buffer_limit = m_descriptor->get_chunk_size() - CHUNK_SLACK;
+
+    return ts::success;
+}
+
+ts::Result<void> Recorder::start(Clock::time_point tp)
+{
+    return open_log();
+}
+
+ts::Result<void> Recorder::open_log()
+{
+    QLOG_TOPIC("recorder::open_log");
+
+    if (m_buffer)
+    {
+        submit_chunk();
+    }
+
+    std::string const& directory = m_descriptor->get_directory();
+    if (!q::util::fs::is_folder(q::Path(directory)) && !q::util::fs::create_folder(q::Path(directory)))
+    {
+        return make_error("Cannot create the flight log folder '{}'", directory);
+    }
+
+    char mbstr[256] = {0};
+    std::time_t t = std::time(nullptr);
+    if (!std::strftime(mbstr, 100, "flight-%Y-%m-%d-%H-%M-%S", std::localtime(&t)))
+    {
+        strcpy(mbstr, "no-date");
+    }
+
+    for (size_t file_idx = 0; file_idx < 16; file_idx++)
+    {
+        std::string filepath;
+        q::util::format_emplace(filepath, "{}/{}-{}.silklog", directory, mbstr, file_idx);
+        if (!q::util::fs::exists(q::Path(filepath)))
+        {
+            return m_writer.open(filepath, m_descriptor->get_chunk_size(), m_descriptor->get_chunk_buffer_count());
+        }
+    }
+
+    return make_error("Cannot find a free flight log name in '{}'", directory);
+}
+
+auto Recorder::get_inputs() const -> std::vector<Input>
+{
+    std::vector<Input> inputs(m_inputs.size());
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        IStream_Input const* input = m_inputs[i].input.get();
+        inputs[i] = { input ? input->get_type() : stream::Type(),
+                      input ? input->get_rate() : 0u,
+                      q::util::format<std::string>("input_{}", i),
+                      m_inputs[i].stream_path };
+    }
+    return inputs;
+}
+
+ts::Result<void> Recorder::set_input_stream_path(size_t idx, std::string const& path)
+{
+    QLOG_TOPIC("recorder::set_input_stream_path");
+
+    if (idx >= m_inputs.size())
+    {
+        return make_error("Invalid input index {}", idx);
+    }
+
+    //the current chunk described the old streams
+    if (m_buffer)
+    {
+        submit_chunk();
+    }
+
+    Input_Data& data = m_inputs[idx];
+    data.stream_path.clear();
+    data.input.reset();
+
+    if (path.empty())
+    {
+        return ts::success;
+    }
+
+    std::shared_ptr<stream::IStream> stream = m_hal.get_stream_registry().find_by_name<stream::IStream>(path);
+    if (!stream)
+    {
+        return make_error("Cannot find stream '{}'", path);
+    }
+
+    std::unique_ptr<IStream_Input> input;
+    if (create_stream_input<stream::IAcceleration>(stream, input) ||
+        create_stream_input<stream::IENU_Acceleration>(stream, input) ||
+        create_stream_input<stream::IECEF_Acceleration>(stream, input) ||
+
+        create_stream_input<stream::IAngular_Velocity>(stream, input) ||
+        create_stream_input<stream::IENU_Angular_Velocity>(stream, input) ||
+        create_stream_input<stream::IECEF_Angular_Velocity>(stream, input) ||
+
+        create_stream_input<stream::IMagnetic_Field>(stream, input) ||
+        create_stream_input<stream::IENU_Magnetic_Field>(stream, input) ||
+        create_stream_input<stream::IECEF_Magnetic_Field>(stream, input) ||
+
+        create_stream_input<stream::ILinear_Acceleration>(stream, input) ||
+        create_stream_input<stream::IENU_Linear_Acceleration>(stream, input) ||
+        create_stream_input<stream::IECEF_Linear_Acceleration>(stream, input) ||
+
+        create_stream_input<stream::IECEF_Position>(stream, input) ||
+
+        create_stream_input<stream::IVelocity>(stream, input) ||
+        create_stream_input<stream::IENU_Velocity>(stream, input) ||
+        create_stream_input<stream::IECEF_Velocity>(stream, input) ||
+
+        create_stream_input<stream::IGimbal_Frame>(stream, input) ||
+        create_stream_input<stream::IFrame>(stream, input) ||
+        create_stream_input<stream::IENU_Frame>(stream, input) ||
+
+        create_stream_input<stream::IForce>(stream, input) ||
+        create_stream_input<stream::IENU_Force>(stream, input) ||
+        create_stream_input<stream::IECEF_Force>(stream, input) ||
+
+        create_stream_input<stream::ITorque>(stream, input) ||
+        create_stream_input<stream::IENU_Torque>(stream, input) ||
+        create_stream_input<stream::IECEF_Torque>(stream, input) ||
+
+        create_stream_input<stream::IPressure>(stream, input) ||
+        create_stream_input<stream::IBattery_State>(stream, input) ||
+        create_stream_input<stream::ICurrent>(stream, input) ||
+        create_stream_input<stream::IVoltage>(stream, input) ||
+        create_stream_input<stream::IDistance>(stream, input) ||
+        create_stream_input<stream::IPWM>(stream, input) ||
+        create_stream_input<stream::IGPS_Info>(stream, input) ||
+        create_stream_input<stream::ITemperature>(stream, input) ||
+        create_stream_input<stream::IADC>(stream, input) ||
+        create_stream_input<stream::IFloat>(stream, input) ||
+        create_stream_input<stream::IBool>(stream, input) ||
+        create_stream_input<stream::IThrottle>(stream, input) ||
+        create_stream_input<stream::IMultirotor_Commands>(stream, input) ||
+        create_stream_input<stream::IMultirotor_State>(stream, input) ||
+        create_stream_input<stream::IMultirotor_Simulator_State>(stream, input) ||
+        create_stream_input<stream::IProximity>(stream, input))
+    {
+        ;//nothing
+    }
+
+    if (!input)
+    {
+        return make_error("Stream '{}' cannot be recorded, it doesn't keep its samples in a ring", path);
+    }
+
+    data.stream_path = path;
+    data.input = std::move(input);
+    return ts::success;
+}
+
+auto Recorder::prepare_record(Clock::time_point tp) -> bool
+{
+    if (m_buffer && m_buffer_off >= m_buffer_limit)
+    {
+        submit_chunk();
+    }
+    if (m_buffer)
+    {
+        return true;
+    }
+
+    m_buffer = m_writer.acquire_buffer();
+    if (!m_buffer)
+    {
+        return false;
+    }
+    m_buffer_off = 0;
+    m_chunk_first_tp = tp;
+    m_chunk_last_tp = tp;
+
+    //every chunk starts with the streams so it can be decoded without the ones before it
+    for (size_t i = 0; i < m_inputs.size(); i++)
+    {
+        IStream_Input const* input = m_inputs[i].input.get();
+        if (input)
+        {
+            util::serialization::serialize(*m_buffer, flight_log::Record::STREAM, m_buffer_off);
+            util::serialization::serialize(*m_buffer, static_cast<uint16_t>(i), m_buffer_off);
+            util::serialization::serialize(*m_buffer, m_inputs[i].stream_path, m_buffer_off);
+            util::serialization::serialize(*m_buffer, input->get_type(), m_buffer_off);
+            util::serialization::serialize(*m_buffer, input->get_rate(), m_buffer_off);
+        }
+    }
+    return true;
+}
+
+void Recorder::submit_chunk()
+{
+    QASSERT(m_buffer);
+    m_writer.submit_buffer(m_buffer, m_buffer_off, m_chunk_first_tp, m_chunk_last_tp);
+    m_buffer = nullptr;
+    m_buffer_off = 0;
+}
+
+void Recorder::process()
+{
+    QLOG_TOPIC("recorder::process");
+
+    if (!m_writer.is_open())
+    {
+        return;
+    }
+
+    Clock::time_point now = Clock::now();
+    bool is_recording = m_config->get_is_recording();
+
+    for (size_t i = 0; i < m_inputs.size(); i++)
+    {
+        IStream_Input* input = m_inputs[i].input.get();
+        if (!input)
+        {
+            continue;
+        }
+        if (is_recording)
+        {
+            input->record(*this, static_cast<uint16_t>(i), now);
+        }
+        else
+        {
+            input->skip();
+        }
+    }
+
+    if (m_buffer && (!is_recording || now - m_chunk_first_tp >= CHUNK_FLUSH_PERIOD))
+    {
+        submit_chunk();
+    }
+}
+
+ts::Result<void> Recorder::set_config(hal::INode_Config const& config)
+{
+    QLOG_TOPIC("recorder::set_config");
+
+    auto specialized = dynamic_cast<hal::Recorder_Config const*>(&config);
+    if (!specialized)
+    {
+        return make_error("Wrong config type");
+    }
+    *m_config = *specialized;
+
+    return ts::success;
+}
+auto Recorder::get_config() const -> std::shared_ptr<const hal::INode_Config>
+{
+    return m_config;
+}
+
+auto Recorder::get_descriptor() const -> std::shared_ptr<const hal::INode_Descriptor>
+{
+    return m_descriptor;
+}
+
+ts::Result<std::shared_ptr<messages::INode_Message>> Recorder::send_message(messages::INode_Message const& message)
+{
+    return make_error("Unknown message");
+}
+
+}
+}
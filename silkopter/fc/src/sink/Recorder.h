@@ -0,0 +1,84 @@
+#pragma once
+
+#include "HAL.h"
+#include "common/node/ISink.h"
+#include "Flight_Log.h"
+
+namespace silk
+{
+namespace hal
+{
+struct Recorder_Descriptor;
+struct Recorder_Config;
+}
+}
+
+
+namespace silk
+{
+namespace node
+{
+
+//Records any set of streams in a flight log for post-crash analysis.
+//The samples are read from the sample ring of each stream so every sample is recorded once, at the full rate, even when
+// the producer runs less often than the recorder. Processing only serializes the samples in a chunk buffer - compressing
+// and writing happen on the writer's io thread.
+class Recorder : public ISink
+{
+public:
+    Recorder(HAL& hal);
+    ~Recorder();
+
+    ts::Result<void> init(hal::INode_Descriptor const& descriptor) override;
+    std::shared_ptr<const hal::INode_Descriptor> get_descriptor() const override;
+
+    ts::Result<void> set_config(hal::INode_Config const& config) override;
+    std::shared_ptr<const hal::INode_Config> get_config() const override;
+
+    ts::Result<std::shared_ptr<messages::INode_Message>> send_message(messages::INode_Message const& message) override;
+
+    ts::Result<void> start(Clock::time_point tp) override;
+
+    ts::Result<void> set_input_stream_path(size_t idx, std::string const& path);
+    auto get_inputs() const -> std::vector<Input>;
+
+    void process();
+
+private:
+    ts::Result<void> init();
+
+    ts::Result<void> open_log();
+
+    //makes sure there is a chunk buffer with room for a record. Returns false if the writer fell behind
+    auto prepare_record(Clock::time_point tp) -> bool;
+    void submit_chunk();
+
+    HAL& m_hal;
+
+    std::shared_ptr<hal::Recorder_Descriptor> m_descriptor;
+    std::shared_ptr<hal::Recorder_Config> m_config;
+
+    struct IStream_Input;
+    template<class Stream> struct Stream_Input;
+    struct Input_Data
+    {
+        std::string stream_path;
+        std::unique_ptr<IStream_Input> input;
+    };
+    std::vector<Input_Data> m_inputs;
+
+    template<class Stream> static auto create_stream_input(std::shared_ptr<stream::IStream> const& stream, std::unique_ptr<IStream_Input>& input) -> bool;
+
+    Flight_Log_Writer m_writer;
+
+    util::serialization::Buffer_t* m_buffer = nullptr;
+    size_t m_buffer_off = 0;
+    size_t m_buffer_limit = 0; //records start only below this, the rest is slack for the last sample
+    Clock::time_point m_chunk_first_tp;
+    Clock::time_point m_chunk_last_tp;
+
+    uint64_t m_dropped_sample_count = 0;
+};
+
+}
+}
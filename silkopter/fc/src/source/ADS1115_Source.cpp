@@ -374,6 +374,11 @@ auto ADS1115_Source::get_descriptor() const -> std::shared_ptr<const hal::INode_
     return m_descriptor;
 }
 
+auto ADS1115_Source::get_bus_name() const -> std::string
+{
+    return m_descriptor->get_bus();
+}
+
 ts::Result<std::shared_ptr<messages::INode_Message>> ADS1115_Source::send_message(messages::INode_Message const& message)
 {
     return make_error("Unknown message");
@@ -173,6 +173,11 @@ auto AVRADC::get_descriptor() const -> std::shared_ptr<const hal::INode_Descript
     return m_descriptor;
 }
 
+auto AVRADC::get_bus_name() const -> std::string
+{
+    return m_descriptor->get_bus();
+}
+
 ts::Result<std::shared_ptr<messages::INode_Message>> AVRADC::send_message(messages::INode_Message const& message)
 {
     return make_error("Unknown message");
@@ -4,6 +4,10 @@
 #include "utils/Timed_Scope.h"
 
 #include "hal.def.h"
+#include "Frame_Arena.h"
+
+#include <fcntl.h>
+#include <unistd.h>
 //#include "sz_Calibration_Data.hpp"
 //#include "sz_MPU9250.hpp"
 
@@ -320,6 +324,10 @@ MPU9250::MPU9250(HAL& hal)
 
 MPU9250::~MPU9250()
 {
+    if (m_data_ready_fd >= 0)
+    {
+        ::close(m_data_ready_fd);
+    }
 }
 
 bool MPU9250::mpu_read(Buses& buses, uint8_t reg, uint8_t* rx_data, uint32_t size, size_t speed)
@@ -669,6 +677,20 @@ ts::Result<void> MPU9250::init()
 
     reset_fifo(buses);
 
+    //the INT pin pulses high when a new sample is in the FIFO
+    if (m_descriptor->get_data_ready_gpio() >= 0)
+    {
+        if (!mpu_write_u8(buses, MPU_REG_INT_ENABLE, MPU_BIT_RAW_RDY_EN, CONFIG_REGISTER_SPEED))
+        {
+            return make_error("Failed to enable the data ready interrupt");
+        }
+        auto result = open_data_ready_gpio(m_descriptor->get_data_ready_gpio());
+        if (result != ts::success)
+        {
+            return result;
+        }
+    }
+
     m_magnetic_field->set_rate(m_descriptor->get_magnetometer_rate());
     m_acceleration->set_rate((size_t)m_descriptor->get_imu_rate());
     m_angular_velocity->set_rate((size_t)m_descriptor->get_imu_rate());
@@ -994,8 +1016,9 @@ void MPU9250::process()
             size_t to_read = sample_count * FIFO_SAMPLE_SIZE;
             QASSERT(sample_count >= 1);
 
-            m_fifo_buffer.resize(to_read);
-            if (mpu_read(buses, MPU_REG_FIFO_R_W, m_fifo_buffer.data(), m_fifo_buffer.size(), MISC_REGISTER_SPEED))
+            //after a late frame the backlog can be much bigger than usual
+            Frame_Vector<uint8_t> fifo_buffer(to_read);
+            if (mpu_read(buses, MPU_REG_FIFO_R_W, fifo_buffer.data(), fifo_buffer.size(), MISC_REGISTER_SPEED))
             {
 //                static Clock::time_point s_last_stat_tp = Clock::now();
 //                static size_t s_sample_count = 0;
@@ -1015,7 +1038,7 @@ void MPU9250::process()
                 Clock::duration acc_dt = m_acceleration->get_dt();
                 Clock::duration av_dt = m_angular_velocity->get_dt();
 
-                uint8_t const* data = m_fifo_buffer.data();
+                uint8_t const* data = fifo_buffer.data();
                 for (size_t i = 0; i < sample_count; i++)
                 {
                     if (FIFO_STREAMS & MPU_BIT_ACCEL)
@@ -1352,6 +1375,59 @@ std::shared_ptr<const hal::INode_Descriptor> MPU9250::get_descriptor() const
     return m_descriptor;
 }
 
+std::string MPU9250::get_bus_name() const
+{
+    return m_descriptor->get_bus();
+}
+
+ts::Result<void> MPU9250::open_data_ready_gpio(int gpio)
+{
+    QLOG_TOPIC("mpu9250::open_data_ready_gpio");
+
+    auto write_file = [](std::string const& path, std::string const& value) -> bool
+    {
+        int fd = ::open(path.c_str(), O_WRONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            return false;
+        }
+        bool ok = ::write(fd, value.data(), value.size()) == static_cast<ssize_t>(value.size());
+        ::close(fd);
+        return ok;
+    };
+
+    std::string gpio_path = q::util::format<std::string>("/sys/class/gpio/gpio{}", gpio);
+
+    //exporting an already exported GPIO fails, that's fine
+    if (access(gpio_path.c_str(), F_OK) != 0)
+    {
+        write_file("/sys/class/gpio/export", q::util::format<std::string>("{}", gpio));
+    }
+    if (!write_file(gpio_path + "/direction", "in") ||
+        !write_file(gpio_path + "/edge", "rising"))
+    {
+        return make_error("Cannot configure data ready GPIO {}: {}", gpio, strerror(errno));
+    }
+
+    if (m_data_ready_fd >= 0)
+    {
+        ::close(m_data_ready_fd);
+    }
+    m_data_ready_fd = ::open((gpio_path + "/value").c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+    if (m_data_ready_fd < 0)
+    {
+        return make_error("Cannot open data ready GPIO {}: {}", gpio, strerror(errno));
+    }
+
+    QLOGI("Data ready on GPIO {}", gpio);
+    return ts::success;
+}
+
+int MPU9250::get_data_ready_fd() const
+{
+    return m_data_ready_fd;
+}
+
 ts::Result<std::shared_ptr<messages::INode_Message>> MPU9250::send_message(messages::INode_Message const& message)
 {
     return make_error("Unknown message");
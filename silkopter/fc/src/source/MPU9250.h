@@ -36,6 +36,8 @@ public:
 
     ts::Result<void> init(hal::INode_Descriptor const& descriptor) override;
     std::shared_ptr<const hal::INode_Descriptor> get_descriptor() const override;
+    std::string get_bus_name() const override;
+    int get_data_ready_fd() const override;
 
     ts::Result<void> set_config(hal::INode_Config const& config) override;
     std::shared_ptr<const hal::INode_Config> get_config() const override;
@@ -50,6 +52,7 @@ public:
 
 private:
     ts::Result<void> init();
+    ts::Result<void> open_data_ready_gpio(int gpio);
 
 private:
     HAL& m_hal;
@@ -89,10 +92,10 @@ private:
     std::shared_ptr<hal::MPU9250_Descriptor> m_descriptor;
     std::shared_ptr<hal::MPU9250_Config> m_config;
 
-    mutable std::vector<uint8_t> m_fifo_buffer;
-
     uint8_t m_user_ctrl_value = 0;
 
+    int m_data_ready_fd = -1; //the sysfs value file of the GPIO the INT pin is wired to
+
     typedef Basic_Output_Stream<stream::IAcceleration> Acceleration_Stream;
     mutable std::shared_ptr<Acceleration_Stream> m_acceleration;
     float m_acceleration_sensor_scale = 1.0f;
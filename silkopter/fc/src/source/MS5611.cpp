@@ -342,6 +342,11 @@ auto MS5611::get_descriptor() const -> std::shared_ptr<const hal::INode_Descript
     return m_descriptor;
 }
 
+auto MS5611::get_bus_name() const -> std::string
+{
+    return m_descriptor->get_bus();
+}
+
 ts::Result<std::shared_ptr<messages::INode_Message>> MS5611::send_message(messages::INode_Message const& message)
 {
     return make_error("Unknown message");
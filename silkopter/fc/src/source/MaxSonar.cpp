@@ -169,6 +169,11 @@ auto MaxSonar::get_descriptor() const -> std::shared_ptr<const hal::INode_Descri
     return m_descriptor;
 }
 
+auto MaxSonar::get_bus_name() const -> std::string
+{
+    return m_descriptor->get_bus();
+}
+
 ts::Result<std::shared_ptr<messages::INode_Message>> MaxSonar::send_message(messages::INode_Message const& message)
 {
     return make_error("Unknown message");
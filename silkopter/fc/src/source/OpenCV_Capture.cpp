@@ -1,5 +1,6 @@
 #include "FCStdAfx.h"
 #include "OpenCV_Capture.h"
+#include "utils/Thread_Registry.h"
 /*
 #include "hal.def.h"
 //#include "sz_OpenCV_Capture.hpp"
@@ -311,6 +312,8 @@ auto OpenCV_Capture::create_components() -> bool
 
     m_impl->capture_thread = std::thread([this]()
     {
+        util::Thread_Registry::register_current_thread("opencv capture");
+
         cv::Mat frame;
         while (m_impl->capture_thread_alive)
         {
@@ -321,6 +321,11 @@ auto RC5T619::get_descriptor() const -> std::shared_ptr<const hal::INode_Descrip
     return m_descriptor;
 }
 
+auto RC5T619::get_bus_name() const -> std::string
+{
+    return m_descriptor->get_bus();
+}
+
 ts::Result<std::shared_ptr<messages::INode_Message>> RC5T619::send_message(messages::INode_Message const& message)
 {
     return make_error("Unknown message");
@@ -29,6 +29,7 @@ public:
 
     ts::Result<void> init(hal::INode_Descriptor const& descriptor) override;
     std::shared_ptr<const hal::INode_Descriptor> get_descriptor() const override;
+    std::string get_bus_name() const override;
 
     ts::Result<void> set_config(hal::INode_Config const& config) override;
     std::shared_ptr<const hal::INode_Config> get_config() const override;
@@ -58,8 +59,9 @@ private:
 
     struct Stream : public stream::IADC
     {
-        auto get_samples() const -> std::vector<Sample> const& { return samples; }
+        auto get_samples() const -> stream::Sample_View<Sample> { return stream::Sample_View<Sample>(samples); }
         auto get_rate() const -> uint32_t { return rate; }
+        void clear() override { samples.clear(); }
 
         std::vector<Sample> samples;
         Clock::time_point last_tp = Clock::now();
@@ -1,5 +1,6 @@
 #include "FCStdAfx.h"
 #include "Raspicam.h"
+#include "utils/Thread_Registry.h"
 
 #include "hal.def.h"
 
@@ -249,6 +250,8 @@ ts::Result<void> Raspicam::init()
 
     m_recording_data.thread = std::thread([this]()
     {
+        util::Thread_Registry::register_current_thread("raspicam recording");
+
         while (!m_recording_data.should_stop)
         {
             {
@@ -289,19 +292,6 @@ ts::Result<void> Raspicam::init()
         }
     });
 
-#if defined RASPBERRY_PI
-    {
-        int policy = SCHED_IDLE;
-        struct sched_param param;
-        param.sched_priority = sched_get_priority_min(policy);
-        if (pthread_setschedparam(m_recording_data.thread.native_handle(), policy, &param) != 0)
-        {
-            perror("recording thread sched_setscheduler");
-            exit(EXIT_FAILURE);
-        }
-    }
-#endif
-
 
     //m_descriptor->fps = math::clamp<size_t>(m_descriptor->fps, 10, 60);
 
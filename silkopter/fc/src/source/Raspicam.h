@@ -82,8 +82,9 @@ private:
 
     struct Stream : public stream::IVideo
     {
-        auto get_samples() const -> std::vector<Sample> const& { return samples; }
+        auto get_samples() const -> stream::Sample_View<Sample> { return stream::Sample_View<Sample>(samples); }
         auto get_rate() const -> uint32_t { return rate; }
+        void clear() override { samples.clear(); }
 
         uint32_t rate = 0;
         std::vector<Sample> samples;
@@ -0,0 +1,380 @@
+#include "FCStdAfx.h"
+#include "Replay.h"
+
+#include "Basic_Output_Stream.h"
+#include "common/stream/IAcceleration.h"
+#include "common/stream/IAngular_Velocity.h"
+#include "common/stream/IADC.h"
+#include "common/stream/IFloat.h"
+#include "common/stream/IBool.h"
+#include "common/stream/IBattery_State.h"
+#include "common/stream/ICurrent.h"
+#include "common/stream/IDistance.h"
+#include "common/stream/IPosition.h"
+#include "common/stream/ILinear_Acceleration.h"
+#include "common/stream/IMagnetic_Field.h"
+#include "common/stream/IPressure.h"
+#include "common/stream/IPWM.h"
+#include "common/stream/IFrame.h"
+#include "common/stream/IGPS_Info.h"
+#include "common/stream/ITemperature.h"
+#include "common/stream/IForce.h"
+#include "common/stream/IVelocity.h"
+#include "common/stream/IThrottle.h"
+#include "common/stream/ITorque.h"
+#include "common/stream/IVoltage.h"
+#include "common/stream/IProximity.h"
+#include "common/stream/IMultirotor_Simulator_State.h"
+#include "common/stream/IMultirotor_State.h"
+#include "common/stream/IMultirotor_Commands.h"
+
+#include "hal.def.h"
+
+namespace silk
+{
+namespace node
+{
+
+struct Replay::IOutput_Stream
+{
+    virtual ~IOutput_Stream() = default;
+
+    virtual auto get_stream() const -> std::shared_ptr<stream::IStream> = 0;
+    virtual void clear() = 0;
+
+    //pushes the samples of a record with their times moved by log_to_clock. False if they cannot be deserialized
+    virtual auto push_samples(Flight_Log_Reader::Samples const& samples, Clock::duration log_to_clock) -> bool = 0;
+};
+
+template<class Stream>
+struct Replay::Output_Stream : public Replay::IOutput_Stream
+{
+    Output_Stream(uint32_t rate)
+        : stream(std::make_shared<Basic_Output_Stream<Stream>>())
+    {
+        stream->set_rate(rate);
+    }
+
+    auto get_stream() const -> std::shared_ptr<stream::IStream> override
+    {
+        return stream;
+    }
+    void clear() override
+    {
+        stream->clear();
+    }
+
+    auto push_samples(Flight_Log_Reader::Samples const& samples, Clock::duration log_to_clock) -> bool override
+    {
+        Clock::time_point last_tp = Clock::time_point(std::chrono::duration_cast<Clock::duration>(std::chrono::nanoseconds(samples.tp_ns))) + log_to_clock;
+
+        //capture times are in microseconds of the clock and wrap, so they move by the same offset with wrapping arithmetic
+        stream::Capture_Tp capture_offset = static_cast<stream::Capture_Tp>(std::chrono::duration_cast<std::chrono::microseconds>(log_to_clock).count());
+
+        size_t off = samples.offset;
+        for (uint32_t i = 0; i < samples.count; i++)
+        {
+            stream::Capture_Tp capture_tp = 0;
+            if (!util::serialization::deserialize(*samples.data, sample, off) ||
+                !util::serialization::deserialize(*samples.data, capture_tp, off))
+            {
+                return false;
+            }
+            Clock::time_point tp = last_tp - stream->get_dt() * (samples.count - 1 - i);
+            stream->push_sample_at(sample.value, sample.is_healthy, tp, capture_tp != 0 ? capture_tp + capture_offset : 0);
+        }
+        return true;
+    }
+
+    std::shared_ptr<Basic_Output_Stream<Stream>> stream;
+    typename Stream::Sample sample;
+};
+
+template<class Stream>
+auto Replay::create_output_stream(stream::Type type, std::unique_ptr<IOutput_Stream>& output, uint32_t rate) -> bool
+{
+    if (type == Stream::TYPE)
+    {
+        output.reset(new Output_Stream<Stream>(rate));
+        return true;
+    }
+    return false;
+}
+
+Replay::Replay(HAL& hal)
+    : m_hal(hal)
+    , m_descriptor(new hal::Replay_Descriptor())
+    , m_config(new hal::Replay_Config())
+{
+}
+
+Replay::~Replay()
+{
+    if (m_hal.get_virtual_clock() == &m_clock)
+    {
+        m_hal.set_virtual_clock(nullptr);
+    }
+}
+
+ts::Result<void> Replay::init(hal::INode_Descriptor const& descriptor)
+{
+    QLOG_TOPIC("replay::init");
+
+    auto specialized = dynamic_cast<hal::Replay_Descriptor const*>(&descriptor);
+    if (!specialized)
+    {
+        return make_error("Wrong descriptor type");
+    }
+    *m_descriptor = *specialized;
+
+    return init();
+}
+
+ts::Result<void> Replay::init()
+{
+    ts::Result<void> result = m_reader.open(m_descriptor->get_path());
+    if (result != ts::success)
+    {
+        return result;
+    }
+
+    m_outputs.clear();
+    m_outputs.resize(m_reader.get_streams().size());
+
+    uint32_t max_rate = 0;
+    for (size_t i = 0; i < m_outputs.size(); i++)
+    {
+        Flight_Log_Reader::Stream const& s = m_reader.get_streams()[i];
+        stream::Type type = s.type;
+        std::unique_ptr<IOutput_Stream>& output = m_outputs[i].output;
+        if (create_output_stream<stream::IAcceleration>(type, output, s.rate) ||
+            create_output_stream<stream::IENU_Acceleration>(type, output, s.rate) ||
+            create_output_stream<stream::IECEF_Acceleration>(type, output, s.rate) ||
+
+            create_output_stream<stream::IAngular_Velocity>(type, output, s.rate) ||
+            create_output_stream<stream::IENU_Angular_Velocity>(type, output, s.rate) ||
+            create_output_stream<stream::IECEF_Angular_Velocity>(type, output, s.rate) ||
+
+            create_output_stream<stream::IMagnetic_Field>(type, output, s.rate) ||
+            create_output_stream<stream::IENU_Magnetic_Field>(type, output, s.rate) ||
+            create_output_stream<stream::IECEF_Magnetic_Field>(type, output, s.rate) ||
+
+            create_output_stream<stream::ILinear_Acceleration>(type, output, s.rate) ||
+            create_output_stream<stream::IENU_Linear_Acceleration>(type, output, s.rate) ||
+            create_output_stream<stream::IECEF_Linear_Acceleration>(type, output, s.rate) ||
+
+            create_output_stream<stream::IECEF_Position>(type, output, s.rate) ||
+
+            create_output_stream<stream::IVelocity>(type, output, s.rate) ||
+            create_output_stream<stream::IENU_Velocity>(type, output, s.rate) ||
+            create_output_stream<stream::IECEF_Velocity>(type, output, s.rate) ||
+
+            create_output_stream<stream::IGimbal_Frame>(type, output, s.rate) ||
+            create_output_stream<stream::IFrame>(type, output, s.rate) ||
+            create_output_stream<stream::IENU_Frame>(type, output, s.rate) ||
+
+            create_output_stream<stream::IForce>(type, output, s.rate) ||
+            create_output_stream<stream::IENU_Force>(type, output, s.rate) ||
+            create_output_stream<stream::IECEF_Force>(type, output, s.rate) ||
+
+            create_output_stream<stream::ITorque>(type, output, s.rate) ||
+            create_output_stream<stream::IENU_Torque>(type, output, s.rate) ||
+            create_output_stream<stream::IECEF_Torque>(type, output, s.rate) ||
+
+            create_output_stream<stream::IPressure>(type, output, s.rate) ||
+            create_output_stream<stream::IBattery_State>(type, output, s.rate) ||
+            create_output_stream<stream::ICurrent>(type, output, s.rate) ||
+            create_output_stream<stream::IVoltage>(type, output, s.rate) ||
+            create_output_stream<stream::IDistance>(type, output, s.rate) ||
+            create_output_stream<stream::IPWM>(type, output, s.rate) ||
+            create_output_stream<stream::IGPS_Info>(type, output, s.rate) ||
+            create_output_stream<stream::ITemperature>(type, output, s.rate) ||
+            create_output_stream<stream::IADC>(type, output, s.rate) ||
+            create_output_stream<stream::IFloat>(type, output, s.rate) ||
+            create_output_stream<stream::IBool>(type, output, s.rate) ||
+            create_output_stream<stream::IThrottle>(type, output, s.rate) ||
+            create_output_stream<stream::IMultirotor_Commands>(type, output, s.rate) ||
+            create_output_stream<stream::IMultirotor_State>(type, output, s.rate) ||
+            create_output_stream<stream::IMultirotor_Simulator_State>(type, output, s.rate) ||
+            create_output_stream<stream::IProximity>(type, output, s.rate))
+        {
+            //the recorded path is "node/output" and the output names cannot have slashes
+            std::string name = s.path;
+            std::replace(name.begin(), name.end(), '/', '_');
+            m_outputs[i].name = name;
+            max_rate = std::max(max_rate, s.rate);
+        }
+        else
+        {
+            QLOGW("Cannot replay stream '{}', unknown type {}:{}", s.path, static_cast<int>(s.type.get_semantic()), static_cast<int>(s.type.get_space()));
+        }
+    }
+
+    if (max_rate == 0)
+    {
+        return make_error("Nothing to replay in '{}'", m_descriptor->get_path());
+    }
+    m_frame_period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / max_rate));
+    m_is_fast = m_descriptor->get_clock() == hal::Replay_Descriptor::clock_t::AS_FAST_AS_POSSIBLE;
+
+    return ts::success;
+}
+
+ts::Result<void> Replay::start(Clock::time_point tp)
+{
+    rewind();
+
+    m_last_tp = tp;
+    m_start_tp = Clock::now();
+    m_replayed_sample_count = 0;
+    m_is_finished = false;
+
+    if (m_is_fast)
+    {
+        m_clock.set_epoch(tp);
+        m_hal.set_virtual_clock(&m_clock);
+    }
+    return ts::success;
+}
+
+void Replay::rewind()
+{
+    m_reader.rewind();
+    m_has_samples = m_reader.read_samples(m_samples);
+
+    //the first record is due right away
+    m_log_tp_ns = m_has_samples ? m_samples.tp_ns : 0;
+}
+
+void Replay::finish()
+{
+    m_is_finished = true;
+
+    auto duration = Clock::now() - m_start_tp;
+    QLOGI("Replayed {} samples in {}: {} samples/s", m_replayed_sample_count, duration,
+          static_cast<uint64_t>(m_replayed_sample_count / std::max(std::chrono::duration<double>(duration).count(), 0.000001)));
+
+    if (m_hal.get_virtual_clock() == &m_clock)
+    {
+        m_hal.set_virtual_clock(nullptr);
+    }
+}
+
+auto Replay::get_outputs() const -> std::vector<Output>
+{
+    std::vector<Output> outputs;
+    for (Output_Data const& data: m_outputs)
+    {
+        if (data.output)
+        {
+            outputs.push_back({ data.name, data.output->get_stream() });
+        }
+    }
+    return outputs;
+}
+
+void Replay::process()
+{
+    QLOG_TOPIC("replay::process");
+
+    for (Output_Data& data: m_outputs)
+    {
+        if (data.output)
+        {
+            data.output->clear();
+        }
+    }
+
+    if (m_is_finished)
+    {
+        return;
+    }
+
+    //one minor frame of the log per frame, so the graph runs the rate groups exactly like in flight
+    Clock::duration dt = m_frame_period;
+    if (!m_is_fast)
+    {
+        Clock::time_point now = Clock::now();
+        dt = std::chrono::duration_cast<Clock::duration>((now - m_last_tp) * m_config->get_speed());
+        m_last_tp = now;
+    }
+    m_log_tp_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(dt).count();
+
+    //the recorded times are moved so the log time of this frame is the time the graph runs at
+    Clock::time_point now = m_is_fast ? m_clock.now() : Clock::now();
+    Clock::duration log_to_clock = now - Clock::time_point(std::chrono::duration_cast<Clock::duration>(std::chrono::nanoseconds(m_log_tp_ns)));
+
+    while (m_has_samples && m_samples.tp_ns <= m_log_tp_ns)
+    {
+        IOutput_Stream* output = m_outputs[m_samples.stream_idx].output.get();
+        if (output)
+        {
+            if (output->push_samples(m_samples, log_to_clock))
+            {
+                m_replayed_sample_count += m_samples.count;
+            }
+            else
+            {
+                QLOGW("Bad samples for stream '{}'", m_reader.get_streams()[m_samples.stream_idx].path);
+            }
+        }
+
+        m_has_samples = m_reader.read_samples(m_samples);
+        if (!m_has_samples && m_config->get_loop())
+        {
+            rewind();
+            break;
+        }
+    }
+
+    if (!m_has_samples)
+    {
+        finish();
+        return;
+    }
+
+    if (m_is_fast)
+    {
+        m_clock.advance(m_frame_period);
+    }
+}
+
+auto Replay::is_finished() const -> bool
+{
+    return m_is_finished;
+}
+auto Replay::get_replayed_sample_count() const -> uint64_t
+{
+    return m_replayed_sample_count;
+}
+
+ts::Result<void> Replay::set_config(hal::INode_Config const& config)
+{
+    QLOG_TOPIC("replay::set_config");
+
+    auto specialized = dynamic_cast<hal::Replay_Config const*>(&config);
+    if (!specialized)
+    {
+        return make_error("Wrong config type");
+    }
+    *m_config = *specialized;
+
+    return ts::success;
+}
+auto Replay::get_config() const -> std::shared_ptr<const hal::INode_Config>
+{
+    return m_config;
+}
+
+auto Replay::get_descriptor() const -> std::shared_ptr<const hal::INode_Descriptor>
+{
+    return m_descriptor;
+}
+
+ts::Result<std::shared_ptr<messages::INode_Message>> Replay::send_message(messages::INode_Message const& message)
+{
+    return make_error("Unknown message");
+}
+
+}
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "HAL.h"
+#include "common/node/ISource.h"
+#include "common/Manual_Clock.h"
+#include "Flight_Log.h"
+
+namespace silk
+{
+namespace hal
+{
+struct Replay_Descriptor;
+struct Replay_Config;
+}
+}
+
+
+namespace silk
+{
+namespace node
+{
+
+//Plays back a flight log written by the Recorder. Every recorded stream becomes an output with the same type and
+// rate, so the nodes that processed the live streams can process the recorded ones.
+//The samples are emitted when the log time reaches the time they were recorded at. The log time follows the wall
+// clock (scaled by the speed), or with the AS_FAST_AS_POSSIBLE clock it advances one minor frame per frame and
+// drives the HAL virtual clock - the whole graph then runs as it did in flight, only without waiting.
+//The samples keep the times and capture times they were recorded with, moved to the clock the graph runs at.
+class Replay : public ISource
+{
+public:
+    Replay(HAL& hal);
+    ~Replay();
+
+    ts::Result<void> init(hal::INode_Descriptor const& descriptor) override;
+    std::shared_ptr<const hal::INode_Descriptor> get_descriptor() const override;
+
+    ts::Result<void> set_config(hal::INode_Config const& config) override;
+    std::shared_ptr<const hal::INode_Config> get_config() const override;
+
+    ts::Result<std::shared_ptr<messages::INode_Message>> send_message(messages::INode_Message const& message) override;
+
+    ts::Result<void> start(Clock::time_point tp) override;
+
+    auto get_outputs() const -> std::vector<Output>;
+
+    void process();
+
+    auto is_finished() const -> bool;
+    auto get_replayed_sample_count() const -> uint64_t;
+
+private:
+    ts::Result<void> init();
+
+    void rewind();
+    void finish();
+
+    HAL& m_hal;
+
+    std::shared_ptr<hal::Replay_Descriptor> m_descriptor;
+    std::shared_ptr<hal::Replay_Config> m_config;
+
+    Flight_Log_Reader m_reader;
+
+    struct IOutput_Stream;
+    template<class Stream> struct Output_Stream;
+    template<class Stream> static auto create_output_stream(stream::Type type, std::unique_ptr<IOutput_Stream>& output, uint32_t rate) -> bool;
+
+    struct Output_Data
+    {
+        std::string name;
+        std::unique_ptr<IOutput_Stream> output;
+    };
+    std::vector<Output_Data> m_outputs; //indexed like the streams of the log. No output for the streams that can't be replayed
+
+    Flight_Log_Reader::Samples m_samples; //the next record to emit
+    bool m_has_samples = false;
+    int64_t m_log_tp_ns = 0;
+    Clock::duration m_frame_period = Clock::duration(0);
+
+    bool m_is_fast = false;
+    Manual_Clock m_clock; //drives the HAL when replaying as fast as possible
+    Clock::time_point m_last_tp;
+
+    bool m_is_finished = false;
+    uint64_t m_replayed_sample_count = 0;
+    Clock::time_point m_start_tp;
+};
+
+}
+}
@@ -209,6 +209,11 @@ auto SRF02::get_descriptor() const -> std::shared_ptr<const hal::INode_Descripto
     return m_descriptor;
 }
 
+auto SRF02::get_bus_name() const -> std::string
+{
+    return m_descriptor->get_bus();
+}
+
 ts::Result<std::shared_ptr<messages::INode_Message>> SRF02::send_message(messages::INode_Message const& message)
 {
     return make_error("Unknown message");
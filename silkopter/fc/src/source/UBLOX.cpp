@@ -2,6 +2,7 @@
 #include "UBLOX.h"
 
 #include "hal.def.h"
+#include "Frame_Arena.h"
 
 
 namespace silk
@@ -982,8 +983,8 @@ void UBLOX::process_cfg_sbas_packet(Buses& buses, Packet& packet)
 
 void UBLOX::process_inf_notice_packet(Buses& buses, Packet& packet)
 {
-    std::string str(reinterpret_cast<char const*>(packet.payload.data()), packet.payload.size());
-    QLOGI("GPS notice: {}", str);
+    Frame_String str(reinterpret_cast<char const*>(packet.payload.data()), packet.payload.size());
+    QLOGI("GPS notice: {}", str.c_str());
 }
 
 void UBLOX::process_mon_hw_packet(Buses& buses, Packet& packet)
@@ -1118,6 +1119,11 @@ auto UBLOX::get_descriptor() const -> std::shared_ptr<const hal::INode_Descripto
     return m_descriptor;
 }
 
+auto UBLOX::get_bus_name() const -> std::string
+{
+    return m_descriptor->get_bus();
+}
+
 ts::Result<std::shared_ptr<messages::INode_Message>> UBLOX::send_message(messages::INode_Message const& message)
 {
     return make_error("Unknown message");
@@ -1074,6 +1074,11 @@ auto UltimateSensorFusion::get_descriptor() const -> std::shared_ptr<const hal::
     return m_descriptor;
 }
 
+auto UltimateSensorFusion::get_bus_name() const -> std::string
+{
+    return m_descriptor->get_bus();
+}
+
 ts::Result<std::shared_ptr<messages::INode_Message>> UltimateSensorFusion::send_message(messages::INode_Message const& /*message*/)
 {
     return make_error("Unknown message");
@@ -0,0 +1,190 @@
+#include "processor/Mahony_AHRS_Filter.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+//Runs the Comp_AHRS complementary filter and the Mahony filter on the same simulated IMU - a 1kHz gyro with noise and
+// a bias, an accelerometer with vibrations and a noisy magnetometer on a frame rotating on all axes - and reports the
+// ns per sample and the mean tilt and heading errors of both.
+//usage: bench_ahrs
+
+namespace
+{
+
+//the per sample work of Comp_AHRS::process in COMPLEMENTARY mode
+class Complementary_AHRS
+{
+public:
+    void reset(math::quatf const& rotation)
+    {
+        m_rotation = rotation;
+    }
+
+    void process(float dts, float drift_correction_factor, math::vec3f const& omega, math::vec3f const& acceleration, math::vec3f const& magnetic_field)
+    {
+        float av_length = 0;
+        math::quatf& a = m_rotation;
+
+        math::vec3f theta = omega * dts;
+        float theta_magnitude = math::length(theta);
+        if (theta_magnitude > std::numeric_limits<float>::epsilon())
+        {
+            math::vec3f av = theta*0.5f;
+            av_length = theta_magnitude;
+            float w = - (av.x * a.x) - (av.y * a.y) - (av.z * a.z);
+            float x = (av.x * a.w) + (av.z * a.y) - (av.y * a.z);
+            float y = (av.y * a.w) + (av.x * a.z) - (av.z * a.x);
+            float z = (av.z * a.w) + (av.y * a.x) - (av.x * a.y);
+            a.x += x;
+            a.y += y;
+            a.z += z;
+            a.w += w;
+            a.normalize<math::safe>();
+        }
+
+        math::vec3f up = math::normalized<float, math::safe>(acceleration);
+        math::vec3f front = math::normalized<float, math::safe>(magnetic_field);
+        if (math::abs(math::dot(up, front)) < 0.99f)
+        {
+            m_front = front;
+        }
+        math::vec3f right = math::normalized<float, math::safe>(math::cross(m_front, up));
+        m_front = math::cross(up, right);
+
+        math::mat3f mat(right, m_front, up);
+        math::quatf noisy_quat;
+        noisy_quat.set_from_mat3(mat);
+        noisy_quat.invert();
+
+        float mu = (dts + av_length) * drift_correction_factor;
+        a = math::nlerp<float, math::safe>(a, noisy_quat, mu);
+        a = math::normalized<float, math::safe>(a);
+    }
+
+    auto get_rotation() const -> math::quatf const& { return m_rotation; }
+
+private:
+    math::quatf m_rotation;
+    math::vec3f m_front;
+};
+
+constexpr float DT = 0.001f;
+constexpr size_t SAMPLE_COUNT = 300000;
+constexpr size_t WARMUP = 30000; //the errors are measured after the bias converged
+constexpr float GRAVITY = 9.80665f;
+
+struct Input
+{
+    math::vec3f angular_velocity;
+    math::vec3f acceleration;
+    math::vec3f magnetic_field;
+    math::quatf true_rotation;
+};
+
+std::vector<Input> make_flight()
+{
+    std::mt19937 rng(42);
+    std::normal_distribution<float> noise(0.f, 1.f);
+    auto noise3 = [&]() { return math::vec3f(noise(rng), noise(rng), noise(rng)); };
+
+    math::vec3f gyro_bias(0.02f, -0.015f, 0.01f);
+    math::vec3f world_magnetic_field(0.f, 0.2f, -0.45f); //north is Y, pointing down like in the northern hemisphere
+
+    std::vector<Input> inputs(SAMPLE_COUNT);
+    math::quatf rotation;
+    for (size_t i = 0; i < SAMPLE_COUNT; i++)
+    {
+        Input& input = inputs[i];
+        float t = i * DT;
+        math::vec3f omega(0.6f * std::sin(0.7f * t), 0.5f * std::sin(0.9f * t + 1.f), 0.8f * std::sin(0.3f * t + 2.f));
+
+        //exact integration of the rotation over the sample
+        float angle = math::length(omega) * DT;
+        if (angle > 0)
+        {
+            math::vec3f axis = omega * (std::sin(angle * 0.5f) / math::length(omega));
+            rotation = rotation * math::quatf(axis.x, axis.y, axis.z, std::cos(angle * 0.5f));
+            rotation = math::normalized<float, math::safe>(rotation);
+        }
+        math::quatf inv_rotation(-rotation.x, -rotation.y, -rotation.z, rotation.w);
+
+        input.true_rotation = rotation;
+        input.angular_velocity = omega + gyro_bias + noise3() * 0.01f;
+        input.acceleration = math::rotate(inv_rotation, math::vec3f(0, 0, GRAVITY)) + noise3() * 2.f;
+        input.magnetic_field = math::rotate(inv_rotation, world_magnetic_field) + noise3() * 0.02f;
+    }
+    return inputs;
+}
+
+//angle between the true and estimated local up axis, and between the true and estimated heading, in degrees
+void compute_errors(math::quatf const& estimated, math::quatf const& truth, double& tilt_error, double& heading_error)
+{
+    math::vec3f up = math::rotate(estimated, math::vec3f(0, 0, 1));
+    math::vec3f true_up = math::rotate(truth, math::vec3f(0, 0, 1));
+    tilt_error = std::acos(math::clamp(math::dot(up, true_up), -1.f, 1.f));
+
+    math::vec3f front = math::rotate(estimated, math::vec3f(0, 1, 0));
+    math::vec3f true_front = math::rotate(truth, math::vec3f(0, 1, 0));
+    double heading = std::atan2(front.x, front.y);
+    double true_heading = std::atan2(true_front.x, true_front.y);
+    heading_error = std::abs(std::remainder(heading - true_heading, 2.0 * math::angled::pi));
+
+    tilt_error = math::degrees(tilt_error);
+    heading_error = math::degrees(heading_error);
+}
+
+//one pass for the timing, one for the errors as measuring them costs more than the filters
+template<class Filter, class F>
+void bench(char const* name, std::vector<Input> const& inputs, Filter& filter, F process)
+{
+    Filter timed_filter = filter;
+    auto start = std::chrono::steady_clock::now();
+    for (Input const& input: inputs)
+    {
+        process(timed_filter, input);
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    double tilt_error = 0;
+    double heading_error = 0;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        process(filter, inputs[i]);
+        if (i >= WARMUP)
+        {
+            double tilt, heading;
+            compute_errors(filter.get_rotation(), inputs[i].true_rotation, tilt, heading);
+            tilt_error += tilt;
+            heading_error += heading;
+        }
+    }
+    size_t count = inputs.size() - WARMUP;
+    std::cout << name << ": " << ns / inputs.size() << "ns per sample, tilt error " << tilt_error / count
+              << "deg, heading error " << heading_error / count << "deg" << std::endl;
+}
+
+}
+
+int main(int, char**)
+{
+    std::vector<Input> inputs = make_flight();
+
+    Complementary_AHRS complementary;
+    bench("Complementary", inputs, complementary, [](Complementary_AHRS& filter, Input const& input)
+    {
+        filter.process(DT, 0.3f, input.angular_velocity, input.acceleration, input.magnetic_field);
+    });
+
+    silk::node::Mahony_AHRS_Filter mahony;
+    silk::node::Mahony_AHRS_Filter::Params params;
+    mahony.setup(DT, params);
+    mahony.reset(inputs[0].true_rotation);
+    bench("Mahony", inputs, mahony, [](silk::node::Mahony_AHRS_Filter& filter, Input const& input)
+    {
+        filter.process(input.angular_velocity, input.acceleration, input.magnetic_field);
+    });
+
+    return 0;
+}
@@ -0,0 +1,162 @@
+#include "utils/Butterworth.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+
+//Filters a noisy signal through the Butterworth filters used by the LPF nodes and reports the ns per sample for
+// 1 to 8 sections, next to the scalar implementation they replaced.
+//The double cascade is benched as well to show why the double types are left on the scalar code.
+//usage: bench_biquad
+
+namespace
+{
+
+//the scalar implementation before the Biquad_Cascade: coefficients in vectors, a loop over the sections and the
+// vec3f components converted to double in every section
+template<class T> void legacy_apply_coefficients(T& x, T& w0, T& w1, T& w2, double d1, double d2, double A)
+{
+    w0 = static_cast<T>(d1*w1 + d2*w2 + x);
+    x = static_cast<T>(A*(w0 + 2.0*w1 + w2));
+    w2 = w1;
+    w1 = w0;
+}
+template<> void legacy_apply_coefficients(math::vec3f& x, math::vec3f& w0, math::vec3f& w1, math::vec3f& w2, double d1, double d2, double A)
+{
+    const math::vec3d w1d(w1);
+    const math::vec3d w2d(w2);
+    const math::vec3d w0d = d1*w1d + d2*w2d + math::vec3d(x);
+    w0 = math::vec3f(w0d);
+    x = math::vec3f(A*(w0d + 2.0*w1d + w2d));
+    w2 = w1;
+    w1 = w0;
+}
+
+template<class T>
+class Legacy_Butterworth
+{
+public:
+    bool setup(size_t order, float rate, float cutoff_frequency)
+    {
+        double a = math::tan(math::angled::pi*cutoff_frequency/rate);
+        A.resize(order);
+        d1.resize(order);
+        d2.resize(order);
+        w0.assign(order, T());
+        w1.assign(order, T());
+        w2.assign(order, T());
+        for (size_t i = 0; i < order; ++i)
+        {
+            util::dsp::get_butterworth_section(i, order, a, A[i], d1[i], d2[i]);
+        }
+        return true;
+    }
+    void process(T& t)
+    {
+        for (size_t i = 0; i < A.size(); ++i)
+        {
+            legacy_apply_coefficients(t, w0[i], w1[i], w2[i], d1[i], d2[i], A[i]);
+        }
+    }
+
+private:
+    std::vector<double> A;
+    std::vector<double> d1;
+    std::vector<double> d2;
+    std::vector<T> w0;
+    std::vector<T> w1;
+    std::vector<T> w2;
+};
+
+//a Biquad_Cascade<double> with the Butterworth interface, for the vec3d values the Butterworth doesn't use it for
+class Double_Cascade
+{
+public:
+    bool setup(size_t order, float rate, float cutoff_frequency)
+    {
+        return m_cascade.setup(order, rate, cutoff_frequency);
+    }
+    void process(math::vec3d& t)
+    {
+        util::dsp::Biquad_Cascade<double>::Lanes x = { t.x, t.y, t.z, 0.0 };
+        m_cascade.process(x);
+        t.set(x[0], x[1], x[2]);
+    }
+
+private:
+    util::dsp::Biquad_Cascade<double> m_cascade;
+};
+
+constexpr float RATE = 1000.f;
+constexpr float CUTOFF = 30.f;
+constexpr size_t SAMPLE_COUNT = 1000000;
+
+template<class T> T make_value(std::mt19937& rng);
+template<> float make_value(std::mt19937& rng) { return std::normal_distribution<float>(0.f, 1.f)(rng); }
+template<> double make_value(std::mt19937& rng) { return std::normal_distribution<double>(0.0, 1.0)(rng); }
+template<> math::vec3f make_value(std::mt19937& rng) { return math::vec3f(make_value<float>(rng), make_value<float>(rng), make_value<float>(rng)); }
+template<> math::vec3d make_value(std::mt19937& rng) { return math::vec3d(make_value<double>(rng), make_value<double>(rng), make_value<double>(rng)); }
+
+double max_abs_difference(float a, float b) { return math::abs(a - b); }
+template<class V> double max_abs_difference(V const& a, V const& b)
+{
+    return std::max(std::max(math::abs(a.x - b.x), math::abs(a.y - b.y)), math::abs(a.z - b.z));
+}
+
+template<class Filter, class T>
+double bench(Filter& filter, std::vector<T> const& input, std::vector<T>& output)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        T value = input[i];
+        filter.process(value);
+        output[i] = value;
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / input.size();
+}
+
+template<class T, class Filter = util::Butterworth<T>>
+void bench_type(char const* name)
+{
+    std::mt19937 rng(42);
+    std::vector<T> input(SAMPLE_COUNT);
+    for (T& value: input)
+    {
+        value = make_value<T>(rng);
+    }
+    input[0] = T(); //so the new filter starts from the same zero state as the legacy one
+    std::vector<T> legacy_output(SAMPLE_COUNT);
+    std::vector<T> output(SAMPLE_COUNT);
+
+    std::cout << name << std::endl;
+    for (size_t order = 1; order <= 8; order++)
+    {
+        Legacy_Butterworth<T> legacy;
+        legacy.setup(order, RATE, CUTOFF);
+        double legacy_ns = bench(legacy, input, legacy_output);
+
+        Filter filter;
+        filter.setup(order, RATE, CUTOFF);
+        double ns = bench(filter, input, output);
+
+        double difference = 0;
+        for (size_t i = 0; i < SAMPLE_COUNT; i++)
+        {
+            difference = std::max(difference, max_abs_difference(legacy_output[i], output[i]));
+        }
+
+        std::cout << "  " << order << " sections: " << legacy_ns << "ns -> " << ns << "ns, speed-up " << legacy_ns / ns
+                  << ", max difference " << difference << std::endl;
+    }
+}
+
+}
+
+int main(int, char**)
+{
+    bench_type<float>("float");
+    bench_type<math::vec3f>("vec3f");
+    bench_type<math::vec3d, Double_Cascade>("vec3d, double cascade");
+    return 0;
+}
@@ -0,0 +1,162 @@
+#define QASSERT(x) ((void)0)
+
+#include "processor/KF_ECEF_Filter.h"
+#include "processor/ESKF_ECEF_Filter.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+
+//Runs the KF_ECEF filter and the ESKF_ECEF filter on the same simulated flight - a 10m circle with a climb, a biased
+// and noisy accelerometer at 1kHz, a lagged 10Hz GPS and a 50Hz baro, all resampled to 1kHz like in the node graph -
+// and reports the ns per sample and the mean position and velocity errors of both.
+//usage: bench_eskf
+
+namespace
+{
+
+using util::coordinates::ECEF;
+
+constexpr double DT = 0.001;
+constexpr size_t SAMPLE_COUNT = 120000;
+constexpr size_t GPS_PERIOD = 100;
+constexpr size_t BARO_PERIOD = 20;
+constexpr double GPS_LAG = 0.2;
+constexpr size_t WARMUP = 20000; //the errors are measured after the filters converged
+
+struct Input
+{
+    ECEF gps_position;
+    math::vec3d gps_velocity;
+    bool is_new_gps = false;
+    double baro_altitude = 0;
+    bool is_new_baro = false;
+    math::vec3f linear_acceleration;
+
+    ECEF true_position;
+    math::vec3d true_velocity;
+};
+
+std::vector<Input> make_flight()
+{
+    util::coordinates::LLA origin_lla(0.8, 0.4, 300);
+    ECEF origin = util::coordinates::lla_to_ecef(origin_lla);
+    math::mat3d enu_to_ecef = util::coordinates::enu_to_ecef_rotation(origin_lla);
+    std::mt19937 rng(42);
+    std::normal_distribution<double> noise(0.0, 1.0);
+    auto noise3 = [&]() { return math::vec3d(noise(rng), noise(rng), noise(rng)); };
+
+    double w = 2.0 * math::angled::pi / 20.0;
+    auto truth = [&](double t, ECEF& position, math::vec3d& velocity, math::vec3d& acceleration)
+    {
+        math::vec3d enu(10*std::cos(w*t), 10*std::sin(w*t), 2*std::sin(0.5*t));
+        math::vec3d enu_velocity(-10*w*std::sin(w*t), 10*w*std::cos(w*t), std::cos(0.5*t));
+        acceleration = math::vec3d(-10*w*w*std::cos(w*t), -10*w*w*std::sin(w*t), -0.5*std::sin(0.5*t));
+        position = origin + math::transform(enu_to_ecef, enu);
+        velocity = math::transform(enu_to_ecef, enu_velocity);
+    };
+
+    math::vec3d accelerometer_bias(0.2, -0.1, 0.15);
+    std::vector<Input> inputs(SAMPLE_COUNT);
+    for (size_t i = 0; i < SAMPLE_COUNT; i++)
+    {
+        Input& input = inputs[i];
+        double t = i * DT;
+        math::vec3d acceleration;
+        truth(t, input.true_position, input.true_velocity, acceleration);
+        input.linear_acceleration = math::vec3f(acceleration + accelerometer_bias + noise3() * 0.5);
+
+        if (i % GPS_PERIOD == 0)
+        {
+            ECEF position;
+            math::vec3d velocity;
+            truth(t - GPS_LAG, position, velocity, acceleration);
+            input.gps_position = position + noise3() * 1.5;
+            input.gps_velocity = velocity + noise3() * 0.1;
+            input.is_new_gps = true;
+        }
+        else
+        {
+            input.gps_position = inputs[i - 1].gps_position;
+            input.gps_velocity = inputs[i - 1].gps_velocity;
+        }
+
+        if (i % BARO_PERIOD == 0)
+        {
+            input.baro_altitude = util::coordinates::ecef_to_lla(input.true_position).altitude + 50.0 + noise(rng) * 0.3;
+            input.is_new_baro = true;
+        }
+        else
+        {
+            input.baro_altitude = inputs[i - 1].baro_altitude;
+        }
+    }
+    return inputs;
+}
+
+template<class Filter, class F>
+void bench(char const* name, std::vector<Input> const& inputs, Filter& filter, F process)
+{
+    double position_error = 0;
+    double velocity_error = 0;
+    double ns = 0;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        process(filter, inputs[i]);
+        ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+        if (i >= WARMUP)
+        {
+            position_error += math::distance(filter.get_position(), inputs[i].true_position);
+            velocity_error += math::distance(math::vec3d(filter.get_velocity()), inputs[i].true_velocity);
+        }
+    }
+    size_t count = inputs.size() - WARMUP;
+    std::cout << name << ": " << ns / inputs.size() << "ns per sample, position error " << position_error / count
+              << "m, velocity error " << velocity_error / count << "m/s" << std::endl;
+}
+
+}
+
+int main(int, char**)
+{
+    std::vector<Input> inputs = make_flight();
+
+    //KF_ECEF handles the gps lag by delaying the acceleration to match
+    silk::node::KF_ECEF_Filter kf;
+    silk::node::KF_ECEF_Filter::Params kf_params;
+    kf_params.gps_position_accuracy = 2.0;
+    kf_params.gps_velocity_accuracy = 0.2;
+    kf_params.acceleration_accuracy = 2.0;
+    kf_params.acceleration_lag = static_cast<float>(GPS_LAG);
+    kf.setup(static_cast<float>(DT), kf_params);
+    bench("KF_ECEF", inputs, kf, [](silk::node::KF_ECEF_Filter& filter, Input const& input)
+    {
+        filter.process(input.gps_position, math::vec3f(input.gps_velocity), input.linear_acceleration);
+    });
+
+    silk::node::ESKF_ECEF_Filter eskf;
+    silk::node::ESKF_ECEF_Filter::Params params;
+    params.gps_position_accuracy = 1.5;
+    params.gps_velocity_accuracy = 0.1;
+    params.baro_accuracy = 0.3;
+    params.acceleration_noise = 0.5;
+    params.gps_lag = GPS_LAG;
+    eskf.setup(DT, params);
+    eskf.reset(inputs[0].gps_position, inputs[0].gps_velocity, inputs[0].baro_altitude);
+    bench("ESKF_ECEF", inputs, eskf, [](silk::node::ESKF_ECEF_Filter& filter, Input const& input)
+    {
+        filter.predict(math::vec3d(input.linear_acceleration));
+        if (input.is_new_gps)
+        {
+            filter.fuse_gps(input.gps_position, input.gps_velocity);
+        }
+        if (input.is_new_baro)
+        {
+            filter.fuse_baro(input.baro_altitude);
+        }
+    });
+
+    return 0;
+}
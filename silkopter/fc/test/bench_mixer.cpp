@@ -0,0 +1,217 @@
+#include "processor/Motor_Allocation.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+//Runs the Motor_Mixer iterative search and the Motor_Allocation closed form mixer on the same random torque and
+// thrust targets - from hover to full saturation - on a quad, hexa and octo and reports the mean and worst case ns
+// per mix and how far the achieved roll/pitch torque, yaw torque and thrust are from the targets.
+//usage: bench_mixer
+
+namespace
+{
+
+typedef silk::IMultirotor_Properties::Motor Motor;
+
+constexpr float MOTOR_THRUST = 10.f; //N
+constexpr float MOTOR_Z_TORQUE = 0.2f; //Nm
+constexpr float ARMED_THRUST = 0.3f; //N
+constexpr float RADIUS = 0.3f; //m
+constexpr size_t TARGET_COUNT = 5000;
+constexpr size_t REPEAT_COUNT = 5; //the time of a mix is the best of a few runs, to keep the scheduler out of the worst case
+
+std::vector<Motor> create_motors(size_t count)
+{
+    std::vector<Motor> motors;
+    float angle_between_motors = math::anglef::_2pi / (float)count;
+    for (size_t i = 0; i < count; i++)
+    {
+        float angle = angle_between_motors * (i + 0.5f);
+        Motor motor;
+        motor.position = math::vec3f(std::cos(angle) * RADIUS, std::sin(angle) * RADIUS, 0.f);
+        motor.thrust_vector = math::vec3f(0, 0, 1.f);
+        motor.clockwise = (i & 1) == 0;
+        motors.push_back(motor);
+    }
+    return motors;
+}
+
+//the torque of a motor at full thrust
+math::vec3f compute_max_torque(Motor const& mc)
+{
+    return math::cross(mc.position, mc.thrust_vector * MOTOR_THRUST) + mc.thrust_vector * (MOTOR_Z_TORQUE * (mc.clockwise ? 1 : -1));
+}
+
+//Motor_Mixer::compute_throttles, up to the thrusts
+void iterative_mix(std::vector<Motor> const& motors, math::vec3f const& target, float collective_thrust, std::vector<float>& thrusts)
+{
+    constexpr float MIN_THRUST = 0.f;
+    constexpr float DYN_RANGE_FACTOR = 1.1f;
+
+    struct Out
+    {
+        math::vec3f max_torque;
+        math::vec3f torque_vector;
+        float thrust = 0;
+    };
+    std::vector<Out> outputs(motors.size());
+    for (size_t i = 0; i < motors.size(); i++)
+    {
+        outputs[i].max_torque = compute_max_torque(motors[i]);
+        outputs[i].torque_vector = math::normalized<float, math::safe>(outputs[i].max_torque);
+        outputs[i].thrust = MIN_THRUST;
+    }
+
+    float min_thrust = MIN_THRUST;
+    float max_thrust = MIN_THRUST;
+    if (collective_thrust >= 0.01f)
+    {
+        auto th = math::clamp(collective_thrust / float(outputs.size()), ARMED_THRUST, MOTOR_THRUST);
+        for (Out& out: outputs)
+        {
+            out.thrust = th;
+        }
+        float dyn_range = math::min(th - ARMED_THRUST, MOTOR_THRUST - th);
+        dyn_range *= DYN_RANGE_FACTOR;
+        min_thrust = math::max(th - dyn_range, ARMED_THRUST);
+        max_thrust = math::min(th + dyn_range, MOTOR_THRUST);
+    }
+
+    float STEP = 0.9f;
+    size_t iteration = 0;
+    math::vec3f old_crt;
+    while (true)
+    {
+        math::vec3f crt;
+        for (Out& out: outputs)
+        {
+            crt += out.max_torque * (out.thrust / MOTOR_THRUST);
+        }
+        if (iteration > 0 && math::equals(crt, old_crt, math::epsilon<float>()))
+        {
+            break;
+        }
+        old_crt = crt;
+        if (math::equals(crt, target, 0.01f))
+        {
+            break;
+        }
+        auto diff = (target - crt) / float(outputs.size());
+        for (Out& out: outputs)
+        {
+            auto f = math::dot(out.torque_vector, diff) * STEP;
+            out.thrust = math::clamp(out.thrust + f, min_thrust, max_thrust);
+        }
+        iteration++;
+        if (iteration > 50000)
+        {
+            break;
+        }
+    }
+
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        thrusts[i] = math::clamp(outputs[i].thrust, min_thrust, max_thrust);
+    }
+}
+
+struct Target
+{
+    math::vec3f torque;
+    float thrust = 0;
+};
+
+struct Stats
+{
+    double total_ns = 0;
+    double max_ns = 0;
+    double roll_pitch_error = 0;
+    double yaw_error = 0;
+    double thrust_error = 0;
+};
+
+template<class F>
+Stats bench(std::vector<Motor> const& motors, std::vector<Target> const& targets, F mix)
+{
+    Stats stats;
+    std::vector<float> thrusts(motors.size());
+    for (Target const& target: targets)
+    {
+        double ns = std::numeric_limits<double>::max();
+        for (size_t r = 0; r < REPEAT_COUNT; r++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            mix(target, thrusts);
+            ns = math::min(ns, std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+        }
+        stats.total_ns += ns;
+        stats.max_ns = math::max(stats.max_ns, ns);
+
+        math::vec3f torque;
+        float thrust = 0;
+        for (size_t i = 0; i < motors.size(); i++)
+        {
+            torque += compute_max_torque(motors[i]) * (thrusts[i] / MOTOR_THRUST);
+            thrust += thrusts[i];
+        }
+        stats.roll_pitch_error += math::length(math::vec2f(torque - target.torque));
+        stats.yaw_error += math::abs(torque.z - target.torque.z);
+        stats.thrust_error += math::abs(thrust - target.thrust);
+    }
+    return stats;
+}
+
+void print(char const* name, Stats const& stats, size_t count)
+{
+    std::cout << "    " << name << ": " << stats.total_ns / count << "ns per mix, worst " << stats.max_ns
+              << "ns, roll/pitch error " << stats.roll_pitch_error / count << "Nm, yaw error " << stats.yaw_error / count
+              << "Nm, thrust error " << stats.thrust_error / count << "N" << std::endl;
+}
+
+}
+
+int main(int, char**)
+{
+    for (size_t motor_count: { 4u, 6u, 8u })
+    {
+        std::vector<Motor> motors = create_motors(motor_count);
+
+        //moderate targets stay within the motors range, saturating ones need up to twice the roll/pitch torque a
+        // side of the frame can produce
+        for (float torque_factor: { 0.25f, 2.f })
+        {
+            std::mt19937 rng(42);
+            float max_xy_torque = MOTOR_THRUST * RADIUS * motor_count / 2.f * torque_factor;
+            float max_z_torque = MOTOR_Z_TORQUE * motor_count / 2.f * torque_factor;
+            std::uniform_real_distribution<float> xy_dist(-max_xy_torque, max_xy_torque);
+            std::uniform_real_distribution<float> z_dist(-max_z_torque, max_z_torque);
+            std::uniform_real_distribution<float> thrust_dist(0.3f, 0.7f);
+            std::vector<Target> targets(TARGET_COUNT);
+            for (Target& target: targets)
+            {
+                target.torque = math::vec3f(xy_dist(rng), xy_dist(rng), z_dist(rng));
+                target.thrust = thrust_dist(rng) * MOTOR_THRUST * motor_count;
+            }
+
+            std::cout << motor_count << " motors, " << (torque_factor < 1.f ? "moderate" : "saturating") << " targets:" << std::endl;
+
+            Stats iterative = bench(motors, targets, [&motors](Target const& target, std::vector<float>& thrusts)
+            {
+                iterative_mix(motors, target.torque, target.thrust, thrusts);
+            });
+            print("Iterative", iterative, targets.size());
+
+            silk::node::Motor_Allocation allocation;
+            allocation.setup(motors, MOTOR_THRUST, MOTOR_Z_TORQUE);
+            Stats pseudo_inverse = bench(motors, targets, [&allocation](Target const& target, std::vector<float>& thrusts)
+            {
+                allocation.solve(target.torque, target.thrust, ARMED_THRUST, MOTOR_THRUST, thrusts.data());
+            });
+            print("Pseudo inverse", pseudo_inverse, targets.size());
+        }
+    }
+
+    return 0;
+}
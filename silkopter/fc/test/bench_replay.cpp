@@ -0,0 +1,324 @@
+#include "FCStdAfx.h"
+#include "HAL.h"
+#include "RC_Comms.h"
+#include "GS_Comms.h"
+#include "Flight_Log.h"
+#include "source/Replay.h"
+#include "utils/Coordinates.h"
+#include "physics/constants.h"
+
+#include "common/stream/IAcceleration.h"
+#include "common/stream/IAngular_Velocity.h"
+#include "common/stream/IMagnetic_Field.h"
+#include "common/stream/IPosition.h"
+#include "common/stream/IVelocity.h"
+
+#include "hal.def.h"
+
+#include <asio.hpp>
+#include <iostream>
+
+//Replays a flight log as fast as possible through an AHRS + KF chain and reports the throughput in samples/s.
+//usage: bench_replay [log file]
+//Without a log file a 60 seconds flight is synthesized: an IMU at 1KHz and a GPS at 10Hz.
+//It fails if the KF doesn't output a healthy sample for most of the GPS samples - a chain that doesn't keep up with
+// the replay is not a fast chain.
+
+asio::io_service s_async_io_service;
+
+namespace silk
+{
+
+std::string s_program_path;
+
+void execute_async_call(std::function<void()> f)
+{
+    f();
+}
+
+}
+
+using namespace silk;
+
+constexpr uint32_t IMU_RATE = 1000;
+constexpr uint32_t GPS_RATE = 10;
+constexpr size_t FLIGHT_SECONDS = 60;
+
+struct Log_Stream
+{
+    std::string path;
+    stream::Type type;
+    uint32_t rate;
+};
+
+template<class Sample>
+static void write_samples(util::serialization::Buffer_t& buffer, size_t& off, uint16_t id, int64_t tp_ns, Sample const& sample)
+{
+    util::serialization::serialize(buffer, flight_log::Record::SAMPLES, off);
+    util::serialization::serialize(buffer, id, off);
+    util::serialization::serialize(buffer, tp_ns, off);
+    util::serialization::serialize(buffer, uint32_t(1), off);
+    size_t size_off = off;
+    util::serialization::serialize(buffer, uint32_t(0), off);
+    size_t samples_off = off;
+    util::serialization::serialize(buffer, sample, off);
+    //sensor samples are captured when they are sampled
+    util::serialization::serialize(buffer, stream::to_capture_tp(Clock::time_point(std::chrono::duration_cast<Clock::duration>(std::chrono::nanoseconds(tp_ns)))), off);
+    util::serialization::serialize(buffer, static_cast<uint32_t>(off - samples_off), size_off);
+}
+
+//writes the records the Recorder would write for a slow, circling flight
+static ts::Result<void> synthesize_log(std::string const& path)
+{
+    Flight_Log_Writer writer;
+    size_t const chunk_size = 256 * 1024;
+    ts::Result<void> result = writer.open(path, chunk_size, 16);
+    if (result != ts::success)
+    {
+        return result;
+    }
+
+    std::vector<Log_Stream> const streams =
+    {
+        { "imu/angular_velocity", stream::IAngular_Velocity::TYPE, IMU_RATE },
+        { "imu/acceleration", stream::IAcceleration::TYPE, IMU_RATE },
+        { "imu/magnetic_field", stream::IMagnetic_Field::TYPE, IMU_RATE },
+        { "gps/ecef_position", stream::IECEF_Position::TYPE, GPS_RATE },
+        { "gps/ecef_velocity", stream::IECEF_Velocity::TYPE, GPS_RATE },
+    };
+
+    util::coordinates::LLA const home(math::radians(45.0), math::radians(25.0), 100.0);
+    math::trans3dd enu_to_ecef, ecef_to_enu;
+    util::coordinates::enu_to_ecef_transform_and_inv(home, enu_to_ecef, ecef_to_enu);
+
+    std::mt19937 rnd;
+    std::normal_distribution<float> noise(0.f, 0.05f);
+
+    util::serialization::Buffer_t* buffer = nullptr;
+    size_t off = 0;
+    Clock::time_point first_tp;
+    Clock::time_point last_tp;
+
+    Clock::time_point start_tp = Clock::now();
+    Clock::duration const dt = std::chrono::microseconds(1000000 / IMU_RATE);
+    size_t const imu_per_gps = IMU_RATE / GPS_RATE;
+
+    for (size_t i = 0; i < FLIGHT_SECONDS * IMU_RATE; i++)
+    {
+        Clock::time_point tp = start_tp + dt * i;
+        int64_t tp_ns = flight_log::to_ns(tp);
+
+        if (buffer && off >= chunk_size - 4096)
+        {
+            writer.submit_buffer(buffer, off, first_tp, last_tp);
+            buffer = nullptr;
+        }
+        while (!buffer)
+        {
+            buffer = writer.acquire_buffer();
+            if (!buffer)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                continue;
+            }
+            off = 0;
+            first_tp = tp;
+            for (size_t s = 0; s < streams.size(); s++)
+            {
+                util::serialization::serialize(*buffer, flight_log::Record::STREAM, off);
+                util::serialization::serialize(*buffer, static_cast<uint16_t>(s), off);
+                util::serialization::serialize(*buffer, streams[s].path, off);
+                util::serialization::serialize(*buffer, streams[s].type, off);
+                util::serialization::serialize(*buffer, streams[s].rate, off);
+            }
+        }
+        last_tp = tp;
+
+        //a 20m circle every 20 seconds
+        double t = std::chrono::duration<double>(dt * i).count();
+        double w = math::anglef::_2pi / 20.0;
+        math::vec3d enu_position(20.0 * std::cos(w * t), 20.0 * std::sin(w * t), 10.0);
+        math::vec3f enu_velocity(-20.f * w * std::sin(w * t), 20.f * w * std::cos(w * t), 0.f);
+        float yaw = static_cast<float>(w * t);
+
+        stream::IAngular_Velocity::Sample angular_velocity;
+        angular_velocity.value = math::vec3f(noise(rnd), noise(rnd), static_cast<float>(w) + noise(rnd));
+        angular_velocity.is_healthy = true;
+        write_samples(*buffer, off, 0, tp_ns, angular_velocity);
+
+        stream::IAcceleration::Sample acceleration;
+        acceleration.value = physics::constants::enu_gravity + math::vec3f(noise(rnd), static_cast<float>(20.0 * w * w) + noise(rnd), noise(rnd));
+        acceleration.is_healthy = true;
+        write_samples(*buffer, off, 1, tp_ns, acceleration);
+
+        stream::IMagnetic_Field::Sample magnetic_field;
+        magnetic_field.value = math::vec3f(0.2f * std::cos(yaw), -0.2f * std::sin(yaw), -0.4f);
+        magnetic_field.is_healthy = true;
+        write_samples(*buffer, off, 2, tp_ns, magnetic_field);
+
+        if (i % imu_per_gps == 0)
+        {
+            stream::IECEF_Position::Sample position;
+            position.value = math::transform(enu_to_ecef, enu_position);
+            position.is_healthy = true;
+            write_samples(*buffer, off, 3, tp_ns, position);
+
+            stream::IECEF_Velocity::Sample velocity;
+            velocity.value = math::vec3f(math::rotate(enu_to_ecef, math::vec3d(enu_velocity)));
+            velocity.is_healthy = true;
+            write_samples(*buffer, off, 4, tp_ns, velocity);
+        }
+    }
+    if (buffer)
+    {
+        writer.submit_buffer(buffer, off, first_tp, last_tp);
+    }
+    writer.close();
+
+    if (writer.get_dropped_chunk_count() > 0)
+    {
+        return make_error("Dropped {} chunks", writer.get_dropped_chunk_count());
+    }
+    return ts::success;
+}
+
+template<class Descriptor>
+static auto make_rate_descriptor(uint32_t rate) -> std::shared_ptr<Descriptor>
+{
+    auto descriptor = std::make_shared<Descriptor>();
+    descriptor->set_rate(rate);
+    return descriptor;
+}
+
+int main(int argc, char const* argv[])
+{
+    q::logging::add_logger(q::logging::Logger_uptr(new q::logging::Console_Logger()));
+    q::logging::set_decorations(q::logging::Decorations(q::logging::Decoration::TIMESTAMP, q::logging::Decoration::LEVEL, q::logging::Decoration::TOPIC));
+
+    char dir_template[] = "/tmp/bench_replay-XXXXXX";
+    if (!mkdtemp(dir_template))
+    {
+        std::cerr << "Cannot create a temporary folder\n";
+        return 1;
+    }
+    s_program_path = dir_template;
+
+    std::string log_path;
+    if (argc > 1)
+    {
+        log_path = argv[1];
+    }
+    else
+    {
+        log_path = s_program_path + "/flight.silklog";
+        auto result = synthesize_log(log_path);
+        if (result != ts::success)
+        {
+            std::cerr << "Cannot synthesize the log: " << result.error().what() << "\n";
+            return 1;
+        }
+    }
+
+    //an empty graph, the bench builds its own
+    {
+        std::ofstream fs(s_program_path + "/settings.json");
+        fs << "{}";
+    }
+
+    HAL hal;
+    RC_Comms rc_comms(hal);
+    GS_Comms gs_comms(hal, rc_comms);
+    if (!hal.init(rc_comms, gs_comms))
+    {
+        std::cerr << "Cannot initialize the HAL\n";
+        return 1;
+    }
+
+    auto replay_descriptor = std::make_shared<hal::Replay_Descriptor>();
+    replay_descriptor->set_path(log_path);
+    replay_descriptor->set_clock(hal::Replay_Descriptor::clock_t::AS_FAST_AS_POSSIBLE);
+
+    auto resampler_descriptor = std::make_shared<hal::Resampler_Descriptor>();
+    resampler_descriptor->set_input_rate(IMU_RATE);
+    resampler_descriptor->set_output_rate(GPS_RATE);
+
+    auto transformer_descriptor = std::make_shared<hal::Transformer_Descriptor>();
+    transformer_descriptor->set_rate(IMU_RATE);
+
+    HAL::Graph_Edit edit;
+    edit.add_node("Replay", "replay", replay_descriptor);
+    edit.add_node("Comp AHRS", "ahrs", make_rate_descriptor<hal::Comp_AHRS_Descriptor>(IMU_RATE));
+    edit.add_node("Gravity Filter", "gravity", make_rate_descriptor<hal::Gravity_Filter_Descriptor>(IMU_RATE));
+    edit.add_node("Linear Acceleration (Local->ENU)", "enu_la", transformer_descriptor);
+    edit.add_node("Linear Acceleration RS (ENU)", "enu_la_rs", resampler_descriptor);
+    edit.add_node("EKF ECEF", "kf", make_rate_descriptor<hal::KF_ECEF_Descriptor>(GPS_RATE));
+
+    edit.set_input_stream_path("ahrs", 0, "replay/imu_angular_velocity");
+    edit.set_input_stream_path("ahrs", 1, "replay/imu_acceleration");
+    edit.set_input_stream_path("ahrs", 2, "replay/imu_magnetic_field");
+    edit.set_input_stream_path("gravity", 0, "ahrs/frame");
+    edit.set_input_stream_path("gravity", 1, "replay/imu_acceleration");
+    edit.set_input_stream_path("enu_la", 0, "gravity/linear_acceleration");
+    edit.set_input_stream_path("enu_la", 1, "ahrs/frame");
+    edit.set_input_stream_path("enu_la_rs", 0, "enu_la/output");
+    edit.set_input_stream_path("kf", 0, "replay/gps_ecef_position");
+    edit.set_input_stream_path("kf", 1, "replay/gps_ecef_velocity");
+    edit.set_input_stream_path("kf", 2, "enu_la_rs/output");
+
+    Clock::time_point start = Clock::now();
+
+    auto result = hal.apply_graph_edit(edit);
+    if (result != ts::success)
+    {
+        std::cerr << "Cannot build the graph: " << result.error().what() << "\n";
+        return 1;
+    }
+
+    std::shared_ptr<node::Replay> replay = hal.get_node_registry().find_by_name<node::Replay>("replay");
+    if (!replay)
+    {
+        std::cerr << "Cannot find the replay node\n";
+        return 1;
+    }
+
+    std::shared_ptr<stream::IECEF_Position> kf_position = hal.get_stream_registry().find_by_name<stream::IECEF_Position>("kf/position");
+    if (!kf_position)
+    {
+        std::cerr << "Cannot find the KF position stream\n";
+        return 1;
+    }
+
+    size_t frame_count = 0;
+    size_t kf_sample_count = 0;
+    size_t kf_healthy_sample_count = 0;
+    while (!replay->is_finished())
+    {
+        hal.process();
+        frame_count++;
+
+        for (stream::IECEF_Position::Sample const& sample: kf_position->get_samples())
+        {
+            kf_sample_count++;
+            kf_healthy_sample_count += sample.is_healthy ? 1 : 0;
+        }
+    }
+
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    uint64_t sample_count = replay->get_replayed_sample_count();
+
+    std::cout << "replayed " << sample_count << " samples in " << frame_count << " frames, " << seconds << "s\n";
+    std::cout << "throughput: " << static_cast<uint64_t>(sample_count / seconds) << " samples/s, "
+              << static_cast<uint64_t>(frame_count / seconds) << " frames/s\n";
+    std::cout << "KF: " << kf_sample_count << " samples, " << kf_healthy_sample_count << " healthy\n";
+
+    hal.shutdown();
+
+    //the KF starts once the AHRS and the resampler have their first samples, allow for that
+    size_t const min_kf_sample_count = argc > 1 ? 1 : FLIGHT_SECONDS * GPS_RATE * 9 / 10;
+    if (kf_healthy_sample_count < min_kf_sample_count)
+    {
+        std::cerr << "The KF output only " << kf_healthy_sample_count << " healthy samples, expected at least " << min_kf_sample_count << "\n";
+        return 1;
+    }
+    return 0;
+}
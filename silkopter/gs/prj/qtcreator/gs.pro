@@ -46,6 +46,11 @@ ROOT_LIBS_PATH = ../../../..
 #DEFINES += BOOST_ERROR_CODE_HEADER_ONLY
 DEFINES += ASIO_STANDALONE
 
+#the profiler zones (qbase/include/Profiler.h) are compiled in only with: qmake CONFIG+=profiler
+profiler {
+    DEFINES += __PROFILER_ENABLED__
+}
+
 rpi {
     DEFINES+=RASPBERRY_PI
     CONFIG(debug, debug|release) {
@@ -157,6 +162,8 @@ HEADERS += \
     ../../../libs/utils/comms/Channel.h \
     ../../../libs/utils/comms/RCP.h \
     ../../../libs/utils/comms/UDP_Socket.h \
+    ../../../libs/utils/Frame_Trace.h \
+    ../../../libs/utils/Thread_Registry.h \
     ../../src/QHexSpinBox.h \
     ../../src/Internal_Telemetry_Widget.h \
     ../../../libs/utils/Coordinates.h \
@@ -234,6 +241,8 @@ SOURCES += \
     ../../src/stream_viewers/video/Video_Decoder.cpp \
     ../../../libs/utils/comms/RCP.cpp \
     ../../../libs/utils/comms/UDP_Socket.cpp \
+    ../../../libs/utils/Frame_Trace.cpp \
+    ../../../libs/utils/Thread_Registry.cpp \
     ../../src/Internal_Telemetry_Widget.cpp \
     ../../../libs/utils/Coordinates.cpp \
     ../../src/simulator/Simulator.cpp \
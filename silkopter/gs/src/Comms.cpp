@@ -18,6 +18,7 @@
 #include "def_lang/IPoly_Type.h"
 #include "def_lang/IPoly_Value.h"
 
+#include "Profiler.h"
 
 using namespace silk;
 
@@ -744,6 +745,8 @@ bool Comms::Telemetry_Stream<Stream>::unpack(Telemetry_Channel& channel, size_t
 
 void Comms::handle_telemetry_stream()
 {
+    PROFILE_SCOPED_DESC("Comms::handle_telemetry_stream");
+
     std::string stream_path;
     stream::Type stream_type;
     uint32_t sample_count = 0;
@@ -789,8 +792,29 @@ void Comms::handle_telemetry_stream()
     }
 }
 
+//p50, p99, p99.9 and max in microseconds
+template<class Channel>
+static bool unpack_latency(Channel& channel, Comms::Internal_Telementry_Sample::Latency& latency)
+{
+    uint32_t p50_micros = 0, p99_micros = 0, p999_micros = 0, max_micros = 0;
+    if (!channel.unpack_param(p50_micros) ||
+        !channel.unpack_param(p99_micros) ||
+        !channel.unpack_param(p999_micros) ||
+        !channel.unpack_param(max_micros))
+    {
+        return false;
+    }
+    latency.p50 = std::chrono::microseconds(p50_micros);
+    latency.p99 = std::chrono::microseconds(p99_micros);
+    latency.p999 = std::chrono::microseconds(p999_micros);
+    latency.max = std::chrono::microseconds(max_micros);
+    return true;
+}
+
 void Comms::handle_internal_telemetry_stream()
 {
+    PROFILE_SCOPED_DESC("Comms::handle_internal_telemetry_stream");
+
     auto& channel = m_telemetry_channel;
 
     uint32_t sample_count = 0;
@@ -823,13 +847,92 @@ void Comms::handle_internal_telemetry_stream()
             Internal_Telementry_Sample::Node& node = sample.nodes[n];
             if (!channel.unpack_param(node.name) ||
                 !channel.unpack_param(micros) ||
-                !channel.unpack_param(max_micros))
+                !unpack_latency(channel, node.latency) ||
+                !channel.unpack_param(node.allocation_count) ||
+                !unpack_latency(channel, node.input_age))
             {
                 QLOGE("Error unpacking samples!!!");
                 return;
             }
             node.duration = std::chrono::microseconds(micros);
-            node.max_duration = std::chrono::microseconds(max_micros);
+        }
+
+        uint32_t branch_count;
+        if (!channel.unpack_param(branch_count))
+        {
+            QLOGE("Error unpacking samples!!!");
+            return;
+        }
+        sample.branches.resize(branch_count);
+
+        for (uint32_t b = 0; b < branch_count; b++)
+        {
+            Internal_Telementry_Sample::Branch& branch = sample.branches[b];
+            if (!channel.unpack_param(branch.name) ||
+                !channel.unpack_param(micros) ||
+                !channel.unpack_param(max_micros))
+            {
+                QLOGE("Error unpacking samples!!!");
+                return;
+            }
+            branch.duration = std::chrono::microseconds(micros);
+            branch.max_duration = std::chrono::microseconds(max_micros);
+        }
+
+        uint32_t thread_count;
+        if (!unpack_latency(channel, sample.wakeup_latency) ||
+            !channel.unpack_param(thread_count))
+        {
+            QLOGE("Error unpacking samples!!!");
+            return;
+        }
+        sample.threads.resize(thread_count);
+
+        for (uint32_t t = 0; t < thread_count; t++)
+        {
+            Internal_Telementry_Sample::Thread& thread = sample.threads[t];
+            if (!channel.unpack_param(thread.name) ||
+                !channel.unpack_param(thread.cpu_usage) ||
+                !channel.unpack_param(thread.involuntary_context_switches))
+            {
+                QLOGE("Error unpacking samples!!!");
+                return;
+            }
+        }
+
+        uint32_t bus_count;
+        if (!channel.unpack_param(bus_count))
+        {
+            QLOGE("Error unpacking samples!!!");
+            return;
+        }
+        sample.buses.resize(bus_count);
+
+        for (uint32_t b = 0; b < bus_count; b++)
+        {
+            Internal_Telementry_Sample::Bus& bus = sample.buses[b];
+            uint32_t client_count;
+            if (!channel.unpack_param(bus.name) ||
+                !channel.unpack_param(client_count))
+            {
+                QLOGE("Error unpacking samples!!!");
+                return;
+            }
+            bus.clients.resize(client_count);
+            for (Internal_Telementry_Sample::Bus::Client& client: bus.clients)
+            {
+                if (!channel.unpack_param(client.address) ||
+                    !channel.unpack_param(client.transaction_count) ||
+                    !channel.unpack_param(client.byte_count) ||
+                    !channel.unpack_param(client.error_count) ||
+                    !channel.unpack_param(client.busy_count) ||
+                    !channel.unpack_param(client.usage) ||
+                    !unpack_latency(channel, client.duration))
+                {
+                    QLOGE("Error unpacking samples!!!");
+                    return;
+                }
+            }
         }
     }
 
@@ -1758,6 +1861,8 @@ ts::Result<void> Comms::send_node_message(std::string const& name, std::shared_p
 
 void Comms::process_rcp()
 {
+    PROFILE_SCOPED_DESC("Comms::process_rcp");
+
     if (!m_rcp)
     {
         return;
@@ -1787,6 +1892,8 @@ struct Comms::Dispatch_Req_Visitor : boost::static_visitor<void>
 
 void Comms::process()
 {
+    PROFILE_SCOPED_DESC("Comms::process");
+
     if (!m_rcp)
     {
         return;
@@ -198,13 +198,53 @@ public:
     {
         Clock::duration total_duration;
         Clock::duration max_total_duration;
+        struct Latency
+        {
+            Clock::duration p50;
+            Clock::duration p99;
+            Clock::duration p999;
+            Clock::duration max;
+        };
         struct Node
         {
             std::string name;
             Clock::duration duration;
-            Clock::duration max_duration;
+            Latency latency;
+            uint32_t allocation_count = 0; //heap allocations per second
+            Latency input_age; //age of the sensor data behind the inputs, zero when unknown
         };
         std::vector<Node> nodes;
+        struct Branch
+        {
+            std::string name;
+            Clock::duration duration;
+            Clock::duration max_duration;
+        };
+        std::vector<Branch> branches;
+        Latency wakeup_latency;
+        struct Thread
+        {
+            std::string name;
+            float cpu_usage = 0; //0 - 1 of a core
+            uint32_t involuntary_context_switches = 0; //per second
+        };
+        std::vector<Thread> threads;
+        struct Bus
+        {
+            std::string name;
+            struct Client
+            {
+                uint32_t address = 0; //the I2C address, 0 for the SPI and UART buses
+                uint32_t transaction_count = 0; //per second
+                uint32_t byte_count = 0; //per second
+                uint32_t error_count = 0; //per second
+                uint32_t busy_count = 0; //per second, transactions refused because the bus was in use
+                float usage = 0; //0 - 1
+                Latency duration;
+            };
+            std::vector<Client> clients;
+        };
+        std::vector<Bus> buses;
     };
 
     boost::signals2::signal<void(std::vector<Internal_Telementry_Sample> const&)> sig_internal_telemetry_samples_available;
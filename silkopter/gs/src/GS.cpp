@@ -2,6 +2,7 @@
 
 #include "value_editors/Value_Editor_Factory.h"
 #include "utils/Clock.h"
+#include "Profiler.h"
 
 #include <QInputDialog>
 #include <QMessageBox>
@@ -171,6 +172,7 @@ void GS::process()
     if (dt >= std::chrono::milliseconds(33))
     {
         m_process_last_tp = now;
+        PROFILE_FRAME("frame");
 
         if (q::System::has_inst())
         {
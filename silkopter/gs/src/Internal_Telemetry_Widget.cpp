@@ -64,15 +64,47 @@ void Internal_Telemetry_Widget::init(silk::Comms& comms, std::vector<std::string
     Numeric_Viewer_Widget* widget = new Numeric_Viewer_Widget(this);
     widget->init("average", 10, false);
 
-    Numeric_Viewer_Widget* max_widget = new Numeric_Viewer_Widget(this);
-    max_widget->init("max", 10, false);
+    //the tail of the process duration, from the per node histograms
+    typedef Clock::duration silk::Comms::Internal_Telementry_Sample::Latency::*Percentile_Ptr;
+    std::vector<std::pair<Numeric_Viewer_Widget*, Percentile_Ptr>> latency_widgets =
+    {
+        { new Numeric_Viewer_Widget(this), &silk::Comms::Internal_Telementry_Sample::Latency::p50 },
+        { new Numeric_Viewer_Widget(this), &silk::Comms::Internal_Telementry_Sample::Latency::p99 },
+        { new Numeric_Viewer_Widget(this), &silk::Comms::Internal_Telementry_Sample::Latency::p999 },
+        { new Numeric_Viewer_Widget(this), &silk::Comms::Internal_Telementry_Sample::Latency::max },
+    };
+    latency_widgets[0].first->init("p50", 10, false);
+    latency_widgets[1].first->init("p99", 10, false);
+    latency_widgets[2].first->init("p99.9", 10, false);
+    latency_widgets[3].first->init("max", 10, false);
+
+    //heap allocations per second. Should be flat zero once the nodes warmed up
+    Numeric_Viewer_Widget* allocation_widget = new Numeric_Viewer_Widget(this);
+    allocation_widget->init("allocations", 10, false);
+
+    //how old the sensor data is when a node is done with it. For the sinks this is the sensor to actuator latency
+    std::vector<std::pair<Numeric_Viewer_Widget*, Percentile_Ptr>> input_age_widgets =
+    {
+        { new Numeric_Viewer_Widget(this), &silk::Comms::Internal_Telementry_Sample::Latency::p50 },
+        { new Numeric_Viewer_Widget(this), &silk::Comms::Internal_Telementry_Sample::Latency::p99 },
+    };
+    input_age_widgets[0].first->init("input age p50", 10, false);
+    input_age_widgets[1].first->init("input age p99", 10, false);
 
     uint32_t index = 0;
     for (std::string const& node_name: node_names)
     {
         RGB rgb = palette[index % palette.size()];
         widget->add_graph(node_name, "%", QColor(rgb.r, rgb.g, rgb.b));
-        max_widget->add_graph(node_name, "s", QColor(rgb.r, rgb.g, rgb.b));
+        for (auto const& lw: latency_widgets)
+        {
+            lw.first->add_graph(node_name, "s", QColor(rgb.r, rgb.g, rgb.b));
+        }
+        allocation_widget->add_graph(node_name, "/s", QColor(rgb.r, rgb.g, rgb.b));
+        for (auto const& aw: input_age_widgets)
+        {
+            aw.first->add_graph(node_name, "s", QColor(rgb.r, rgb.g, rgb.b));
+        }
         m_node_indices[node_name] = index;
         index++;
     }
@@ -80,36 +112,78 @@ void Internal_Telemetry_Widget::init(silk::Comms& comms, std::vector<std::string
     setLayout(new QVBoxLayout());
     layout()->setMargin(0);
     layout()->addWidget(widget);
-    layout()->addWidget(max_widget);
+    for (auto const& lw: latency_widgets)
+    {
+        layout()->addWidget(lw.first);
+    }
+    layout()->addWidget(allocation_widget);
+    for (auto const& aw: input_age_widgets)
+    {
+        layout()->addWidget(aw.first);
+    }
 
-    m_connection = m_comms->sig_internal_telemetry_samples_available.connect([this, widget, max_widget](std::vector<silk::Comms::Internal_Telementry_Sample> const& samples)
+    m_connection = m_comms->sig_internal_telemetry_samples_available.connect([this, widget, latency_widgets, allocation_widget, input_age_widgets](std::vector<silk::Comms::Internal_Telementry_Sample> const& samples)
     {
         for (silk::Comms::Internal_Telementry_Sample const& sample: samples)
         {
-            m_data.clear(); //to rest everything to 0
-            m_data.resize(std::min(m_node_count, sample.nodes.size()));
+            //the nodes come in schedule order which changes when the graph changes, so remap them by name
+            m_sample_indices.resize(sample.nodes.size());
             for (size_t i = 0; i < sample.nodes.size(); i++)
             {
                 auto it = m_node_indices.find(sample.nodes[i].name);
-                if (it != m_node_indices.end())
+                m_sample_indices[i] = it != m_node_indices.end() ? static_cast<int32_t>(it->second) : -1;
+            }
+
+            m_data.clear(); //to rest everything to 0
+            m_data.resize(m_node_count);
+            for (size_t i = 0; i < sample.nodes.size(); i++)
+            {
+                if (m_sample_indices[i] >= 0)
                 {
                     //convet the duration per second to a percent
-                    m_data[it->second] = std::chrono::duration<float>(sample.nodes[i].duration).count() * 100.f;
+                    m_data[m_sample_indices[i]] = std::chrono::duration<float>(sample.nodes[i].duration).count() * 100.f;
                 }
             }
             widget->add_samples(m_data.data(), true);
 
+            for (auto const& lw: latency_widgets)
+            {
+                m_data.clear(); //to rest everything to 0
+                m_data.resize(m_node_count);
+                for (size_t i = 0; i < sample.nodes.size(); i++)
+                {
+                    if (m_sample_indices[i] >= 0)
+                    {
+                        m_data[m_sample_indices[i]] = std::chrono::duration<float>(sample.nodes[i].latency.*lw.second).count();
+                    }
+                }
+                lw.first->add_samples(m_data.data(), true);
+            }
+
             m_data.clear(); //to rest everything to 0
-            m_data.resize(std::min(m_node_count, sample.nodes.size()));
+            m_data.resize(m_node_count);
             for (size_t i = 0; i < sample.nodes.size(); i++)
             {
-                auto it = m_node_indices.find(sample.nodes[i].name);
-                if (it != m_node_indices.end())
+                if (m_sample_indices[i] >= 0)
+                {
+                    m_data[m_sample_indices[i]] = static_cast<float>(sample.nodes[i].allocation_count);
+                }
+            }
+            allocation_widget->add_samples(m_data.data(), true);
+
+            for (auto const& aw: input_age_widgets)
+            {
+                m_data.clear(); //to rest everything to 0
+                m_data.resize(m_node_count);
+                for (size_t i = 0; i < sample.nodes.size(); i++)
                 {
-                    m_data[it->second] = std::chrono::duration_cast<std::chrono::microseconds>(sample.nodes[i].max_duration).count() / 1000000.f;
+                    if (m_sample_indices[i] >= 0)
+                    {
+                        m_data[m_sample_indices[i]] = std::chrono::duration<float>(sample.nodes[i].input_age.*aw.second).count();
+                    }
                 }
+                aw.first->add_samples(m_data.data(), true);
             }
-            max_widget->add_samples(m_data.data(), true);
         }
     });
 }
@@ -19,6 +19,7 @@ public:
 private:
     silk::Comms* m_comms = nullptr;
     std::unordered_map<std::string, uint32_t> m_node_indices;
+    std::vector<int32_t> m_sample_indices;
     std::vector<float> m_data;
     size_t m_node_count = 0;
 
@@ -3,6 +3,7 @@
 #include <QNetworkProxyFactory>
 #include <boost/thread.hpp>
 #include <asio.hpp>
+#include "Profiler.h"
 
 asio::io_service s_async_io_service(4);
 
@@ -11,6 +12,13 @@ int main(int argc, char *argv[])
     q::logging::add_logger(q::logging::Logger_uptr(new q::logging::Console_Logger()));
     q::logging::set_decorations(q::logging::Decorations(q::logging::Decoration::TIMESTAMP, q::logging::Decoration::LEVEL, q::logging::Decoration::TOPIC));
 
+#if defined(__PROFILER_ENABLED__)
+    q::profiler::Settings profiler_settings;
+    profiler_settings.trace_path = "gs_profiler_trace.json";
+    profiler_settings.summary_period = std::chrono::seconds(10);
+    q::profiler::start(profiler_settings);
+#endif
+
     std::shared_ptr<asio::io_service::work> work(new asio::io_service::work(s_async_io_service));
     boost::thread_group worker_threads;
     for(int x = 0; x < 4; ++x)
@@ -40,5 +48,7 @@ int main(int argc, char *argv[])
     work.reset();
     worker_threads.join_all();
 
+    q::profiler::stop();
+
     return res;
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "utils/hw/Bus_Stats.h"
+
 namespace silk
 {
 namespace hal
@@ -21,6 +23,9 @@ public:
 
     virtual ts::Result<void> init(hal::IBus_Descriptor const& descriptor) = 0;
     virtual std::shared_ptr<const hal::IBus_Descriptor> get_descriptor() const = 0;
+
+    //transactions of all the devices on the bus
+    virtual util::hw::Bus_Stats& get_stats() = 0;
 };
 
 }
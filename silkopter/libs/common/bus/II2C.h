@@ -14,6 +14,11 @@ public:
     virtual ~II2C_Bus() = default;
 
     virtual util::hw::II2C& get_i2c() = 0;
+
+    util::hw::Bus_Stats& get_stats() override
+    {
+        return get_i2c().get_stats();
+    }
 };
 
 }
@@ -14,6 +14,11 @@ public:
     virtual ~ISPI_Bus() = default;
 
     virtual util::hw::ISPI& get_spi() = 0;
+
+    util::hw::Bus_Stats& get_stats() override
+    {
+        return get_spi().get_stats();
+    }
 };
 
 
@@ -14,6 +14,11 @@ public:
     virtual ~IUART_Bus() = default;
 
     virtual util::hw::IUART& get_uart() = 0;
+
+    util::hw::Bus_Stats& get_stats() override
+    {
+        return get_uart().get_stats();
+    }
 };
 
 
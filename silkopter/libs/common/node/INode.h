@@ -72,6 +72,13 @@ public:
     virtual ts::Result<void> init(hal::INode_Descriptor const& descriptor) = 0;
     virtual std::shared_ptr<const hal::INode_Descriptor> get_descriptor() const = 0;
 
+    //the bus the node talks to its hardware through, empty if none. Nodes sharing a bus never run at the same time
+    virtual std::string get_bus_name() const { return std::string(); }
+
+    //an open sysfs GPIO 'value' file with an edge when the hardware has new data, -1 if the node has no data-ready line.
+    //The node owns it. The main loop wakes up on its edges instead of waiting for the next timer
+    virtual int get_data_ready_fd() const { return -1; }
+
     virtual ts::Result<void> set_config(hal::INode_Config const& config) = 0;
     virtual std::shared_ptr<const hal::INode_Config> get_config() const = 0;
 
@@ -14,7 +14,7 @@ public:
 
     typedef float                   Value; //0 .. 1
     typedef stream::Sample<Value>     Sample;
-    virtual auto get_samples() const -> std::vector<Sample> const& = 0;
+    virtual auto get_samples() const -> Sample_View<Sample> = 0;
 };
 
 
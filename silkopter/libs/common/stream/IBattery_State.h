@@ -22,7 +22,7 @@ public:
         float capacity_left = 0; //0 is Empty, 1 is Full
     };
     typedef stream::Sample<Value>     Sample;
-    virtual auto get_samples() const -> std::vector<Sample> const& = 0;
+    virtual auto get_samples() const -> Sample_View<Sample> = 0;
 };
 
 
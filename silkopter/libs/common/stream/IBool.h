@@ -14,7 +14,7 @@ public:
 
     typedef bool                    Value;
     typedef stream::Sample<Value>   Sample;
-    virtual auto get_samples() const -> std::vector<Sample> const& = 0;
+    virtual auto get_samples() const -> Sample_View<Sample> = 0;
 };
 
 
@@ -29,7 +29,7 @@ public:
 
     virtual ~ICamera_Commands() = default;
 
-    virtual auto get_samples() const -> std::vector<Sample> const& = 0;
+    virtual auto get_samples() const -> Sample_View<Sample> = 0;
 };
 
 
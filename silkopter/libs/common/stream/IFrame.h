@@ -16,7 +16,7 @@ public:
 
     typedef math::quatf Value; //local to parent. vec local * rotation == vec parent
     typedef stream::Sample<Value>     Sample;
-    virtual auto get_samples() const -> std::vector<Sample> const& = 0;
+    virtual auto get_samples() const -> Sample_View<Sample> = 0;
 
     static constexpr Space PARENT_SPACE = PARENT_SPACE_VALUE;
 };
@@ -34,7 +34,7 @@ public:
         float pdop = std::numeric_limits<float>::infinity(); //position dillution of precision
     };
     typedef stream::Sample<Value>     Sample;
-    virtual auto get_samples() const -> std::vector<Sample> const& = 0;
+    virtual auto get_samples() const -> Sample_View<Sample> = 0;
 };
 
 
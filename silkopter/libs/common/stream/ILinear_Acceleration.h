@@ -15,7 +15,7 @@ public:
 
     typedef math::vec3f       Value; //meters per second^2
     typedef stream::Sample<Value>     Sample;
-    virtual auto get_samples() const -> std::vector<Sample> const& = 0;
+    virtual auto get_samples() const -> Sample_View<Sample> = 0;
 };
 
 typedef ILinear_AccelerationT<Space::LOCAL>    ILinear_Acceleration;
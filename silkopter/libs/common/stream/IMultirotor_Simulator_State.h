@@ -49,7 +49,7 @@ public:
 
     virtual ~IMultirotor_Simulator_State() = default;
 
-    virtual auto get_samples() const -> std::vector<Sample> const& = 0;
+    virtual auto get_samples() const -> Sample_View<Sample> = 0;
 };
 
 
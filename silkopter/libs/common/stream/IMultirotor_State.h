@@ -68,7 +68,7 @@ public:
 
     virtual ~IMultirotor_State() {}
 
-    virtual std::vector<Sample> const& get_samples() const = 0;
+    virtual auto get_samples() const -> Sample_View<Sample> = 0;
 };
 
 
@@ -14,7 +14,7 @@ public:
 
     typedef double                   Value; //kilo Pascals. 1 Pascal == 0.01 millibars, 100000 Pa == 1000 mbar == 1 bar ~= sea level
     typedef stream::Sample<Value>     Sample;
-    virtual auto get_samples() const -> std::vector<Sample> const& = 0;
+    virtual auto get_samples() const -> Sample_View<Sample> = 0;
 };
 
 
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "utils/Serialization.h"
+#include "utils/Clock.h"
+#include <iterator>
 
 namespace silk
 {
@@ -137,9 +139,42 @@ public:
 
     virtual auto get_rate() const -> uint32_t = 0;
     virtual auto get_type() const -> Type = 0;
+
+    //drops the samples of the current frame. Called for the nodes skipped in a frame so their consumers don't read
+    // the samples of the last frame again
+    virtual void clear() {}
 };
 
 
+//When the sensor data a sample derives from was captured, in microseconds of the Clock.
+//It wraps every ~71 minutes so only differences are meaningful - computed with wrapping arithmetic they are correct
+// for ages up to ~35 minutes. 0 is unknown.
+typedef uint32_t Capture_Tp;
+
+inline auto to_capture_tp(Clock::time_point tp) -> Capture_Tp
+{
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(tp.time_since_epoch()).count();
+    Capture_Tp capture_tp = static_cast<Capture_Tp>(us);
+    return capture_tp != 0 ? capture_tp : 1;
+}
+
+//how old the data captured at capture_tp is at now. Negative if captured after now
+inline auto get_capture_age(Capture_Tp capture_tp, Clock::time_point now) -> Clock::duration
+{
+    int32_t us = static_cast<int32_t>(to_capture_tp(now) - capture_tp);
+    return std::chrono::microseconds(us);
+}
+
+//the older of the two, ignoring the unknown ones
+inline auto get_oldest_capture_tp(Capture_Tp a, Capture_Tp b) -> Capture_Tp
+{
+    if (a == 0 || b == 0)
+    {
+        return a | b;
+    }
+    return static_cast<int32_t>(a - b) < 0 ? a : b;
+}
+
 //A stream sample
 template<typename Value_T> struct Sample
 {
@@ -147,6 +182,59 @@ template<typename Value_T> struct Sample
 
     Value value = Value();
     bool is_healthy = false;
+    Capture_Tp capture_tp = 0; //not serialized, the telemetry and the flight logs don't carry it
+};
+
+//The samples a stream pushed in the current frame, read in place from the storage of the stream.
+//The storage is addressed with absolute indices masked by a power of two size so the range can wrap around its end.
+//It's valid until the producer runs again.
+template<typename Sample_T> class Sample_View
+{
+public:
+    typedef Sample_T Sample;
+
+    class const_iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef Sample value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef Sample const* pointer;
+        typedef Sample const& reference;
+
+        const_iterator(Sample const* data, uint64_t mask, uint64_t index) : m_data(data), m_mask(mask), m_index(index) {}
+
+        reference operator*() const { return m_data[m_index & m_mask]; }
+        pointer operator->() const { return &m_data[m_index & m_mask]; }
+        const_iterator& operator++() { m_index++; return *this; }
+        const_iterator operator++(int) { const_iterator it = *this; m_index++; return it; }
+        bool operator==(const_iterator const& other) const { return m_index == other.m_index; }
+        bool operator!=(const_iterator const& other) const { return m_index != other.m_index; }
+
+    private:
+        Sample const* m_data;
+        uint64_t m_mask;
+        uint64_t m_index;
+    };
+
+    Sample_View() = default;
+    Sample_View(Sample const* data, uint64_t mask, uint64_t begin, uint64_t end) : m_data(data), m_mask(mask), m_begin(begin), m_end(end) {}
+    //all the samples of a vector
+    Sample_View(std::vector<Sample> const& samples) : m_data(samples.data()), m_mask(~uint64_t(0)), m_begin(0), m_end(samples.size()) {}
+
+    size_t size() const { return static_cast<size_t>(m_end - m_begin); }
+    bool empty() const { return m_begin == m_end; }
+    Sample const& operator[](size_t idx) const { return m_data[(m_begin + idx) & m_mask]; }
+    Sample const& front() const { return operator[](0); }
+    Sample const& back() const { return operator[](size() - 1); }
+    const_iterator begin() const { return const_iterator(m_data, m_mask, m_begin); }
+    const_iterator end() const { return const_iterator(m_data, m_mask, m_end); }
+
+private:
+    Sample const* m_data = nullptr;
+    uint64_t m_mask = 0;
+    uint64_t m_begin = 0;
+    uint64_t m_end = 0;
 };
 
 }
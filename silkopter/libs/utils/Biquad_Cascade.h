@@ -0,0 +1,175 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <cmath>
+#include <type_traits>
+
+#include "qmath.h"
+
+namespace util
+{
+namespace dsp
+{
+
+//coefficients of the section i of a Butterworth low pass with section_count second order sections.
+//a = tan(pi * cutoff / rate)
+inline void get_butterworth_section(size_t i, size_t section_count, double a, double& A, double& d1, double& d2)
+{
+    double a2 = a*a;
+    double r = math::sin(math::angled::pi*(2.0*i+1.0)/(4.0*section_count));
+    MATH_ASSERT(!math::is_nan(r));
+    double s = a2 + 2.0*a*r + 1.0;
+    MATH_ASSERT(!math::is_nan(s));
+    A = a2/s;
+    d1 = 2.0*(1.0-a2)/s;
+    d2 = -(a2 - 2.0*a*r + 1.0)/s;
+}
+
+//A cascade of Butterworth low pass second order sections filtering up to 4 channels at once - the axes of a vector
+// go in the lanes of one register.
+//The lanes are GCC vector extensions so the same code is SSE/AVX on x86 and NEON on ARM when the target has them,
+// and plain scalar code when it doesn't.
+//Every section count up to MAX_SECTIONS has its own unrolled loop and process() switches to it.
+//The state is in Scalar, so float cascades are computed in float.
+template<class Scalar>
+class Biquad_Cascade
+{
+public:
+    static constexpr size_t MAX_SECTIONS = 8;
+    static constexpr size_t CHANNELS = 4;
+
+    typedef Scalar Lanes __attribute__((vector_size(CHANNELS * sizeof(Scalar))));
+
+    bool setup(size_t section_count, double rate, double cutoff_frequency)
+    {
+        if (section_count > MAX_SECTIONS ||
+                rate < math::epsilon<float>() ||
+                cutoff_frequency < math::epsilon<float>() ||
+                cutoff_frequency >= rate / 2.0)
+        {
+            return false;
+        }
+
+        double a = math::tan(math::angled::pi*cutoff_frequency/rate);
+        MATH_ASSERT(!math::is_nan(a));
+
+        for (size_t i = 0; i < section_count; i++)
+        {
+            double A, d1, d2;
+            get_butterworth_section(i, section_count, a, A, d1, d2);
+            m_A[i] = static_cast<Scalar>(A);
+            m_d1[i] = static_cast<Scalar>(d1);
+            m_d2[i] = static_cast<Scalar>(d2);
+            //from the rounded coefficients so it's the steady state of the recursion process() actually runs
+            m_dc_state[i] = static_cast<Scalar>(1.0 / (1.0 - static_cast<double>(m_d1[i]) - static_cast<double>(m_d2[i])));
+        }
+        m_section_count = section_count;
+        return true;
+    }
+
+    size_t get_section_count() const
+    {
+        return m_section_count;
+    }
+
+    //puts all the sections in the steady state of a constant input x, so the next outputs are x without a transient.
+    //With w0 = w1 = w2 = w the section recursion gives w = x / (1 - d1 - d2) and its output is 4*A*w.
+    void set_dc_state(Lanes x)
+    {
+        for (size_t i = 0; i < m_section_count; i++)
+        {
+            Lanes w = x*m_dc_state[i];
+            memcpy(m_w1[i], &w, sizeof(Lanes));
+            memcpy(m_w2[i], &w, sizeof(Lanes));
+            x = (w + w + w + w)*m_A[i];
+        }
+    }
+
+    //filters the lanes in place
+    void process(Lanes& x)
+    {
+        //a switch and not a function pointer so the sections get inlined in the caller
+        switch (m_section_count)
+        {
+        case 0: break;
+        case 1: process_sections<1>(x); break;
+        case 2: process_sections<2>(x); break;
+        case 3: process_sections<3>(x); break;
+        case 4: process_sections<4>(x); break;
+        case 5: process_sections<5>(x); break;
+        case 6: process_sections<6>(x); break;
+        case 7: process_sections<7>(x); break;
+        case 8: process_sections<8>(x); break;
+        default: MATH_ASSERT(false); break;
+        }
+    }
+
+private:
+    //the state is loaded and stored through memcpy as the heap doesn't guarantee the lanes alignment
+    template<size_t SECTION_COUNT>
+    void process_sections(Lanes& x)
+    {
+        for (size_t i = 0; i < SECTION_COUNT; i++)
+        {
+            Lanes w1, w2;
+            memcpy(&w1, m_w1[i], sizeof(Lanes));
+            memcpy(&w2, m_w2[i], sizeof(Lanes));
+
+            Lanes w0 = w1*m_d1[i] + w2*m_d2[i] + x;
+            x = (w0 + w1 + w1 + w2)*m_A[i];
+
+            memcpy(m_w2[i], &w1, sizeof(Lanes));
+            memcpy(m_w1[i], &w0, sizeof(Lanes));
+        }
+    }
+
+    size_t m_section_count = 0;
+
+    Scalar m_A[MAX_SECTIONS] = {};
+    Scalar m_d1[MAX_SECTIONS] = {};
+    Scalar m_d2[MAX_SECTIONS] = {};
+    Scalar m_dc_state[MAX_SECTIONS] = {}; //1 / (1 - d1 - d2)
+
+    Scalar m_w1[MAX_SECTIONS][CHANNELS] = {};
+    Scalar m_w2[MAX_SECTIONS][CHANNELS] = {};
+};
+
+//Which Butterworth value types are filtered with a Biquad_Cascade: the ones made of 1 to 4 floats.
+//The double types stay on the scalar code - NEON has no double lanes and even on x86 the double cascade is slower
+// than the scalar doubles (see fc/test/bench_biquad.cpp).
+//The lanes are built from the components directly - going through memory would stall the vector load on the
+// smaller stores of the components.
+template<class T> struct Biquad_Traits
+{
+    static constexpr bool IS_SUPPORTED = false;
+};
+struct Biquad_Float_Traits
+{
+    static constexpr bool IS_SUPPORTED = true;
+    typedef float Scalar;
+    typedef Biquad_Cascade<float>::Lanes Lanes;
+};
+template<> struct Biquad_Traits<float> : Biquad_Float_Traits
+{
+    static Lanes to_lanes(float v) { return Lanes{ v, 0.f, 0.f, 0.f }; }
+    static float from_lanes(Lanes const& x) { return x[0]; }
+};
+template<> struct Biquad_Traits<math::vec2f> : Biquad_Float_Traits
+{
+    static Lanes to_lanes(math::vec2f const& v) { return Lanes{ v.x, v.y, 0.f, 0.f }; }
+    static math::vec2f from_lanes(Lanes const& x) { return math::vec2f(x[0], x[1]); }
+};
+template<> struct Biquad_Traits<math::vec3f> : Biquad_Float_Traits
+{
+    static Lanes to_lanes(math::vec3f const& v) { return Lanes{ v.x, v.y, v.z, 0.f }; }
+    static math::vec3f from_lanes(Lanes const& x) { return math::vec3f(x[0], x[1], x[2]); }
+};
+template<> struct Biquad_Traits<math::vec4f> : Biquad_Float_Traits
+{
+    static Lanes to_lanes(math::vec4f const& v) { return Lanes{ v.x, v.y, v.z, v.w }; }
+    static math::vec4f from_lanes(Lanes const& x) { return math::vec4f(x[0], x[1], x[2], x[3]); }
+};
+
+}
+}
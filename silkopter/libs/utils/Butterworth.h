@@ -1,6 +1,9 @@
 #pragma once
 
+#include <vector>
+
 #include "qmath.h"
+#include "Biquad_Cascade.h"
 
 namespace util
 {
@@ -8,11 +11,6 @@ namespace util
 namespace dsp
 {
 
-template<class T> bool equals(T const& a, T const& b)
-{
-    return math::equals(a, b);
-}
-
 template<class T> void apply_coefficients(T& x, T& w0, T& w1, T& w2, double d1, double d2, double A)
 {
     w0 = static_cast<T>(d1*w1 + d2*w2 + x);
@@ -70,11 +68,12 @@ template<> inline void apply_coefficients(math::vec2f& x, math::vec2f& w0, math:
 
 
 
-template<class T>
+//Generic version, for the types without a Biquad_Cascade. The state is in T, computed in double.
+template<class T, class Enable = void>
 class Butterworth
 {
-    Butterworth(Butterworth<T> const&) = delete;
-    Butterworth<T>& operator=(Butterworth<T> const&) = delete;
+    Butterworth(Butterworth const&) = delete;
+    Butterworth& operator=(Butterworth const&) = delete;
 public:
     Butterworth() = default;
 
@@ -87,7 +86,6 @@ public:
             return false;
         }
         //        m_dsp.setup(poles, rate, cutoff_frequency);
-        m_rate = rate;
         m_order = order;
 
         //        printf("  n = filter order 2,4,6,...\n");
@@ -99,7 +97,6 @@ public:
         double a = math::tan(math::angled::pi*cutoff_frequency/rate);
         MATH_ASSERT(!math::is_nan(a));
 
-        double a2 = a*a;
         A.resize(m_order);
         d1.resize(m_order);
         d2.resize(m_order);
@@ -109,43 +106,24 @@ public:
 
         for(size_t i = 0; i < m_order; ++i)
         {
-            double r = math::sin(math::angled::pi*(2.0*i+1.0)/(4.0*m_order));
-            MATH_ASSERT(!math::is_nan(r));
-            double s = a2 + 2.0*a*r + 1.0;
-            MATH_ASSERT(!math::is_nan(s));
-            A[i] = a2/s;
-            d1[i] = 2.0*(1.0-a2)/s;
-            d2[i] = -(a2 - 2.0*a*r + 1.0)/s;
+            dsp::get_butterworth_section(i, m_order, a, A[i], d1[i], d2[i]);
         }
 
         return true;
     }
 
+    //sets the sections to the steady state of a constant input t, computed from the coefficients (see Biquad_Cascade::set_dc_state)
     void reset(T const& t)
     {
+        T x = t;
         for(size_t i = 0; i < m_order; ++i)
         {
-            w0[i] = t;
-            w1[i] = t;
-            w2[i] = t;
-        }
-        for (size_t i = 0; i < static_cast<size_t>(m_rate) * 100; i++)
-        {
-            T copy = t;
-            process(copy);
-            process(copy);
-            process(copy);
-            process(copy);
-            process(copy);
-            process(copy);
-            process(copy);
-            process(copy);
-            process(copy);
-            process(copy);
-            if (dsp::equals(copy, t))
-            {
-                break;
-            }
+            T w = static_cast<T>(x * (1.0 / (1.0 - d1[i] - d2[i])));
+            MATH_ASSERT(math::is_finite(w));
+            w0[i] = w;
+            w1[i] = w;
+            w2[i] = w;
+            x = static_cast<T>(A[i]*4.0*w);
         }
     }
     void reset()
@@ -171,7 +149,6 @@ public:
 
 private:
     size_t m_order = 0;
-    float m_rate = 0;
     bool m_needs_reset = true;
     std::vector<double> A;
     std::vector<double> d1;
@@ -182,6 +159,55 @@ private:
     T m_last;
 };
 
+//The float based types (float, vec2f, vec3f, vec4f) are filtered with a Biquad_Cascade, all the components at once
+template<class T>
+class Butterworth<T, typename std::enable_if<dsp::Biquad_Traits<T>::IS_SUPPORTED>::type>
+{
+    Butterworth(Butterworth const&) = delete;
+    Butterworth& operator=(Butterworth const&) = delete;
+
+    typedef dsp::Biquad_Traits<T> Traits;
+    typedef dsp::Biquad_Cascade<typename Traits::Scalar> Cascade;
+
+public:
+    Butterworth() = default;
+
+    //order is the number of second order sections, up to Cascade::MAX_SECTIONS
+    bool setup(size_t order, float rate, float cutoff_frequency)
+    {
+        return m_cascade.setup(order, rate, cutoff_frequency);
+    }
+
+    void reset(T const& t)
+    {
+        m_cascade.set_dc_state(Traits::to_lanes(t));
+    }
+    void reset()
+    {
+        auto t = m_last; //need to make a copy as reset will change it
+        MATH_ASSERT(math::is_finite(t));
+        reset(t);
+    }
+
+    void process(T& t)
+    {
+        if (m_needs_reset)
+        {
+            m_needs_reset = false;
+            reset(t);
+        }
+        typename Cascade::Lanes x = Traits::to_lanes(t);
+        m_cascade.process(x);
+        t = Traits::from_lanes(x);
+        m_last = t;
+    }
+
+private:
+    bool m_needs_reset = true;
+    Cascade m_cascade;
+    T m_last = T();
+};
+
 
 
 }
@@ -9,6 +9,8 @@
 #include <cstring>
 #include "Pool.h"
 #include "utils/fec.h"
+#include "utils/Thread_Registry.h"
+#include "Profiler.h"
 
 static constexpr unsigned BLOCK_NUMS[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
                                            10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
@@ -308,6 +310,8 @@ Fec_Encoder::Descriptor const& Fec_Encoder::get_descriptor() const
 
 void Fec_Encoder::tx_thread_proc()
 {
+    util::Thread_Registry::register_current_thread("fec tx");
+
     TX& tx = m_impl->tx;
 
     while (!m_exit)
@@ -331,7 +335,7 @@ void Fec_Encoder::tx_thread_proc()
         {
             if (1)
             {
-                //auto start = Clock::now();
+                PROFILE_SCOPED_DESC("fec encode");
 
                 //init data for the fec_encode
                 for (size_t i = 0; i < m_coding_k; i++)
@@ -462,6 +466,8 @@ static size_t s_last_seq_number = 0;
 
 void Fec_Encoder::rx_thread_proc()
 {
+    util::Thread_Registry::register_current_thread("fec rx");
+
     RX& rx = m_impl->rx;
 
     while (!m_exit)
@@ -602,7 +608,7 @@ void Fec_Encoder::rx_thread_proc()
             if (block->datagrams.size() + block->fec_datagrams.size() >= m_coding_k)
             {
                 //printf("Complete FEC block\n");
-                //auto start = Clock::now();
+                PROFILE_SCOPED_DESC("fec decode");
 
                 std::array<unsigned int, 32> indices;
                 size_t primary_index = 0;
@@ -0,0 +1,172 @@
+#include "Frame_Trace.h"
+#include "Log.h"
+
+#include <mutex>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <limits>
+
+namespace util
+{
+
+std::array<Frame_Trace::Event, Frame_Trace::EVENT_COUNT> Frame_Trace::s_events;
+std::atomic<uint64_t> Frame_Trace::s_write_index = { 0 };
+std::atomic_bool Frame_Trace::s_is_frozen = { false };
+thread_local int Frame_Trace::s_thread_index = -1;
+
+static std::mutex s_names_mutex;
+static std::vector<std::string> s_names;
+static std::vector<std::string> s_thread_names;
+
+static std::string escape_json(std::string const& str)
+{
+    std::string result;
+    result.reserve(str.size());
+    for (char ch: str)
+    {
+        if (ch == '"' || ch == '\\')
+        {
+            result.push_back('\\');
+        }
+        result.push_back(ch < ' ' ? ' ' : ch);
+    }
+    return result;
+}
+
+Frame_Trace::Name_Id Frame_Trace::register_name(std::string const& name)
+{
+    std::lock_guard<std::mutex> lg(s_names_mutex);
+    auto it = std::find(s_names.begin(), s_names.end(), name);
+    if (it != s_names.end())
+    {
+        return static_cast<Name_Id>(std::distance(s_names.begin(), it));
+    }
+    if (s_names.size() >= std::numeric_limits<Name_Id>::max())
+    {
+        QLOGW("Too many frame trace names, '{}' will show as '{}'", name, s_names.back());
+        return static_cast<Name_Id>(s_names.size() - 1);
+    }
+    s_names.push_back(name);
+    return static_cast<Name_Id>(s_names.size() - 1);
+}
+
+uint8_t Frame_Trace::register_thread()
+{
+    std::lock_guard<std::mutex> lg(s_names_mutex);
+    if (s_thread_names.size() > std::numeric_limits<uint8_t>::max())
+    {
+        return std::numeric_limits<uint8_t>::max();
+    }
+    s_thread_names.push_back("thread " + std::to_string(s_thread_names.size()));
+    return static_cast<uint8_t>(s_thread_names.size() - 1);
+}
+
+void Frame_Trace::set_thread_name(std::string const& name)
+{
+    if (s_thread_index < 0)
+    {
+        s_thread_index = register_thread();
+    }
+    std::lock_guard<std::mutex> lg(s_names_mutex);
+    s_thread_names[s_thread_index] = name;
+}
+
+bool Frame_Trace::freeze()
+{
+    return s_is_frozen.exchange(true) == false;
+}
+
+ts::Result<void> Frame_Trace::dump(std::string const& path)
+{
+    QLOG_TOPIC("frame_trace::dump");
+
+    if (!s_is_frozen)
+    {
+        return ts::Error("The frame trace is not frozen");
+    }
+
+    //copy the events out so the ring can resume as soon as possible
+    struct Dump_Event
+    {
+        int64_t time_ns;
+        Name_Id name;
+        Phase phase;
+        uint8_t thread;
+    };
+    std::vector<Dump_Event> events;
+    events.reserve(EVENT_COUNT);
+
+    uint64_t write_index = s_write_index.load();
+    uint64_t start_index = write_index > EVENT_COUNT ? write_index - EVENT_COUNT : 0;
+    for (uint64_t index = start_index; index < write_index; index++)
+    {
+        Event const& event = s_events[index & (EVENT_COUNT - 1)];
+        if (event.sequence.load(std::memory_order_acquire) != index + 1)
+        {
+            continue; //still being written when the ring froze
+        }
+        Dump_Event de = { event.time_ns, event.name, event.phase, event.thread };
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (event.sequence.load(std::memory_order_relaxed) == index + 1)
+        {
+            events.push_back(de);
+        }
+    }
+
+    std::vector<std::string> names;
+    std::vector<std::string> thread_names;
+    {
+        std::lock_guard<std::mutex> lg(s_names_mutex);
+        names = s_names;
+        thread_names = s_thread_names;
+    }
+
+    s_is_frozen = false;
+
+    if (events.empty())
+    {
+        return ts::Error("No events recorded");
+    }
+
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file)
+    {
+        return ts::Error("Cannot open " + path + ": " + strerror(errno));
+    }
+
+    fprintf(file, "{\"traceEvents\":[\n");
+    for (size_t i = 0; i < thread_names.size(); i++)
+    {
+        fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":\"%s\"}},\n",
+                static_cast<int>(i), escape_json(thread_names[i]).c_str());
+    }
+
+    //threads can record slightly out of order
+    int64_t first_ns = std::min_element(events.begin(), events.end(), [](Dump_Event const& a, Dump_Event const& b) { return a.time_ns < b.time_ns; })->time_ns;
+    for (size_t i = 0; i < events.size(); i++)
+    {
+        Dump_Event const& event = events[i];
+        std::string const& name = event.name < names.size() ? names[event.name] : std::string("?");
+        fprintf(file, "{\"name\":\"%s\",\"ph\":\"%s\",\"ts\":%.3f,\"pid\":0,\"tid\":%d}%s\n",
+                escape_json(name).c_str(),
+                event.phase == Phase::BEGIN ? "B" : "E",
+                static_cast<double>(event.time_ns - first_ns) / 1000.0,
+                static_cast<int>(event.thread),
+                i + 1 < events.size() ? "," : "");
+    }
+    fprintf(file, "]}\n");
+
+    bool ok = ferror(file) == 0;
+    fclose(file);
+    if (!ok)
+    {
+        return ts::Error("Cannot write " + path);
+    }
+
+    QLOGI("Wrote {} frame trace events to {}", events.size(), path);
+    return ts::success;
+}
+
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <atomic>
+#include <array>
+#include <string>
+
+#include "Clock.h"
+#include "def_lang/Result.h"
+
+namespace util
+{
+
+//Always-on recorder of begin/end events - node processing, bus transfers, comms.
+//All the threads record in one global ring holding the last EVENT_COUNT events, so a busy thread can push the older
+// events of a quieter one out of the dump.
+//Recording is a timestamp, one atomic increment and a store in a fixed ring so it can stay on in flight.
+//When a frame misses its deadline the ring is frozen and written as a Chrome trace (chrome://tracing) to see what
+// happened in the frames leading up to it.
+class Frame_Trace
+{
+public:
+    typedef uint16_t Name_Id;
+    static constexpr size_t EVENT_COUNT = 1 << 16;
+
+    //Not real-time safe. Register names when creating nodes, buses and threads, not while processing.
+    //Registering the same name twice returns the same id.
+    static Name_Id register_name(std::string const& name);
+    static void set_thread_name(std::string const& name);
+
+    static void begin(Name_Id name, Clock::time_point tp);
+    static void end(Name_Id name, Clock::time_point tp);
+
+    //stops recording. Returns false if already frozen - a dump is in progress
+    static bool freeze();
+
+    //writes the frozen ring as chrome trace json and resumes recording
+    static ts::Result<void> dump(std::string const& path);
+
+    class Scope
+    {
+    public:
+        Scope(Name_Id name) : m_name(name) { begin(m_name, Clock::now()); }
+        ~Scope() { end(m_name, Clock::now()); }
+    private:
+        Name_Id m_name;
+    };
+
+private:
+    enum class Phase : uint8_t
+    {
+        BEGIN,
+        END
+    };
+
+    struct Event
+    {
+        std::atomic<uint64_t> sequence = { 0 }; //index + 1 when the event is complete, 0 while it's written
+        int64_t time_ns = 0;
+        Name_Id name = 0;
+        Phase phase = Phase::BEGIN;
+        uint8_t thread = 0;
+    };
+
+    static void add_event(Name_Id name, Phase phase, Clock::time_point tp);
+    static uint8_t register_thread();
+
+    static std::array<Event, EVENT_COUNT> s_events;
+    static std::atomic<uint64_t> s_write_index;
+    static std::atomic_bool s_is_frozen;
+    static thread_local int s_thread_index;
+};
+
+inline void Frame_Trace::add_event(Name_Id name, Phase phase, Clock::time_point tp)
+{
+    if (s_is_frozen.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+    if (s_thread_index < 0)
+    {
+        s_thread_index = register_thread();
+    }
+
+    uint64_t index = s_write_index.fetch_add(1, std::memory_order_relaxed);
+    Event& event = s_events[index & (EVENT_COUNT - 1)];
+    event.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    event.time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(tp.time_since_epoch()).count();
+    event.name = name;
+    event.phase = phase;
+    event.thread = static_cast<uint8_t>(s_thread_index);
+    event.sequence.store(index + 1, std::memory_order_release);
+}
+
+inline void Frame_Trace::begin(Name_Id name, Clock::time_point tp)
+{
+    add_event(name, Phase::BEGIN, tp);
+}
+inline void Frame_Trace::end(Name_Id name, Clock::time_point tp)
+{
+    add_event(name, Phase::END, tp);
+}
+
+}
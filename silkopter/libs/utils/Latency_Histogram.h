@@ -0,0 +1,101 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+#include "Clock.h"
+
+namespace util
+{
+
+//HDR style histogram of durations.
+//Each power of 2 of nanoseconds is split in SUB_BUCKET_COUNT linear buckets so the relative error is below 1/SUB_BUCKET_COUNT
+// for any duration and adding a sample is a few bit operations - no allocations, no search.
+//Durations over ~4s are clamped.
+class Latency_Histogram
+{
+public:
+    static constexpr size_t SUB_BUCKET_BITS = 3;
+    static constexpr size_t SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+    static constexpr size_t BUCKET_COUNT = (32 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+    void add(Clock::duration d)
+    {
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+        uint32_t value = ns <= 0 ? 0u : static_cast<uint32_t>(std::min<int64_t>(ns, std::numeric_limits<uint32_t>::max()));
+        m_buckets[get_bucket_index(value)]++;
+        m_count++;
+        m_max = std::max(m_max, value);
+    }
+
+    void add(Latency_Histogram const& other)
+    {
+        for (size_t i = 0; i < BUCKET_COUNT; i++)
+        {
+            m_buckets[i] += other.m_buckets[i];
+        }
+        m_count += other.m_count;
+        m_max = std::max(m_max, other.m_max);
+    }
+
+    void clear()
+    {
+        m_buckets.fill(0);
+        m_count = 0;
+        m_max = 0;
+    }
+
+    uint32_t get_count() const { return m_count; }
+    Clock::duration get_max() const { return std::chrono::nanoseconds(m_max); }
+
+    //returns the upper bound of the bucket holding the percentile (0..1), never more than the max
+    Clock::duration get_percentile(float percentile) const
+    {
+        if (m_count == 0)
+        {
+            return Clock::duration(0);
+        }
+        uint64_t target = static_cast<uint64_t>(std::ceil(static_cast<double>(m_count) * std::min(std::max(percentile, 0.f), 1.f)));
+        target = std::max<uint64_t>(target, 1);
+
+        uint64_t accumulated = 0;
+        for (size_t i = 0; i < BUCKET_COUNT; i++)
+        {
+            accumulated += m_buckets[i];
+            if (accumulated >= target)
+            {
+                uint64_t upper = (i + 1 < BUCKET_COUNT) ? get_bucket_start(i + 1) - 1 : m_max;
+                return std::chrono::nanoseconds(std::min<uint64_t>(upper, m_max));
+            }
+        }
+        return get_max();
+    }
+
+    static size_t get_bucket_index(uint32_t value)
+    {
+        if (value < SUB_BUCKET_COUNT)
+        {
+            return value;
+        }
+        uint32_t msb = 31 - __builtin_clz(value);
+        uint32_t octave = msb - SUB_BUCKET_BITS + 1;
+        uint32_t sub_bucket = (value >> (msb - SUB_BUCKET_BITS)) & (SUB_BUCKET_COUNT - 1);
+        return octave * SUB_BUCKET_COUNT + sub_bucket;
+    }
+    static uint64_t get_bucket_start(size_t index)
+    {
+        uint64_t octave = index / SUB_BUCKET_COUNT;
+        uint64_t sub_bucket = index % SUB_BUCKET_COUNT;
+        return octave == 0 ? sub_bucket : (SUB_BUCKET_COUNT + sub_bucket) << (octave - 1);
+    }
+
+private:
+    std::array<uint32_t, BUCKET_COUNT> m_buckets = {};
+    uint32_t m_count = 0;
+    uint32_t m_max = 0;
+};
+
+}
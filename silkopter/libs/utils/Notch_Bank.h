@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+
+#include "qmath.h"
+#include "Biquad_Cascade.h"
+
+namespace util
+{
+namespace dsp
+{
+
+//A bank of up to MAX_NOTCHES notch biquads in series whose center frequencies can be moved every sample, filtering
+// up to 4 channels at once in the lanes of a Biquad_Cascade.
+//The notches are transposed direct form II so retuning one doesn't scale its state by the new coefficients.
+//A disabled notch passes the signal through unchanged.
+template<class Scalar>
+class Notch_Bank
+{
+public:
+    static constexpr size_t MAX_NOTCHES = 4;
+    static constexpr size_t CHANNELS = Biquad_Cascade<Scalar>::CHANNELS;
+
+    typedef typename Biquad_Cascade<Scalar>::Lanes Lanes;
+
+    bool setup(size_t notch_count)
+    {
+        if (notch_count > MAX_NOTCHES)
+        {
+            return false;
+        }
+        m_notch_count = notch_count;
+        for (size_t i = 0; i < MAX_NOTCHES; i++)
+        {
+            disable_notch(i);
+        }
+        memset(m_s1, 0, sizeof(m_s1));
+        memset(m_s2, 0, sizeof(m_s2));
+        return true;
+    }
+
+    size_t get_notch_count() const
+    {
+        return m_notch_count;
+    }
+
+    //q is the center frequency divided by the -3dB bandwidth
+    bool set_notch(size_t i, double rate, double frequency, double q)
+    {
+        if (i >= m_notch_count ||
+                frequency < math::epsilon<float>() ||
+                frequency >= rate / 2.0 ||
+                q < math::epsilon<float>())
+        {
+            return false;
+        }
+
+        double w0 = 2.0 * math::angled::pi * frequency / rate;
+        double alpha = math::sin(w0) / (2.0 * q);
+        double a0 = 1.0 + alpha;
+        m_b0[i] = static_cast<Scalar>(1.0 / a0);
+        m_b1[i] = static_cast<Scalar>(-2.0 * math::cos(w0) / a0);
+        m_b2[i] = m_b0[i];
+        m_a1[i] = m_b1[i];
+        m_a2[i] = static_cast<Scalar>((1.0 - alpha) / a0);
+        return true;
+    }
+    void disable_notch(size_t i)
+    {
+        m_b0[i] = Scalar(1);
+        m_b1[i] = m_b2[i] = m_a1[i] = m_a2[i] = Scalar(0);
+    }
+
+    //filters the lanes in place.
+    //the state is loaded and stored through memcpy as the heap doesn't guarantee the lanes alignment
+    void process(Lanes& x)
+    {
+        for (size_t i = 0; i < m_notch_count; i++)
+        {
+            Lanes s1, s2;
+            memcpy(&s1, m_s1[i], sizeof(Lanes));
+            memcpy(&s2, m_s2[i], sizeof(Lanes));
+
+            Lanes y = x*m_b0[i] + s1;
+            s1 = x*m_b1[i] - y*m_a1[i] + s2;
+            s2 = x*m_b2[i] - y*m_a2[i];
+            x = y;
+
+            memcpy(m_s1[i], &s1, sizeof(Lanes));
+            memcpy(m_s2[i], &s2, sizeof(Lanes));
+        }
+    }
+
+private:
+    size_t m_notch_count = 0;
+
+    Scalar m_b0[MAX_NOTCHES] = {};
+    Scalar m_b1[MAX_NOTCHES] = {};
+    Scalar m_b2[MAX_NOTCHES] = {};
+    Scalar m_a1[MAX_NOTCHES] = {};
+    Scalar m_a2[MAX_NOTCHES] = {};
+
+    Scalar m_s1[MAX_NOTCHES][CHANNELS] = {};
+    Scalar m_s2[MAX_NOTCHES][CHANNELS] = {};
+};
+
+}
+}
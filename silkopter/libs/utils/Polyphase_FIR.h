@@ -0,0 +1,203 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "qmath.h"
+
+namespace util
+{
+namespace dsp
+{
+
+//the taps are in the precision of the values: float for the float types, double for the double ones
+template<class T> struct FIR_Scalar { typedef double type; };
+template<> struct FIR_Scalar<float> { typedef float type; };
+template<> struct FIR_Scalar<math::vec2f> { typedef float type; };
+template<> struct FIR_Scalar<math::vec3f> { typedef float type; };
+template<> struct FIR_Scalar<math::vec4f> { typedef float type; };
+
+//Resamples by the rational ratio output_rate / input_rate = L / M with a windowed sinc low pass split in L phases.
+//Conceptually the input is upsampled by L (zeros in between), low passed at the prototype rate L * input_rate and
+// decimated by M - but an output only needs the taps of its phase over the real input samples, so each output costs
+// get_taps_per_phase() multiply-adds and the outputs that are skipped cost nothing.
+//The taps of every phase are contiguous and normalized to a unity DC gain so a constant input gives the same constant
+// on all the phases, without a ripple at the input rate.
+//The filter has a linear phase, with a delay of zero_crossings * max(L, M) / L input samples.
+//Nothing is allocated after setup.
+template<class T>
+class Polyphase_FIR
+{
+public:
+    typedef typename FIR_Scalar<T>::type Scalar;
+
+    //the biggest prototype filter setup accepts, rate ratios that reduce to big L or M need too many taps
+    static constexpr size_t MAX_TAPS = 16384;
+
+    //cutoff_frequency is the low pass cutoff, below half of the smaller rate.
+    //zero_crossings is the number of sinc zero crossings on each side of the center - the longer the filter the sharper
+    // the transition band and the bigger the delay.
+    bool setup(uint32_t input_rate, uint32_t output_rate, float cutoff_frequency, size_t zero_crossings)
+    {
+        if (input_rate == 0 || output_rate == 0 || zero_crossings == 0 ||
+                cutoff_frequency < math::epsilon<float>() ||
+                cutoff_frequency >= math::min(input_rate, output_rate) / 2.f)
+        {
+            return false;
+        }
+
+        uint32_t g = gcd(input_rate, output_rate);
+        size_t L = output_rate / g;
+        size_t M = input_rate / g;
+
+        size_t taps_per_phase = (2 * zero_crossings * math::max(L, M) + L - 1) / L;
+        size_t tap_count = taps_per_phase * L;
+        if (tap_count > MAX_TAPS)
+        {
+            return false;
+        }
+
+        m_L = L;
+        m_M = M;
+        m_taps_per_phase = taps_per_phase;
+
+        //blackman windowed sinc at the prototype rate
+        double prototype_rate = static_cast<double>(L) * input_rate;
+        double fc = 2.0 * cutoff_frequency / prototype_rate;
+        double center = (tap_count - 1) / 2.0;
+        std::vector<double> prototype(tap_count);
+        for (size_t i = 0; i < tap_count; i++)
+        {
+            double x = i - center;
+            double sinc = math::is_zero(x) ? fc : math::sin(math::angled::pi * fc * x) / (math::angled::pi * x);
+            double w = 2.0 * math::angled::pi * i / (tap_count - 1);
+            double window = 0.42 - 0.5 * math::cos(w) + 0.08 * math::cos(2.0 * w);
+            prototype[i] = sinc * window;
+        }
+
+        //tap k of phase p is the prototype tap p + k*L, the one applied to the input sample k steps back
+        m_taps.resize(tap_count);
+        for (size_t p = 0; p < L; p++)
+        {
+            double sum = 0;
+            for (size_t k = 0; k < taps_per_phase; k++)
+            {
+                sum += prototype[p + k * L];
+            }
+            for (size_t k = 0; k < taps_per_phase; k++)
+            {
+                m_taps[p * taps_per_phase + k] = static_cast<Scalar>(prototype[p + k * L] / sum);
+            }
+        }
+
+        //the history holds the taps of the oldest output that can be pending and the inputs pushed after it
+        size_t capacity = 1;
+        while (capacity < taps_per_phase + M + 64)
+        {
+            capacity <<= 1;
+        }
+        m_history.resize(capacity);
+        m_history_mask = capacity - 1;
+
+        reset(T());
+        return true;
+    }
+
+    size_t get_taps_per_phase() const
+    {
+        return m_taps_per_phase;
+    }
+
+    //fills the history with the steady state of a constant input
+    void reset(T const& t)
+    {
+        std::fill(m_history.begin(), m_history.end(), t);
+        m_input_count = m_history.size();
+        m_output_pos = m_input_count * m_L; //the next output is on the next input
+    }
+
+    void push(T const& t)
+    {
+        m_history[m_input_count & m_history_mask] = t;
+        m_input_count++;
+
+        //if the outputs are not taken the history would wrap over their inputs, skip them instead
+        uint64_t next_input_index = get_next_input_index();
+        if (next_input_index < m_input_count &&
+                m_input_count - next_input_index > m_history.size() - m_taps_per_phase)
+        {
+            m_output_pos = (m_input_count - 1) * m_L;
+        }
+    }
+
+    //computes the next output, false if it needs more input
+    bool get(T& t)
+    {
+        uint64_t input_index = get_next_input_index();
+        if (input_index >= m_input_count)
+        {
+            return false;
+        }
+
+        Scalar const* taps = m_taps.data() + (m_output_pos % m_L) * m_taps_per_phase;
+        T acc = m_history[input_index & m_history_mask] * taps[0];
+        for (size_t k = 1; k < m_taps_per_phase; k++)
+        {
+            acc += m_history[(input_index - k) & m_history_mask] * taps[k];
+        }
+        t = acc;
+
+        m_output_pos += m_M;
+        return true;
+    }
+
+    //how many outputs can be computed with the inputs pushed so far
+    size_t get_ready_count() const
+    {
+        uint64_t end_pos = m_input_count * m_L;
+        return end_pos > m_output_pos ? static_cast<size_t>((end_pos - m_output_pos + m_M - 1) / m_M) : 0;
+    }
+
+    //drops the oldest ready outputs, without computing them, so at most max_ready are left
+    void skip_ready(size_t max_ready)
+    {
+        size_t ready = get_ready_count();
+        if (ready > max_ready)
+        {
+            m_output_pos += (ready - max_ready) * m_M;
+        }
+    }
+
+private:
+    static uint32_t gcd(uint32_t a, uint32_t b)
+    {
+        while (b != 0)
+        {
+            uint32_t t = a % b;
+            a = b;
+            b = t;
+        }
+        return a;
+    }
+
+    //the newest input sample the next output uses
+    uint64_t get_next_input_index() const
+    {
+        return m_output_pos / m_L;
+    }
+
+    size_t m_L = 1;
+    size_t m_M = 1;
+    size_t m_taps_per_phase = 0;
+    std::vector<Scalar> m_taps;
+
+    std::vector<T> m_history;
+    uint64_t m_history_mask = 0;
+    uint64_t m_input_count = 0;
+    uint64_t m_output_pos = 0; //position of the next output at the prototype rate, n * M
+};
+
+}
+}
@@ -0,0 +1,205 @@
+#include "Thread_Registry.h"
+#include "Frame_Trace.h"
+#include "Log.h"
+#include "Profiler.h"
+
+#include <mutex>
+#include <map>
+#include <thread>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+namespace util
+{
+
+struct Thread
+{
+    std::string name;
+    pid_t tid = 0;
+};
+
+static std::mutex s_mutex;
+static std::vector<Thread> s_threads;
+static std::map<std::string, Thread_Registry::Profile> s_profiles;
+
+static int get_native_policy(Thread_Registry::Policy policy)
+{
+    switch (policy)
+    {
+    case Thread_Registry::Policy::BATCH: return SCHED_BATCH;
+    case Thread_Registry::Policy::IDLE: return SCHED_IDLE;
+    case Thread_Registry::Policy::FIFO: return SCHED_FIFO;
+    case Thread_Registry::Policy::RR: return SCHED_RR;
+    default: return SCHED_OTHER;
+    }
+}
+
+//by tid and not pthread_t so it's safe to call for threads that exited in the meantime
+static void apply_profile(Thread const& thread, Thread_Registry::Profile const& profile)
+{
+    int policy = get_native_policy(profile.policy);
+    struct sched_param param;
+    param.sched_priority = 0;
+    if (policy == SCHED_FIFO || policy == SCHED_RR)
+    {
+        param.sched_priority = std::max(std::min(profile.priority, sched_get_priority_max(policy)), sched_get_priority_min(policy));
+    }
+    if (sched_setscheduler(thread.tid, policy, &param) != 0)
+    {
+        QLOGW("Cannot set the scheduling of thread '{}': {}", thread.name, strerror(errno));
+    }
+
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    size_t core_count = std::max(std::thread::hardware_concurrency(), 1u);
+    for (uint32_t cpu: profile.cpus)
+    {
+        if (cpu < core_count)
+        {
+            CPU_SET(cpu, &cpuset);
+        }
+        else
+        {
+            QLOGW("Thread '{}' cannot run on core {}, there are only {}", thread.name, cpu, core_count);
+        }
+    }
+    if (CPU_COUNT(&cpuset) == 0)
+    {
+        for (size_t cpu = 0; cpu < core_count; cpu++)
+        {
+            CPU_SET(cpu, &cpuset);
+        }
+    }
+    if (sched_setaffinity(thread.tid, sizeof(cpu_set_t), &cpuset) != 0)
+    {
+        QLOGW("Cannot set the cores of thread '{}': {}", thread.name, strerror(errno));
+    }
+}
+
+void Thread_Registry::register_current_thread(std::string const& name)
+{
+    Frame_Trace::set_thread_name(name);
+    q::profiler::set_thread_name(name);
+
+    //the kernel limits thread names to 15 chars
+    pthread_setname_np(pthread_self(), name.substr(0, 15).c_str());
+
+    Thread thread;
+    thread.name = name;
+    thread.tid = static_cast<pid_t>(syscall(SYS_gettid));
+
+    std::lock_guard<std::mutex> lg(s_mutex);
+    s_threads.push_back(thread);
+
+    auto it = s_profiles.find(name);
+    if (it != s_profiles.end())
+    {
+        apply_profile(thread, it->second);
+    }
+}
+
+void Thread_Registry::set_profile(std::string const& name, Profile const& profile)
+{
+    std::lock_guard<std::mutex> lg(s_mutex);
+    s_profiles[name] = profile;
+    for (Thread const& thread: s_threads)
+    {
+        if (thread.name == name)
+        {
+            apply_profile(thread, profile);
+        }
+    }
+}
+
+void Thread_Registry::clear_profiles()
+{
+    std::lock_guard<std::mutex> lg(s_mutex);
+    s_profiles.clear();
+}
+
+bool Thread_Registry::lock_memory()
+{
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+    {
+        QLOGW("Cannot lock the memory: {}", strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+auto Thread_Registry::read_stats() -> std::vector<Stats>
+{
+    std::vector<Thread> threads;
+    {
+        std::lock_guard<std::mutex> lg(s_mutex);
+        threads = s_threads;
+    }
+
+    long ticks_per_second = std::max(sysconf(_SC_CLK_TCK), 1L);
+
+    std::vector<Stats> stats;
+    std::vector<pid_t> exited;
+    for (Thread const& thread: threads)
+    {
+        std::string path = "/proc/self/task/" + std::to_string(thread.tid);
+
+        std::ifstream stat_file(path + "/stat");
+        std::string line;
+        if (!std::getline(stat_file, line))
+        {
+            exited.push_back(thread.tid);
+            continue;
+        }
+
+        Stats s;
+        s.name = thread.name;
+        s.tid = static_cast<uint32_t>(thread.tid);
+
+        //the thread name (field 2) can have spaces so skip to the closing parenthesis. utime and stime are fields 14 and 15
+        size_t off = line.rfind(')');
+        if (off != std::string::npos)
+        {
+            std::istringstream iss(line.substr(off + 2));
+            std::string field;
+            uint64_t utime = 0, stime = 0;
+            for (size_t i = 3; i <= 13 && (iss >> field); i++) {}
+            if (iss >> utime >> stime)
+            {
+                s.cpu_time = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(double(utime + stime) / ticks_per_second));
+            }
+        }
+
+        std::ifstream status_file(path + "/status");
+        while (std::getline(status_file, line))
+        {
+            static char const* k_key = "nonvoluntary_ctxt_switches:";
+            if (line.compare(0, strlen(k_key), k_key) == 0)
+            {
+                s.involuntary_context_switches = std::stoull(line.substr(strlen(k_key)));
+                break;
+            }
+        }
+
+        stats.push_back(std::move(s));
+    }
+
+    if (!exited.empty())
+    {
+        std::lock_guard<std::mutex> lg(s_mutex);
+        s_threads.erase(std::remove_if(s_threads.begin(), s_threads.end(), [&exited](Thread const& t)
+        {
+            return std::find(exited.begin(), exited.end(), t.tid) != exited.end();
+        }), s_threads.end());
+    }
+
+    return stats;
+}
+
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Clock.h"
+
+namespace util
+{
+
+//Every long lived thread registers itself by name when it starts. The scheduling profile with the same name -
+// policy, priority and the cores it can run on - is applied to it then, or when the profile is set if the thread
+// was already running. This keeps the scheduling of all the threads in one place (the HAL settings) instead of
+// spread over the code creating them.
+//Threads with the same name share a profile. Threads without a profile keep the default scheduling.
+class Thread_Registry
+{
+public:
+    enum class Policy : uint8_t
+    {
+        OTHER,
+        BATCH,
+        IDLE,
+        FIFO,
+        RR
+    };
+
+    struct Profile
+    {
+        Policy policy = Policy::OTHER;
+        int priority = 0; //only for FIFO and RR
+        std::vector<uint32_t> cpus; //empty to run on any core
+    };
+
+    //call it first thing in the thread. It also names the thread in the frame trace and in the OS
+    static void register_current_thread(std::string const& name);
+
+    static void set_profile(std::string const& name, Profile const& profile);
+    static void clear_profiles();
+
+    //locks the current and future pages of the process in RAM so page faults don't stall the rate loop
+    static bool lock_memory();
+
+    struct Stats
+    {
+        std::string name;
+        uint32_t tid = 0;
+        Clock::duration cpu_time = Clock::duration(0);
+        uint64_t involuntary_context_switches = 0;
+    };
+
+    //Reads the cpu time and context switches of every registered thread from /proc.
+    //Not real-time safe, call it from the async thread. Threads that exited are dropped.
+    static auto read_stats() -> std::vector<Stats>;
+};
+
+}
@@ -1,5 +1,6 @@
 #include "RCP.h"
 #include "utils/Timed_Scope.h"
+#include "Profiler.h"
 #include "lz4/lz4.h"
 #include <zlib.h>
 #include "utils/Clock.h"
@@ -283,6 +284,8 @@ auto RCP::try_sending(uint8_t channel_idx, Send_Params const& params, void const
 
 auto RCP::_send_locked(uint8_t channel_idx, Send_Params const& params, void const* _data, size_t size) -> bool
 {
+    PROFILE_SCOPED_DESC("RCP::send");
+
     //The send mutex should be locked here!!!
     if (size >= (1 << 24))
     {
@@ -465,6 +468,7 @@ inline auto RCP::tx_packet_datagram_predicate(TX::Datagram_ptr const& AA, TX::Da
 bool RCP::receive(uint8_t channel_idx, std::vector<uint8_t>& data)
 {
     QLOG_TOPIC("RCP::receive");
+    PROFILE_SCOPED_DESC("RCP::receive");
 
     data.clear();
     if (channel_idx >= MAX_CHANNELS)
@@ -625,6 +629,8 @@ void RCP::process_connection()
 
 void RCP::process()
 {
+    PROFILE_SCOPED_DESC("RCP::process");
+
     {
         static Clock::time_point tp = Clock::now();
         if (Clock::now() - tp > std::chrono::seconds(1))
@@ -1025,6 +1031,8 @@ void RCP::send_packet_connect_res(Connect_Res_Header::Response response)
 
 void RCP::process_incoming_data(uint8_t* data_ptr, size_t data_size)
 {
+    PROFILE_SCOPED_DESC("RCP::process_incoming_data");
+
     QASSERT(data_ptr && data_size > 0);
     uint8_t* start_ptr = data_ptr;
     uint8_t const* end_ptr = start_ptr + data_size;
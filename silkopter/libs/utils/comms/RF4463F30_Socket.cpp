@@ -1,5 +1,6 @@
 #include "RF4463F30_Socket.h"
 #include "utils/hw/RF4463F30.h"
+#include "utils/Thread_Registry.h"
 
 /*
 
@@ -169,27 +170,13 @@ bool RF4463F30_Socket::start()
         m_thread = std::thread([this]() { slave_thread_proc(); });
     }
 
-
-#if defined RASPBERRY_PI
-    {
-//        int policy = SCHED_OTHER;
-//        struct sched_param param;
-//        param.sched_priority = 0;
-        int policy = SCHED_FIFO;
-        struct sched_param param;
-        param.sched_priority = sched_get_priority_max(policy);
-        if (pthread_setschedparam(m_thread.native_handle(), policy, &param) != 0)
-        {
-            perror("Cannot set TX thread priority - using normal");
-        }
-    }
-#endif
-
     return true;
 }
 
 void RF4463F30_Socket::master_thread_proc()
 {
+    util::Thread_Registry::register_current_thread("rf4463");
+
     while (!m_exit)
     {
         Result result = Result::ERROR;
@@ -267,6 +254,8 @@ void RF4463F30_Socket::master_thread_proc()
 
 void RF4463F30_Socket::slave_thread_proc()
 {
+    util::Thread_Registry::register_current_thread("rf4463");
+
     while (!m_exit)
     {
         //wait for a packet indefinitely
@@ -1,4 +1,5 @@
 #include "RFMON_Socket.h"
+#include "utils/Thread_Registry.h"
 
 #if defined RASPBERRY_PI
 #   include <pcap.h>
@@ -466,6 +467,8 @@ auto RFMON_Socket::start() -> bool
 
     m_rx_thread = std::thread([this]()
     {
+        util::Thread_Registry::register_current_thread("rfmon rx");
+
         while (!m_exit)
         {
             fd_set readset;
@@ -491,6 +494,8 @@ auto RFMON_Socket::start() -> bool
 
     m_tx_thread = std::thread([this]()
     {
+        util::Thread_Registry::register_current_thread("rfmon tx");
+
         while (!m_exit)
         {
             bool sent = false;
@@ -569,26 +574,6 @@ auto RFMON_Socket::start() -> bool
         }
     });
 
-
-#if defined RASPBERRY_PI
-    {
-//        int policy = SCHED_OTHER;
-//        struct sched_param param;
-//        param.sched_priority = 0;
-        int policy = SCHED_FIFO;
-        struct sched_param param;
-        param.sched_priority = sched_get_priority_max(policy);
-        if (pthread_setschedparam(m_tx_thread.native_handle(), policy, &param) != 0)
-        {
-            perror("Cannot set TX thread priority - using normal");
-        }
-        if (pthread_setschedparam(m_rx_thread.native_handle(), policy, &param) != 0)
-        {
-            perror("Cannot set RX thread priority - using normal");
-        }
-    }
-#endif
-
 #endif
 
     return true;
@@ -1,4 +1,5 @@
 #include "UDP_Socket.h"
+#include "utils/Thread_Registry.h"
 #include <asio.hpp>
 #include <functional>
 #include <thread>
@@ -41,7 +42,11 @@ UDP_Socket::UDP_Socket()
     m_asio_send_callback = std::bind(&UDP_Socket::handle_send, this, std::placeholders::_1, std::placeholders::_2);
     m_asio_receive_callback = std::bind(&UDP_Socket::handle_receive, this, std::placeholders::_1, std::placeholders::_2);
 
-    m_io_thread = std::thread([this]() { m_asio_impl->io_service.run(); });
+    m_io_thread = std::thread([this]()
+    {
+        util::Thread_Registry::register_current_thread("udp io");
+        m_asio_impl->io_service.run();
+    });
 }
 
 UDP_Socket::~UDP_Socket()
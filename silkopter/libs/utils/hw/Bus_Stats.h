@@ -0,0 +1,121 @@
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+#include "utils/Clock.h"
+#include "utils/Latency_Histogram.h"
+
+namespace util
+{
+namespace hw
+{
+
+//Transaction stats of a bus, per client device - the I2C address, or 0 for buses with a single client (an SPI
+// chip select, a UART).
+//The buses don't wait for each other - a transaction started while another one holds the bus fails - so the cost of
+// sharing a bus shows up as busy transactions, not as waiting time.
+//Transactions are recorded from the node threads and the HAL latches the stats from the main thread, so both take a
+// mutex that is held only to update a few counters.
+class Bus_Stats
+{
+public:
+    struct Client
+    {
+        uint32_t address = 0;
+        uint32_t transaction_count = 0;
+        uint32_t byte_count = 0;
+        uint32_t error_count = 0; //failed transactions
+        uint32_t busy_count = 0; //transactions refused because another one was using the bus
+        Clock::duration total_duration = Clock::duration(0); //time spent in transactions
+        util::Latency_Histogram duration_histogram;
+    };
+
+    //times one transaction and adds it to the stats when it goes out of scope
+    class Transaction
+    {
+    public:
+        Transaction(Bus_Stats& stats, uint32_t address, size_t size)
+            : m_stats(stats)
+            , m_address(address)
+            , m_size(size)
+            , m_start(Clock::now())
+        {
+        }
+        ~Transaction()
+        {
+            m_stats.add_transaction(m_address, m_size, Clock::now() - m_start, m_is_failed);
+        }
+        void set_size(size_t size)
+        {
+            m_size = size;
+        }
+        void set_failed()
+        {
+            m_is_failed = true;
+        }
+
+    private:
+        Bus_Stats& m_stats;
+        uint32_t m_address;
+        size_t m_size;
+        Clock::time_point m_start;
+        bool m_is_failed = false;
+    };
+
+    void add_transaction(uint32_t address, size_t size, Clock::duration duration, bool is_failed)
+    {
+        std::lock_guard<std::mutex> lg(m_mutex);
+        Client& client = get_client(address);
+        client.transaction_count++;
+        client.byte_count += static_cast<uint32_t>(size);
+        client.error_count += is_failed ? 1 : 0;
+        client.total_duration += duration;
+        client.duration_histogram.add(duration);
+    }
+    void add_busy(uint32_t address)
+    {
+        std::lock_guard<std::mutex> lg(m_mutex);
+        get_client(address).busy_count++;
+    }
+
+    //moves the stats gathered since the last call into clients
+    void latch(std::vector<Client>& clients)
+    {
+        std::lock_guard<std::mutex> lg(m_mutex);
+        clients.resize(m_clients.size());
+        for (size_t i = 0; i < m_clients.size(); i++)
+        {
+            clients[i] = m_clients[i];
+            Client& client = m_clients[i];
+            client.transaction_count = 0;
+            client.byte_count = 0;
+            client.error_count = 0;
+            client.busy_count = 0;
+            client.total_duration = Clock::duration(0);
+            client.duration_histogram.clear();
+        }
+    }
+
+private:
+    //the clients are added when they first use the bus, during init
+    auto get_client(uint32_t address) -> Client&
+    {
+        for (Client& client: m_clients)
+        {
+            if (client.address == address)
+            {
+                return client;
+            }
+        }
+        m_clients.emplace_back();
+        m_clients.back().address = address;
+        return m_clients.back();
+    }
+
+    std::mutex m_mutex;
+    std::vector<Client> m_clients;
+};
+
+}
+}
@@ -24,6 +24,8 @@ I2C_BCM::~I2C_BCM()
 
 ts::Result<void> I2C_BCM::init(uint32_t device, uint32_t baud)
 {
+    m_trace_name = util::Frame_Trace::register_name("i2c bcm " + std::to_string(device));
+
     if (device > 0)
     {
         return ts::Error("Only I2C devices 0 is allowed");
@@ -40,12 +42,15 @@ ts::Result<void> I2C_BCM::init(uint32_t device, uint32_t baud)
 bool I2C_BCM::read(uint8_t address, uint8_t* data, size_t size)
 {
     QLOG_TOPIC("i2c_bcm::read");
+    util::Frame_Trace::Scope trace_scope(m_trace_name);
 
     if (m_is_used.exchange(true) == true)
     {
+        m_stats.add_busy(address);
         QLOGE("I2C bus in use");
         return false;
     }
+    Bus_Stats::Transaction transaction(m_stats, address, size);
 
 #ifdef RASPBERRY_PI
     bcm2835_i2c_setSlaveAddress(address);
@@ -53,6 +58,7 @@ bool I2C_BCM::read(uint8_t address, uint8_t* data, size_t size)
     if (res != BCM2835_I2C_REASON_OK)
     {
         QLOGW("read failed: {}", res);
+        transaction.set_failed();
         m_is_used = false;
         return false;
     }
@@ -64,12 +70,15 @@ bool I2C_BCM::read(uint8_t address, uint8_t* data, size_t size)
 bool I2C_BCM::write(uint8_t address, uint8_t const* data, size_t size)
 {
     QLOG_TOPIC("i2c_bcm::write");
+    util::Frame_Trace::Scope trace_scope(m_trace_name);
 
     if (m_is_used.exchange(true) == true)
     {
+        m_stats.add_busy(address);
         QLOGE("I2C bus in use");
         return false;
     }
+    Bus_Stats::Transaction transaction(m_stats, address, size);
 
 #ifdef RASPBERRY_PI
     bcm2835_i2c_setSlaveAddress(address);
@@ -77,6 +86,7 @@ bool I2C_BCM::write(uint8_t address, uint8_t const* data, size_t size)
     if (res != BCM2835_I2C_REASON_OK)
     {
         QLOGW("write failed: {}", res);
+        transaction.set_failed();
         m_is_used = false;
         return false;
     }
@@ -89,12 +99,15 @@ bool I2C_BCM::write(uint8_t address, uint8_t const* data, size_t size)
 bool I2C_BCM::read_register(uint8_t address, uint8_t reg, uint8_t* data, size_t size)
 {
     QLOG_TOPIC("i2c_bcm::read_register");
+    util::Frame_Trace::Scope trace_scope(m_trace_name);
 
     if (m_is_used.exchange(true) == true)
     {
+        m_stats.add_busy(address);
         QLOGE("I2C bus in use");
         return false;
     }
+    Bus_Stats::Transaction transaction(m_stats, address, size + 1);
 
 #ifdef RASPBERRY_PI
     bcm2835_i2c_setSlaveAddress(address);
@@ -102,6 +115,7 @@ bool I2C_BCM::read_register(uint8_t address, uint8_t reg, uint8_t* data, size_t
     if (res != BCM2835_I2C_REASON_OK)
     {
         QLOGW("read register {} failed: {}", reg, res);
+        transaction.set_failed();
         m_is_used = false;
         return false;
     }
@@ -113,12 +127,15 @@ bool I2C_BCM::read_register(uint8_t address, uint8_t reg, uint8_t* data, size_t
 bool I2C_BCM::write_register(uint8_t address, uint8_t reg, uint8_t const* data, size_t size)
 {
     QLOG_TOPIC("i2c_bcm::write_register");
+    util::Frame_Trace::Scope trace_scope(m_trace_name);
 
     if (m_is_used.exchange(true) == true)
     {
+        m_stats.add_busy(address);
         QLOGE("I2C bus in use");
         return false;
     }
+    Bus_Stats::Transaction transaction(m_stats, address, size + 1);
 
     m_buffer.resize(size + 1);
 
@@ -134,6 +151,7 @@ bool I2C_BCM::write_register(uint8_t address, uint8_t reg, uint8_t const* data,
     if (res != BCM2835_I2C_REASON_OK)
     {
         QLOGW("write register {} failed: {}", reg, res);
+        transaction.set_failed();
         m_is_used = false;
         return false;
     }
@@ -143,5 +161,10 @@ bool I2C_BCM::write_register(uint8_t address, uint8_t reg, uint8_t const* data,
     return true;
 }
 
+Bus_Stats& I2C_BCM::get_stats()
+{
+    return m_stats;
+}
+
 }
 }
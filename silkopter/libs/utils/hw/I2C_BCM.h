@@ -1,6 +1,7 @@
 #pragma once
 
 #include "II2C.h"
+#include "utils/Frame_Trace.h"
 #include <atomic>
 #include <vector>
 
@@ -23,6 +24,8 @@ public:
     bool read_register(uint8_t address, uint8_t reg, uint8_t* data, size_t size) override;
     bool write_register(uint8_t address, uint8_t reg, uint8_t const* data, size_t size) override;
 
+    Bus_Stats& get_stats() override;
+
 private:
     void close();
 
@@ -31,6 +34,8 @@ private:
     std::vector<uint8_t> m_buffer;
 
     mutable std::atomic_bool m_is_used = { false };
+    Bus_Stats m_stats;
+    util::Frame_Trace::Name_Id m_trace_name = 0;
 };
 
 }
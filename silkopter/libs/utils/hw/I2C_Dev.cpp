@@ -49,6 +49,7 @@ I2C_Dev::~I2C_Dev()
 ts::Result<void> I2C_Dev::init(std::string const& device)
 {
     QLOG_TOPIC("I2C_Dev::init");
+    m_trace_name = util::Frame_Trace::register_name("i2c " + device);
     close();
 
     m_fd = ::open(device.c_str(), O_RDWR);
@@ -73,13 +74,17 @@ void I2C_Dev::close()
 bool I2C_Dev::read(uint8_t address, uint8_t* data, size_t size)
 {
     QLOG_TOPIC("I2C_Dev::read");
+    util::Frame_Trace::Scope trace_scope(m_trace_name);
+
     QASSERT(m_fd >= 0);
 
     if (m_is_used.exchange(true) == true)
     {
+        m_stats.add_busy(address);
         QLOGE("SPI bus in use");
         return false;
     }
+    Bus_Stats::Transaction transaction(m_stats, address, size);
 
     struct i2c_rdwr_ioctl_data io;
     memset(&io, 0, sizeof(i2c_rdwr_ioctl_data));
@@ -97,6 +102,7 @@ bool I2C_Dev::read(uint8_t address, uint8_t* data, size_t size)
     if (ioctl(m_fd, I2C_RDWR, &io) < 0)
     {
         QLOGW("read failed: {}", strerror(errno));
+        transaction.set_failed();
         m_is_used = false;
         return false;
     }
@@ -106,13 +112,17 @@ bool I2C_Dev::read(uint8_t address, uint8_t* data, size_t size)
 bool I2C_Dev::write(uint8_t address, uint8_t const* data, size_t size)
 {
     QLOG_TOPIC("I2C_Dev::write");
+    util::Frame_Trace::Scope trace_scope(m_trace_name);
+
     QASSERT(m_fd >= 0);
 
     if (m_is_used.exchange(true) == true)
     {
+        m_stats.add_busy(address);
         QLOGE("SPI bus in use");
         return false;
     }
+    Bus_Stats::Transaction transaction(m_stats, address, size);
 
     struct i2c_rdwr_ioctl_data io;
     memset(&io, 0, sizeof(i2c_rdwr_ioctl_data));
@@ -129,6 +139,7 @@ bool I2C_Dev::write(uint8_t address, uint8_t const* data, size_t size)
     if (ioctl(m_fd, I2C_RDWR, &io) < 0)
     {
         QLOGW("write failed: {}", strerror(errno));
+        transaction.set_failed();
         m_is_used = false;
         return false;
     }
@@ -139,13 +150,17 @@ bool I2C_Dev::write(uint8_t address, uint8_t const* data, size_t size)
 bool I2C_Dev::read_register(uint8_t address, uint8_t reg, uint8_t* data, size_t size)
 {
     QLOG_TOPIC("I2C_Dev::read_register");
+    util::Frame_Trace::Scope trace_scope(m_trace_name);
+
     QASSERT(m_fd >= 0);
 
     if (m_is_used.exchange(true) == true)
     {
+        m_stats.add_busy(address);
         QLOGE("SPI bus in use");
         return false;
     }
+    Bus_Stats::Transaction transaction(m_stats, address, size + 1);
 
     struct i2c_rdwr_ioctl_data io;
     memset(&io, 0, sizeof(i2c_rdwr_ioctl_data));
@@ -168,6 +183,7 @@ bool I2C_Dev::read_register(uint8_t address, uint8_t reg, uint8_t* data, size_t
     if (ioctl(m_fd, I2C_RDWR, &io) < 0)
     {
         QLOGW("read register {} failed: {}", reg, strerror(errno));
+        transaction.set_failed();
         m_is_used = false;
         return false;
     }
@@ -177,13 +193,17 @@ bool I2C_Dev::read_register(uint8_t address, uint8_t reg, uint8_t* data, size_t
 bool I2C_Dev::write_register(uint8_t address, uint8_t reg, uint8_t const* data, size_t size)
 {
     QLOG_TOPIC("I2C_Dev::write_register");
+    util::Frame_Trace::Scope trace_scope(m_trace_name);
+
     QASSERT(m_fd >= 0);
 
     if (m_is_used.exchange(true) == true)
     {
+        m_stats.add_busy(address);
         QLOGE("SPI bus in use");
         return false;
     }
+    Bus_Stats::Transaction transaction(m_stats, address, size + 1);
 
     struct i2c_rdwr_ioctl_data io;
     memset(&io, 0, sizeof(i2c_rdwr_ioctl_data));
@@ -208,6 +228,7 @@ bool I2C_Dev::write_register(uint8_t address, uint8_t reg, uint8_t const* data,
     if (ioctl(m_fd, I2C_RDWR, &io) < 0)
     {
         QLOGW("write register {} failed: {}", reg, strerror(errno));
+        transaction.set_failed();
         m_is_used = false;
         return false;
     }
@@ -215,5 +236,10 @@ bool I2C_Dev::write_register(uint8_t address, uint8_t reg, uint8_t const* data,
     return true;
 }
 
+Bus_Stats& I2C_Dev::get_stats()
+{
+    return m_stats;
+}
+
 }
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "II2C.h"
+#include "utils/Frame_Trace.h"
 #include <atomic>
 #include <vector>
 #include <string>
@@ -26,6 +27,8 @@ public:
     bool read_register(uint8_t address, uint8_t reg, uint8_t* data, size_t size) override;
     bool write_register(uint8_t address, uint8_t reg, uint8_t const* data, size_t size) override;
 
+    Bus_Stats& get_stats() override;
+
 private:
     void close();
 
@@ -33,6 +36,8 @@ private:
     int m_fd = -1;
     std::vector<uint8_t> m_buffer;
     mutable std::atomic_bool m_is_used = { false };
+    Bus_Stats m_stats;
+    util::Frame_Trace::Name_Id m_trace_name = 0;
 };
 
 }
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <memory>
+#include "Bus_Stats.h"
 
 namespace util
 {
@@ -19,6 +20,9 @@ public:
     virtual bool read_register(uint8_t address, uint8_t reg, uint8_t* data, size_t size) = 0;
     virtual bool write_register(uint8_t address, uint8_t reg, uint8_t const* data, size_t size) = 0;
 
+    //per address
+    virtual Bus_Stats& get_stats() = 0;
+
     //-----------------------------------
 
     bool read_register_u16(uint8_t address, uint8_t reg, uint16_t& dst);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "utils/Clock.h"
+#include "Bus_Stats.h"
 
 namespace util
 {
@@ -25,10 +26,15 @@ public:
 
     virtual bool transfers(Transfer const* transfers, size_t transfer_count, uint32_t speed = 0) = 0;
 
+    virtual Bus_Stats& get_stats() = 0;
+
     //-----------------------------------
     //convenience method
     bool transfer_register_u16(uint8_t reg, uint16_t tx_data, uint16_t& rx_data, uint32_t speed = 0);
     bool transfer_register_u8(uint8_t reg, uint8_t tx_data, uint8_t& rx_data, uint32_t speed = 0);
+
+protected:
+    static size_t get_transfers_size(Transfer const* transfers, size_t transfer_count);
 };
 
 //-----------------------------------
@@ -45,6 +51,15 @@ inline bool ISPI::transfer_register_u16(uint8_t reg, uint16_t tx_data, uint16_t&
     }
     return false;
 }
+inline size_t ISPI::get_transfers_size(Transfer const* transfers, size_t transfer_count)
+{
+    size_t size = 0;
+    for (size_t i = 0; i < transfer_count; i++)
+    {
+        size += transfers[i].size;
+    }
+    return size;
+}
 inline bool ISPI::transfer_register_u8(uint8_t reg, uint8_t tx_data, uint8_t& rx_data, uint32_t speed)
 {
     return transfer_register(reg, &tx_data, &rx_data, 1, speed);
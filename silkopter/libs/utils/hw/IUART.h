@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Bus_Stats.h"
+
 namespace util
 {
 namespace hw
@@ -14,6 +16,8 @@ public:
     virtual bool write(uint8_t const* data, size_t size) = 0;
 
     virtual void send_break() = 0;
+
+    virtual Bus_Stats& get_stats() = 0;
 };
 
 
@@ -22,6 +22,8 @@ SPI_BCM::~SPI_BCM()
 
 ts::Result<void> SPI_BCM::init(uint32_t channel, uint32_t speed, uint32_t mode)
 {
+    m_trace_name = util::Frame_Trace::register_name("spi bcm " + std::to_string(channel));
+
     if (channel > 1)
     {
         return ts::Error("Only SPI channels 0 & 1 are allowed");
@@ -101,14 +103,21 @@ bool SPI_BCM::do_transfer(void const* tx_data, void* rx_data, size_t size, uint3
 bool SPI_BCM::transfer(void const* tx_data, void* rx_data, size_t size, uint32_t speed)
 {
     QLOG_TOPIC("spi_bcm::transfer");
+    util::Frame_Trace::Scope trace_scope(m_trace_name);
 
     if (m_is_used.exchange(true) == true)
     {
+        m_stats.add_busy(0);
         QLOGE("SPI bus in use");
         return false;
     }
+    Bus_Stats::Transaction transaction(m_stats, 0, size);
 
     bool res = do_transfer(tx_data, rx_data, size, speed);
+    if (!res)
+    {
+        transaction.set_failed();
+    }
 
     m_is_used = false;
 
@@ -117,10 +126,21 @@ bool SPI_BCM::transfer(void const* tx_data, void* rx_data, size_t size, uint32_t
 
 bool SPI_BCM::transfers(Transfer const* transfers, size_t transfer_count, uint32_t speed)
 {
+    util::Frame_Trace::Scope trace_scope(m_trace_name);
+
+    if (m_is_used.exchange(true) == true)
+    {
+        m_stats.add_busy(0);
+        QLOGE("SPI bus in use");
+        return false;
+    }
+    Bus_Stats::Transaction transaction(m_stats, 0, get_transfers_size(transfers, transfer_count));
+
     for (size_t i = 0; i < transfer_count; i++)
     {
         if (!do_transfer(transfers[i].tx_data, transfers[i].rx_data, transfers[i].size, speed))
         {
+            transaction.set_failed();
             m_is_used = false;
             return false;
         }
@@ -132,12 +152,15 @@ bool SPI_BCM::transfers(Transfer const* transfers, size_t transfer_count, uint32
 bool SPI_BCM::transfer_register(uint8_t reg, void const* tx_data, void* rx_data, size_t size, uint32_t speed)
 {
     QLOG_TOPIC("spi_bcm::transfer_register");
+    util::Frame_Trace::Scope trace_scope(m_trace_name);
 
     if (m_is_used.exchange(true) == true)
     {
+        m_stats.add_busy(0);
         QLOGE("SPI bus in use");
         return false;
     }
+    Bus_Stats::Transaction transaction(m_stats, 0, size + 1);
 
     m_tx_buffer.resize(size + 1);
     m_tx_buffer[0] = reg;
@@ -146,6 +169,7 @@ bool SPI_BCM::transfer_register(uint8_t reg, void const* tx_data, void* rx_data,
     m_rx_buffer.resize(size + 1);
     if (!do_transfer(m_tx_buffer.data(), m_rx_buffer.data(), size + 1, speed))
     {
+        transaction.set_failed();
         m_is_used = false;
         return false;
     }
@@ -155,5 +179,10 @@ bool SPI_BCM::transfer_register(uint8_t reg, void const* tx_data, void* rx_data,
     return true;
 }
 
+Bus_Stats& SPI_BCM::get_stats()
+{
+    return m_stats;
+}
+
 }
 }
@@ -29,6 +29,7 @@ SPI_Dev::~SPI_Dev()
 ts::Result<void> SPI_Dev::init(std::string const& device, uint32_t speed)
 {
     QLOG_TOPIC("SPI_Dev::init");
+    m_trace_name = util::Frame_Trace::register_name("spi " + device);
 
     if (speed == 0)
     {
@@ -103,14 +104,21 @@ bool SPI_Dev::do_transfer(void const* tx_data, void* rx_data, size_t size, uint3
 bool SPI_Dev::transfer(void const* tx_data, void* rx_data, size_t size, uint32_t speed)
 {
     QLOG_TOPIC("SPI_Dev::transfer");
+    util::Frame_Trace::Scope trace_scope(m_trace_name);
 
     if (m_is_used.exchange(true) == true)
     {
+        m_stats.add_busy(0);
         QLOGE("SPI bus in use");
         return false;
     }
+    Bus_Stats::Transaction transaction(m_stats, 0, size);
 
     bool res = do_transfer(tx_data, rx_data, size, speed);
+    if (!res)
+    {
+        transaction.set_failed();
+    }
 
     m_is_used = false;
 
@@ -119,11 +127,15 @@ bool SPI_Dev::transfer(void const* tx_data, void* rx_data, size_t size, uint32_t
 
 bool SPI_Dev::transfers(Transfer const* transfers, size_t transfer_count, uint32_t speed)
 {
+    util::Frame_Trace::Scope trace_scope(m_trace_name);
+
     if (m_is_used.exchange(true) == true)
     {
+        m_stats.add_busy(0);
         QLOGE("SPI bus in use");
         return false;
     }
+    Bus_Stats::Transaction transaction(m_stats, 0, get_transfers_size(transfers, transfer_count));
 
     if (transfer_count > 256)
     {
@@ -131,6 +143,7 @@ bool SPI_Dev::transfers(Transfer const* transfers, size_t transfer_count, uint32
         {
             if (!do_transfer(transfers[i].tx_data, transfers[i].rx_data, transfers[i].size, speed))
             {
+                transaction.set_failed();
                 m_is_used = false;
                 return false;
             }
@@ -141,6 +154,7 @@ bool SPI_Dev::transfers(Transfer const* transfers, size_t transfer_count, uint32
         QASSERT(m_fd >= 0);
         if (m_fd < 0)
         {
+            transaction.set_failed();
             m_is_used = false;
             return false;
         }
@@ -160,6 +174,7 @@ bool SPI_Dev::transfers(Transfer const* transfers, size_t transfer_count, uint32
         if (status < 0)
         {
             QLOGW("transfer failed: {}", strerror(errno));
+            transaction.set_failed();
             m_is_used = false;
             return false;
         }
@@ -172,12 +187,15 @@ bool SPI_Dev::transfers(Transfer const* transfers, size_t transfer_count, uint32
 bool SPI_Dev::transfer_register(uint8_t reg, void const* tx_data, void* rx_data, size_t size, uint32_t speed)
 {
     QLOG_TOPIC("SPI_Dev::transfer_register");
+    util::Frame_Trace::Scope trace_scope(m_trace_name);
 
     if (m_is_used.exchange(true) == true)
     {
+        m_stats.add_busy(0);
         QLOGE("SPI bus in use");
         return false;
     }
+    Bus_Stats::Transaction transaction(m_stats, 0, size + 1);
 
     m_tx_buffer.resize(size + 1);
     m_tx_buffer[0] = reg;
@@ -186,6 +204,7 @@ bool SPI_Dev::transfer_register(uint8_t reg, void const* tx_data, void* rx_data,
     m_rx_buffer.resize(size + 1);
     if (!do_transfer(m_tx_buffer.data(), m_rx_buffer.data(), size + 1, speed))
     {
+        transaction.set_failed();
         m_is_used = false;
         return false;
     }
@@ -196,5 +215,10 @@ bool SPI_Dev::transfer_register(uint8_t reg, void const* tx_data, void* rx_data,
     return true;
 }
 
+Bus_Stats& SPI_Dev::get_stats()
+{
+    return m_stats;
+}
+
 }
 }
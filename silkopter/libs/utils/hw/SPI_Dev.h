@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ISPI.h"
+#include "utils/Frame_Trace.h"
 #include <atomic>
 #include <vector>
 #include <string>
@@ -24,6 +25,8 @@ public:
 
     bool transfers(Transfer const* transfers, size_t transfer_count, uint32_t speed = 0) override;
 
+    Bus_Stats& get_stats() override;
+
 private:
     bool do_transfer(void const* tx_data, void* rx_data, size_t size, uint32_t speed);
 
@@ -38,6 +41,8 @@ private:
     mutable std::vector<uint8_t> m_rx_buffer;
 
     mutable std::atomic_bool m_is_used = { false };
+    Bus_Stats m_stats;
+    util::Frame_Trace::Name_Id m_trace_name = 0;
 };
 
 }
@@ -28,6 +28,8 @@ SPI_PIGPIO::~SPI_PIGPIO()
 
 ts::Result<void> SPI_PIGPIO::init(uint32_t port, uint32_t channel, uint32_t speed, uint32_t mode)
 {
+    m_trace_name = util::Frame_Trace::register_name("spi pigpio " + std::to_string(port) + "." + std::to_string(channel));
+
 #if defined RASPBERRY_PI
     if (m_fd >= 0)
     {
@@ -117,14 +119,21 @@ bool SPI_PIGPIO::do_transfer(void const* tx_data, void* rx_data, size_t size, ui
 bool SPI_PIGPIO::transfer(void const* tx_data, void* rx_data, size_t size, uint32_t speed)
 {
     QLOG_TOPIC("spi_PIGPIO::transfer");
+    util::Frame_Trace::Scope trace_scope(m_trace_name);
 
     if (m_is_used.exchange(true) == true)
     {
+        m_stats.add_busy(0);
         QLOGE("SPI bus in use");
         return false;
     }
+    Bus_Stats::Transaction transaction(m_stats, 0, size);
 
     bool res = do_transfer(tx_data, rx_data, size, speed);
+    if (!res)
+    {
+        transaction.set_failed();
+    }
 
     m_is_used = false;
 
@@ -133,16 +142,21 @@ bool SPI_PIGPIO::transfer(void const* tx_data, void* rx_data, size_t size, uint3
 
 bool SPI_PIGPIO::transfers(Transfer const* transfers, size_t transfer_count, uint32_t speed)
 {
+    util::Frame_Trace::Scope trace_scope(m_trace_name);
+
     if (m_is_used.exchange(true) == true)
     {
+        m_stats.add_busy(0);
         QLOGE("SPI bus in use");
         return false;
     }
+    Bus_Stats::Transaction transaction(m_stats, 0, get_transfers_size(transfers, transfer_count));
 
     for (size_t i = 0; i < transfer_count; i++)
     {
         if (!do_transfer(transfers[i].tx_data, transfers[i].rx_data, transfers[i].size, speed))
         {
+            transaction.set_failed();
             m_is_used = false;
             return false;
         }
@@ -154,12 +168,15 @@ bool SPI_PIGPIO::transfers(Transfer const* transfers, size_t transfer_count, uin
 bool SPI_PIGPIO::transfer_register(uint8_t reg, void const* tx_data, void* rx_data, size_t size, uint32_t speed)
 {
     QLOG_TOPIC("spi_PIGPIO::transfer_register");
+    util::Frame_Trace::Scope trace_scope(m_trace_name);
 
     if (m_is_used.exchange(true) == true)
     {
+        m_stats.add_busy(0);
         QLOGE("SPI bus in use");
         return false;
     }
+    Bus_Stats::Transaction transaction(m_stats, 0, size + 1);
 
     m_tx_buffer.resize(size + 1);
     m_tx_buffer[0] = reg;
@@ -168,6 +185,7 @@ bool SPI_PIGPIO::transfer_register(uint8_t reg, void const* tx_data, void* rx_da
     m_rx_buffer.resize(size + 1);
     if (!do_transfer(m_tx_buffer.data(), m_rx_buffer.data(), size + 1, speed))
     {
+        transaction.set_failed();
         m_is_used = false;
         return false;
     }
@@ -178,5 +196,10 @@ bool SPI_PIGPIO::transfer_register(uint8_t reg, void const* tx_data, void* rx_da
     return true;
 }
 
+Bus_Stats& SPI_PIGPIO::get_stats()
+{
+    return m_stats;
+}
+
 }
 }
@@ -72,18 +72,22 @@ size_t UART_BB::read(uint8_t* data, size_t max_size)
 
     if (m_is_used.exchange(true) == true)
     {
+        m_stats.add_busy(0);
         QLOGE("SPI bus in use");
         return false;
     }
+    Bus_Stats::Transaction transaction(m_stats, 0, 0);
 
 #if defined (RASPBERRY_PI)
     int res = gpioSerialRead(m_rx_gpio, data, max_size);
     if (res < 0)
     {
         QLOGE("error reading from bit-banged rx gpio {}: {}", m_rx_gpio, res);
+        transaction.set_failed();
         m_is_used = false;
         return 0;
     }
+    transaction.set_size(res);
     m_is_used = false;
     return res;
 #else
@@ -104,5 +108,10 @@ void UART_BB::send_break()
     QLOGE("not supported");
 }
 
+Bus_Stats& UART_BB::get_stats()
+{
+    return m_stats;
+}
+
 }
 }
@@ -23,12 +23,15 @@ public:
 
     void send_break() override;
 
+    Bus_Stats& get_stats() override;
+
 private:
     void close();
 
     uint32_t m_rx_gpio = 0;
 
     mutable std::atomic_bool m_is_used = { false };
+    Bus_Stats m_stats;
 
     bool m_is_initialized = true;
 };
@@ -21,6 +21,8 @@ UART_Dev::~UART_Dev()
 
 ts::Result<void> UART_Dev::init(std::string const& device, Baud baud)
 {
+    m_trace_name = util::Frame_Trace::register_name("uart " + device);
+
     int baud_id = -1;
     switch (baud)
     {
@@ -76,13 +78,17 @@ void UART_Dev::close()
 size_t UART_Dev::read(uint8_t* data, size_t max_size)
 {
     QLOG_TOPIC("UART_Dev::read");
+    util::Frame_Trace::Scope trace_scope(m_trace_name);
+
     QASSERT(m_fd >= 0);
 
     if (m_is_used.exchange(true) == true)
     {
+        m_stats.add_busy(0);
         QLOGE("SPI bus in use");
         return false;
     }
+    Bus_Stats::Transaction transaction(m_stats, 0, 0);
 
     int res = ::read(m_fd, data, max_size);
     if (res < 0)
@@ -90,28 +96,35 @@ size_t UART_Dev::read(uint8_t* data, size_t max_size)
         if (errno != EWOULDBLOCK && errno != EAGAIN)
         {
             QLOGE("error reading from {}: {}", m_device, strerror(errno));
+            transaction.set_failed();
         }
         m_is_used = false;
         return 0;
     }
+    transaction.set_size(res);
     m_is_used = false;
     return res;
 }
 bool UART_Dev::write(uint8_t const* data, size_t size)
 {
     QLOG_TOPIC("UART_Dev::write");
+    util::Frame_Trace::Scope trace_scope(m_trace_name);
+
     QASSERT(m_fd >= 0);
 
     if (m_is_used.exchange(true) == true)
     {
+        m_stats.add_busy(0);
         QLOGE("SPI bus in use");
         return false;
     }
+    Bus_Stats::Transaction transaction(m_stats, 0, size);
 
     int res = ::write(m_fd, data, size);
     if (res < 0)
     {
         QLOGE("error writing to {}: {}", m_device, strerror(errno));
+        transaction.set_failed();
         m_is_used = false;
         return false;
     }
@@ -123,6 +136,7 @@ void UART_Dev::send_break()
 {
     if (m_is_used.exchange(true) == true)
     {
+        m_stats.add_busy(0);
         QLOGE("SPI bus in use");
         return;
     }
@@ -132,5 +146,10 @@ void UART_Dev::send_break()
     m_is_used = false;
 }
 
+Bus_Stats& UART_Dev::get_stats()
+{
+    return m_stats;
+}
+
 }
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "IUART.h"
+#include "utils/Frame_Trace.h"
 #include <string>
 #include <vector>
 #include <atomic>
@@ -33,6 +34,8 @@ public:
 
     void send_break() override;
 
+    Bus_Stats& get_stats() override;
+
 private:
     void close();
 
@@ -42,6 +45,8 @@ private:
     std::vector<uint8_t> m_buffer;
 
     mutable std::atomic_bool m_is_used = { false };
+    Bus_Stats m_stats;
+    util::Frame_Trace::Name_Id m_trace_name = 0;
 };
 
 }
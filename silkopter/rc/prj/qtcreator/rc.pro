@@ -93,6 +93,7 @@ HEADERS += \
     ../../src/Comms.h \
     ../../src/stdafx.h \
     ../../../libs/common/Comm_Data.h \
+    ../../../libs/utils/Biquad_Cascade.h \
     ../../../libs/utils/Butterworth.h \
     ../../../libs/utils/PID.h \
     ../../../libs/utils/Timed_Scope.h \
@@ -140,6 +141,8 @@ HEADERS += \
     ../../../libs/common/stream/IProximity.h \
     ../../../libs/common/stream/Stream_Base.h \
     ../../../libs/utils/Coordinates.h \
+    ../../../libs/utils/Frame_Trace.h \
+    ../../../libs/utils/Thread_Registry.h \
     ../../../libs/common/node/ICombiner.h \
     ../../../libs/common/stream/IMultirotor_Commands.h \
     ../../../libs/common/stream/IMultirotor_State.h \
@@ -163,6 +166,7 @@ HEADERS += \
     ../../../libs/utils/hw/ISPI.h \
     ../../../libs/utils/hw/I2C_BCM.h \
     ../../../libs/utils/hw/IUART.h \
+    ../../../libs/utils/hw/Bus_Stats.h \
     ../../../libs/utils/hw/SPI_BCM.h \
     ../../../libs/utils/hw/UART_BB.h \
     ../../../libs/utils/hw/UART_Dev.h \
@@ -182,6 +186,8 @@ SOURCES += \
     ../../src/Comms.cpp \
     ../../../libs/lz4/lz4.c \
     ../../../libs/utils/Coordinates.cpp \
+    ../../../libs/utils/Frame_Trace.cpp \
+    ../../../libs/utils/Thread_Registry.cpp \
     ../../src/Video_Decoder.cpp \
     ../../../libs/utils/hw/bcm2835.c \
     ../../../libs/utils/hw/command.c \
@@ -76,6 +76,7 @@ HEADERS += \
     ../../../../libs/utils/comms/RC_Phy.h \
     ../../../../libs/utils/comms/RC_Protocol.h \
     ../../../../libs/utils/hw/ISPI.h \
+    ../../../../libs/utils/hw/Bus_Stats.h \
     ../../../../libs/utils/Queue.h \
     ../../../../libs/utils/hw/command.h \
     ../../../../libs/utils/hw/pigpio.h
@@ -85,6 +86,7 @@ SOURCES += \
     ../../../../libs/utils/hw/RF4463F30.cpp \
     ../../../../libs/utils/hw/Si4463.cpp \
     ../../../../libs/utils/hw/SPI_Dev.cpp \
+    ../../../../libs/utils/Frame_Trace.cpp \
     ../../../../libs/utils/comms/fec.cpp \
     ../../../../libs/utils/comms/RC_Phy.cpp \
     ../../../../libs/utils/comms/RC_Protocol.cpp \